@@ -76,6 +76,7 @@ Enjoy!
 
 #include "SDL_main.h"
 #include "SDL_stdinc.h"
+#include "SDL_asyncload.h"
 #include "SDL_audio.h"
 #include "SDL_cdrom.h"
 #include "SDL_cpuinfo.h"
@@ -83,9 +84,11 @@ Enjoy!
 #include "SDL_error.h"
 #include "SDL_events.h"
 #include "SDL_loadso.h"
+#include "SDL_profile.h"
 #include "SDL_mutex.h"
 #include "SDL_rwops.h"
 #include "SDL_thread.h"
+#include "SDL_threadpool.h"
 #include "SDL_timer.h"
 #include "SDL_video.h"
 #include "SDL_version.h"
@@ -0,0 +1,204 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+
+/**
+ * \file SDL_asyncload.h
+ *
+ * Load BMP images and WAVE sounds on background threads
+ *
+ * Each load returns a handle which can be polled or waited for, and can
+ * push an event when it finishes.  Loads run on a pool of their own,
+ * separate from the shared thread pool, so they never hold up threads
+ * doing other work.  Set the environment variable SDL_ASYNC_LOAD_THREADS
+ * to the number of loads that may run at once; the default is 2.  Loads
+ * beyond that wait their turn, in the order they were started.
+ */
+
+#ifndef _SDL_asyncload_h
+#define _SDL_asyncload_h
+
+#include "SDL_stdinc.h"
+#include "SDL_error.h"
+#include "SDL_rwops.h"
+#include "SDL_surface.h"
+#include "SDL_audio.h"
+
+#include "begin_code.h"
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+/* *INDENT-OFF* */
+extern "C" {
+/* *INDENT-ON* */
+#endif
+
+/* The load structure, defined in SDL_asyncload.c */
+struct SDL_AsyncLoad;
+typedef struct SDL_AsyncLoad SDL_AsyncLoad;
+
+/**
+ * \enum SDL_AsyncLoadStatus
+ *
+ * \brief Where a load has got to
+ */
+typedef enum
+{
+    SDL_ASYNCLOAD_PENDING,      /**< Waiting for a thread to run it */
+    SDL_ASYNCLOAD_LOADING,      /**< Being loaded now */
+    SDL_ASYNCLOAD_DONE,         /**< Loaded, the result is ready */
+    SDL_ASYNCLOAD_FAILED,       /**< The load failed */
+    SDL_ASYNCLOAD_CANCELLED     /**< Cancelled before it finished */
+} SDL_AsyncLoadStatus;
+
+/**
+ * \fn SDL_AsyncLoad *SDL_LoadBMPAsync_RW(SDL_RWops *src, int freesrc, Uint8 event)
+ *
+ * \brief Start loading a BMP image with SDL_LoadBMP_RW() on a background
+ *        thread.
+ *
+ * Don't use 'src' until the load has finished.  If 'freesrc' is non-zero
+ * it is closed when the load finishes or is cancelled.
+ *
+ * \param event 0, or an event type from SDL_USEREVENT up to SDL_NUMEVENTS-1
+ *        to push when the load is done or has failed, with the load in
+ *        'data1'.  Events are only pushed while the video subsystem is
+ *        initialized.
+ *
+ * \return The load, or NULL if there was an error.
+ *
+ * \note If background threads aren't available, the image is loaded
+ *       before this returns.
+ */
+extern DECLSPEC SDL_AsyncLoad *SDLCALL SDL_LoadBMPAsync_RW(SDL_RWops * src,
+                                                          int freesrc,
+                                                          Uint8 event);
+
+/* Convenience macro -- load an image from a file */
+#define SDL_LoadBMPAsync(file, event) \
+    SDL_LoadBMPAsync_RW(SDL_RWFromMappedFile(file), 1, event)
+
+/**
+ * \fn SDL_AsyncLoad *SDL_LoadWAVAsync_RW(SDL_RWops *src, int freesrc, Uint8 event)
+ *
+ * \brief Start loading a WAVE sound with SDL_LoadWAV_RW() on a background
+ *        thread, including decoding any ADPCM data.
+ *
+ * The source and the event are as for SDL_LoadBMPAsync_RW().
+ */
+extern DECLSPEC SDL_AsyncLoad *SDLCALL SDL_LoadWAVAsync_RW(SDL_RWops * src,
+                                                          int freesrc,
+                                                          Uint8 event);
+
+/* Convenience macro -- load a sound from a file */
+#define SDL_LoadWAVAsync(file, event) \
+    SDL_LoadWAVAsync_RW(SDL_RWFromMappedFile(file), 1, event)
+
+/**
+ * \fn SDL_AsyncLoadStatus SDL_GetAsyncLoadStatus(SDL_AsyncLoad *load)
+ *
+ * \brief Find out where a load has got to, without waiting.
+ *
+ * If the load failed, the reason is set as the SDL error.
+ */
+extern DECLSPEC SDL_AsyncLoadStatus SDLCALL
+SDL_GetAsyncLoadStatus(SDL_AsyncLoad * load);
+
+/**
+ * \fn SDL_AsyncLoadStatus SDL_WaitAsyncLoad(SDL_AsyncLoad *load)
+ *
+ * \brief Wait until a load is done, has failed or has been cancelled.
+ *
+ * \return The final status of the load
+ */
+extern DECLSPEC SDL_AsyncLoadStatus SDLCALL
+SDL_WaitAsyncLoad(SDL_AsyncLoad * load);
+
+/**
+ * \fn int SDL_CancelAsyncLoad(SDL_AsyncLoad *load)
+ *
+ * \brief Cancel a load that hasn't finished.
+ *
+ * A load that hasn't started is dropped without reading anything.  One
+ * that is already loading can't be stopped part way, but its result is
+ * thrown away and no event is pushed for it.
+ *
+ * \return 0 if the load was cancelled, or -1 if it had already finished.
+ */
+extern DECLSPEC int SDLCALL SDL_CancelAsyncLoad(SDL_AsyncLoad * load);
+
+/**
+ * \fn SDL_Surface *SDL_GetAsyncLoadSurface(SDL_AsyncLoad *load)
+ *
+ * \brief Take the surface from a BMP load that is done.
+ *
+ * The surface then belongs to the caller, and later calls return NULL.
+ *
+ * \return The surface, or NULL if the load isn't done.
+ */
+extern DECLSPEC SDL_Surface *SDLCALL SDL_GetAsyncLoadSurface(SDL_AsyncLoad *
+                                                             load);
+
+/**
+ * \fn SDL_AudioSpec *SDL_GetAsyncLoadWAV(SDL_AsyncLoad *load, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+ *
+ * \brief Take the sound from a WAVE load that is done, as SDL_LoadWAV_RW()
+ *        would have returned it.
+ *
+ * The buffer then belongs to the caller, to free with SDL_FreeWAV(), and
+ * later calls return NULL.
+ *
+ * \return 'spec', or NULL if the load isn't done.
+ */
+extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_GetAsyncLoadWAV(SDL_AsyncLoad *
+                                                           load,
+                                                           SDL_AudioSpec *
+                                                           spec,
+                                                           Uint8 **
+                                                           audio_buf,
+                                                           Uint32 *
+                                                           audio_len);
+
+/**
+ * \fn void SDL_FreeAsyncLoad(SDL_AsyncLoad *load)
+ *
+ * \brief Cancel a load if it hasn't finished, and free it along with any
+ *        result that wasn't taken.
+ *
+ * This doesn't wait for a load that is running.
+ *
+ * \note Handle or drop any event pushed for the load first, since the
+ *       event points to it.  The event is queued before the load can be
+ *       seen to have finished, so once SDL_WaitAsyncLoad() returns it's
+ *       safe to read the events and then free the load.
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAsyncLoad(SDL_AsyncLoad * load);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+/* *INDENT-OFF* */
+}
+/* *INDENT-ON* */
+#endif
+#include "close_code.h"
+
+#endif /* _SDL_asyncload_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -140,6 +140,26 @@ struct SDL_AudioCVT;
 typedef void (SDLCALL * SDL_AudioFilter) (struct SDL_AudioCVT * cvt,
                                           SDL_AudioFormat format);
 
+/* The longest filter the audio resampler uses, in sample frames */
+#define SDL_AUDIOCVT_MAX_TAPS   64
+
+/* The most channels the audio resampler keeps history for */
+#define SDL_AUDIOCVT_MAX_CHANNELS   6
+
+/* Resampler state carried from one SDL_ConvertAudio() call to the next.
+   This is private to SDL, it is set up by SDL_BuildAudioCVT().
+ */
+typedef struct SDL_AudioResampler
+{
+    const float *coeffs;        /* Filter table while converting */
+    int taps;                   /* Filter length in sample frames */
+    int channels;               /* Channels per sample frame */
+    int phases;                 /* Interpolation factor */
+    int step;                   /* Decimation factor */
+    int phase;                  /* Position of the next output frame */
+    float history[(SDL_AUDIOCVT_MAX_TAPS - 1) * SDL_AUDIOCVT_MAX_CHANNELS];
+} SDL_AudioResampler;
+
 typedef struct SDL_AudioCVT
 {
     int needed;                 /* Set to 1 if conversion possible */
@@ -153,6 +173,7 @@ typedef struct SDL_AudioCVT
     double len_ratio;           /* Given len, final size is len*len_ratio */
     SDL_AudioFilter filters[10];        /* Filter list */
     int filter_index;           /* Current audio conversion function */
+    SDL_AudioResampler resampler;       /* Rate conversion state */
 } SDL_AudioCVT;
 
 
@@ -208,6 +229,7 @@ extern DECLSPEC const char *SDLCALL SDL_GetCurrentAudioDriver(void);
  *     This function usually runs in a separate thread, and so you should
  *     protect data structures that it accesses by calling SDL_LockAudio()
  *     and SDL_UnlockAudio() in your code.
+ *     If it is NULL, the device plays audio queued with SDL_QueueAudio().
  *  'desired->userdata' is passed as the first parameter to your callback
  *     function.
  *
@@ -340,6 +362,70 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/* A WAVE file being read a little at a time, defined in SDL_wave.c */
+struct SDL_WAVStream;
+typedef struct SDL_WAVStream SDL_WAVStream;
+
+/*
+ * This function opens a WAVE from the data source for reading a few
+ * frames at a time, instead of loading all of it.  The source is
+ * closed by SDL_CloseWAVStream() if 'freesrc' is non-zero, or straight
+ * away if the stream can't be opened.
+ *
+ * It returns a stream and fills in 'spec' with the audio data format
+ * of the frames it reads, as SDL_LoadWAV_RW() would.  ADPCM data is
+ * decoded one block at a time as it is read, so the memory used stays
+ * the same however long the sound is.
+ *
+ * This function returns NULL and sets the SDL error message if the
+ * wave file cannot be opened, uses an unknown data format, or is
+ * corrupt.
+ */
+extern DECLSPEC SDL_WAVStream *SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                           int freesrc,
+                                                           SDL_AudioSpec *
+                                                           spec);
+
+/* Convenience macro -- opens a WAV stream from a file */
+#define SDL_OpenWAVStream(file, spec) \
+	SDL_OpenWAVStream_RW(SDL_RWFromFile(file, "rb"), 1, spec)
+
+/*
+ * This function reads up to 'frames' frames from a WAVE stream into
+ * 'buf'.  A frame is one sample for each channel, so it is
+ * (SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels bytes.  To
+ * play a stream, an audio callback opened with the same spec can do:
+ *	SDL_ReadWAVStream(stream, stream_buf, len / frame_size);
+ * and fill what's left of its buffer with silence.
+ *
+ * It returns the number of frames read, which is less than 'frames'
+ * at the end of the sound, or -1 if there was an error.
+ */
+extern DECLSPEC int SDLCALL SDL_ReadWAVStream(SDL_WAVStream * stream,
+                                              void *buf, Uint32 frames);
+
+/*
+ * This function moves a WAVE stream so the next read starts at 'frame'.
+ * Frames past the end of the sound are taken as the end.  It returns 0,
+ * or -1 if the source can't seek.
+ */
+extern DECLSPEC int SDLCALL SDL_SeekWAVStream(SDL_WAVStream * stream,
+                                              Uint32 frame);
+
+/*
+ * These functions return the frame the next read of a WAVE stream
+ * starts at, and the number of frames in the sound.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_TellWAVStream(SDL_WAVStream * stream);
+extern DECLSPEC Uint32 SDLCALL SDL_GetWAVStreamLength(SDL_WAVStream *
+                                                      stream);
+
+/*
+ * This function closes a WAVE stream, and its source if it was opened
+ * with 'freesrc' set.
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream * stream);
+
 /*
  * This function takes a source format and rate and a destination format
  * and rate, and initializes the 'cvt' structure with information needed
@@ -363,6 +449,9 @@ extern DECLSPEC int SDLCALL SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
  * The data conversion may expand the size of the audio data, so the buffer
  * cvt->buf should be allocated after the cvt structure is initialized by
  * SDL_BuildAudioCVT(), and should be cvt->len*cvt->len_mult bytes long.
+ * When the rate changes, consecutive calls with the same 'cvt' structure
+ * are treated as one continuous stream, so the number of converted sample
+ * frames in cvt->len_cvt can vary by one from call to call.
  */
 extern DECLSPEC int SDLCALL SDL_ConvertAudio(SDL_AudioCVT * cvt);
 
@@ -387,6 +476,28 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/*
+ * Queue more audio on a device opened without a callback. The data must be
+ *  in the format of the 'obtained' spec from SDL_OpenAudioDevice(), and is
+ *  copied, so it can be reused or freed as soon as this returns. Queueing
+ *  never waits for the audio callback, it can be done from any thread.
+ *  When the queue runs dry, the device plays silence.
+ * Returns 0 on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev,
+                                           const void *data, Uint32 len);
+
+/*
+ * Get the number of bytes queued on a device and not yet played, or 0 for
+ *  a device that isn't queueing.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
+
+/*
+ * Drop all the audio queued on a device and not yet played.
+ */
+extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
+
 /*
  * The lock manipulated by these functions protects the callback function.
  * During a LockAudio/UnlockAudio pair, you can be guaranteed that the
@@ -44,6 +44,7 @@ typedef unsigned long uintptr_t;
 #define HAVE_CTYPE_H	1
 #define HAVE_MATH_H	1
 #define HAVE_SIGNAL_H	1
+#define HAVE_UNISTD_H	1
 
 /* C library functions */
 #define HAVE_MALLOC	1
@@ -97,6 +98,11 @@ typedef unsigned long uintptr_t;
 #define HAVE_SIGACTION	1
 #define HAVE_SETJMP	1
 #define HAVE_NANOSLEEP	1
+#define HAVE_SYSCONF	1
+#define HAVE_SYSCTLBYNAME	1
+#define HAVE_MMAP	1
+#define HAVE_MADVISE	1
+#define HAVE_FSEEKO	1
 
 /* enable iPhone version of Core Audio driver */
 #define SDL_AUDIO_DRIVER_COREAUDIOIPHONE 1
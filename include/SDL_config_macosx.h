@@ -46,6 +46,7 @@
 #define HAVE_CTYPE_H	1
 #define HAVE_MATH_H	1
 #define HAVE_SIGNAL_H	1
+#define HAVE_UNISTD_H	1
 
 /* C library functions */
 #define HAVE_MALLOC	1
@@ -99,6 +100,11 @@
 #define HAVE_SIGACTION	1
 #define HAVE_SETJMP	1
 #define HAVE_NANOSLEEP	1
+#define HAVE_SYSCONF	1
+#define HAVE_SYSCTLBYNAME	1
+#define HAVE_MMAP	1
+#define HAVE_MADVISE	1
+#define HAVE_FSEEKO	1
 
 /* Enable various audio drivers */
 #define SDL_AUDIO_DRIVER_COREAUDIO	1
@@ -53,6 +53,7 @@
 #define HAVE_MATH_H 1
 #define HAVE_ICONV_H 1
 #define HAVE_SIGNAL_H 1
+#define HAVE_UNISTD_H 1
 #define HAVE_MALLOC 1
 #define HAVE_CALLOC 1
 #define HAVE_REALLOC 1
@@ -100,6 +101,14 @@
 #define HAVE_SIGACTION 1
 #define HAVE_SETJMP 1
 #define HAVE_NANOSLEEP 1
+#define HAVE_SYSCONF 1
+#define HAVE_MMAP 1
+#define HAVE_MADVISE 1
+#define HAVE_FOPEN64 1
+#define HAVE_FSEEKO 1
+#define HAVE_FSEEKO64 1
+#define HAVE_LSEEK64 1
+#define HAVE_FSTAT64 1
 
 #define SDL_CDROM_DISABLED 1
 #define SDL_AUDIO_DRIVER_DUMMY 1
@@ -39,6 +39,10 @@ extern "C" {
 /* *INDENT-ON* */
 #endif
 
+/* This function returns the number of CPUs (or cores) that are online
+ */
+extern DECLSPEC int SDLCALL SDL_GetCPUCount(void);
+
 /* This function returns true if the CPU has the RDTSC instruction
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_HasRDTSC(void);
@@ -71,6 +75,11 @@ extern DECLSPEC SDL_bool SDLCALL SDL_HasSSE2(void);
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_HasAltiVec(void);
 
+/* This function returns true if the CPU has AVX2 features and the
+   operating system saves the AVX register state
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_HasAVX2(void);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 /* *INDENT-OFF* */
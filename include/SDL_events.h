@@ -396,6 +396,16 @@ extern DECLSPEC int SDLCALL SDL_PeepEvents(SDL_Event * events, int numevents,
                                            SDL_eventaction action,
                                            Uint32 mask);
 
+/* Reports how many events are waiting in the event queue, the most that
+   have been waiting at once, and how many were dropped because the queue
+   was full, since the event loop was started.  Any of the pointers may be
+   NULL.  The queue holds 4096 events, or the number (at least 512) given
+   in the SDL_EVENT_QUEUE_SIZE environment variable when video is
+   initialized.
+ */
+extern DECLSPEC void SDLCALL SDL_GetEventQueueStats(int *queued, int *peak,
+                                                    int *dropped);
+
 /* Checks to see if certain event types are in the event queue.
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_HasEvent(Uint32 mask);
@@ -0,0 +1,107 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+
+/**
+ * \file SDL_profile.h
+ *
+ * Counters that show where time goes inside SDL
+ *
+ * When SDL is configured with --enable-profiling, it counts the calls,
+ * the pixels or bytes handled and the time spent in software blits (one
+ * counter for each blit function in use), the SDL_Render* functions,
+ * each audio conversion filter and the audio callback, and samples the
+ * event queue depth.  Without it these functions return -1 or do nothing,
+ * and the counting costs nothing.
+ *
+ * Set the environment variable SDL_PROFILE_DUMP to a number of
+ * milliseconds to have the counters printed to stderr that often.
+ */
+
+#ifndef _SDL_profile_h
+#define _SDL_profile_h
+
+#include "SDL_stdinc.h"
+#include "SDL_error.h"
+
+#include "begin_code.h"
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+/* *INDENT-OFF* */
+extern "C" {
+/* *INDENT-ON* */
+#endif
+
+/**
+ * \struct SDL_ProfileCounter
+ *
+ * \brief What was recorded for one part of SDL
+ */
+typedef struct SDL_ProfileCounter
+{
+    const char *name;           /**< What was counted, e.g. "SDL_RenderCopy" */
+    Uint32 calls;               /**< How many times it was recorded */
+    Uint64 units;               /**< Pixels, bytes or events in total */
+    Uint64 max_units;           /**< The most units in one call */
+    Uint64 ns;                  /**< Nanoseconds spent in total */
+    Uint64 max_ns;              /**< Nanoseconds spent in the longest call */
+    Uint64 budget_ns;           /**< Time the calls were allowed, if limited */
+    Uint32 overruns;            /**< How many calls took longer than allowed */
+} SDL_ProfileCounter;
+
+/**
+ * \fn int SDL_GetProfileCounters(SDL_ProfileCounter *counters, int maxcounters)
+ *
+ * \brief Copy the current counters.
+ *
+ * \param counters Where to copy up to 'maxcounters' counters, may be NULL
+ *
+ * \return The number of counters there are, or -1 if SDL was built
+ *         without profiling.
+ */
+extern DECLSPEC int SDLCALL SDL_GetProfileCounters(SDL_ProfileCounter *
+                                                   counters, int maxcounters);
+
+/**
+ * \fn void SDL_ResetProfileCounters(void)
+ *
+ * \brief Set all the counters back to zero.
+ */
+extern DECLSPEC void SDLCALL SDL_ResetProfileCounters(void);
+
+/**
+ * \fn void SDL_DumpProfileCounters(void)
+ *
+ * \brief Print the counters that have been used to stderr.
+ */
+extern DECLSPEC void SDLCALL SDL_DumpProfileCounters(void);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+/* *INDENT-OFF* */
+}
+/* *INDENT-ON* */
+#endif
+#include "close_code.h"
+
+#endif /* _SDL_profile_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -42,6 +42,19 @@ extern "C" {
 /* *INDENT-ON* */
 #endif
 
+/**
+ * \struct SDL_Point
+ *
+ * \brief The structure that defines a point
+ *
+ * \sa SDL_EnclosePoints
+ */
+typedef struct SDL_Point
+{
+    int x;
+    int y;
+} SDL_Point;
+
 /**
  * \struct SDL_Rect
  *
@@ -104,6 +117,20 @@ extern DECLSPEC void SDLCALL SDL_UnionRect(const SDL_Rect * A,
                                            const SDL_Rect * B,
                                            SDL_Rect * result);
 
+/**
+ * \fn SDL_bool SDL_EnclosePoints(const SDL_Point * points, int count, const SDL_Rect * clip, SDL_Rect * result)
+ *
+ * \brief Calculate a minimal rectangle enclosing a set of points
+ *
+ * \param clip An optional rectangle; points outside it are ignored
+ *
+ * \return SDL_TRUE if any points were within the clipping rect
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_EnclosePoints(const SDL_Point * points,
+                                                   int count,
+                                                   const SDL_Rect * clip,
+                                                   SDL_Rect * result);
+
 /**
  * \fn SDL_bool SDL_IntersectRectAndLine(const SDL_Rect *rect, int *X1, int *Y1, int *X2, int *Y2)
  *
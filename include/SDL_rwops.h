@@ -45,12 +45,18 @@ extern "C" {
 
 typedef struct SDL_RWops
 {
+    /* Return the size of the data source, or -1 if it isn't known.
+       SDL_AllocRW() sets this to a function that finds the size by
+       seeking to the end and back, for data sources that can't tell.
+     */
+    Sint64 (SDLCALL * size) (struct SDL_RWops * context);
+
     /* Seek to 'offset' relative to whence, one of stdio's whence values:
        RW_SEEK_SET, RW_SEEK_CUR, RW_SEEK_END
-       Returns the final offset in the data source.
+       Returns the final offset in the data source, or -1 on error.
      */
-    long (SDLCALL * seek) (struct SDL_RWops * context, long offset,
-                           int whence);
+    Sint64 (SDLCALL * seek) (struct SDL_RWops * context, Sint64 offset,
+                             int whence);
 
     /* Read up to 'num' objects each of size 'objsize' from the data
        source to the area pointed at by 'ptr'.
@@ -94,12 +100,29 @@ typedef struct SDL_RWops
             FILE *fp;
         } stdio;
 #endif
+        struct
+        {
+            SDL_bool autoclose;
+            int fd;
+        } fd;
         struct
         {
             Uint8 *base;
             Uint8 *here;
             Uint8 *stop;
         } mem;
+        /* This starts like 'mem', with the data read ahead from the
+           source between 'here' and 'stop' */
+        struct
+        {
+            Uint8 *base;
+            Uint8 *here;
+            Uint8 *stop;
+            struct SDL_RWops *source;
+            SDL_bool autoclose;
+            Sint64 offset;
+            size_t size;
+        } buffered;
         struct
         {
             void *data1;
@@ -119,10 +142,48 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromFP(FILE * fp,
                                                 SDL_bool autoclose);
 #endif
 
+/* Read and write a POSIX file descriptor, closing it when the SDL_RWops
+   is closed if 'autoclose' is set.  This isn't buffered; wrap it with
+   SDL_RWFromBufferedRW() for lots of small reads.  It returns NULL on
+   platforms without file descriptors.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromFD(int fd, SDL_bool autoclose);
+
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/* Open a file for reading by mapping it into memory, so reading from it
+   is a copy from the mapping and seeking just moves a pointer.  Files
+   that can't be mapped, such as pipes, are opened with SDL_RWFromFile()
+   instead.  The file shouldn't be changed while it's open.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMappedFile(const char *file);
+
+/* Get the memory behind an SDL_RWops created by SDL_RWFromMem(),
+   SDL_RWFromConstMem() or SDL_RWFromMappedFile(), so that it can be
+   parsed where it is instead of being read into another buffer.  The
+   size of the data is placed in the area pointed to by 'size', if
+   'size' is not NULL.  This returns NULL for other data sources.
+   The memory belongs to the SDL_RWops, and goes away when it's closed.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWGetMemory(SDL_RWops * context,
+                                                    size_t * size);
+
+/* Read another SDL_RWops through a buffer.  Each time the buffer runs out,
+   up to 'size' bytes (or a default size if 'size' is 0) are read ahead
+   from 'source', so small reads and seeks within what was read ahead
+   don't have to go through 'source' at all.  Reads at least as big as
+   the buffer go straight to 'source', and writes go straight to it too.
+
+   Closing the buffered SDL_RWops closes 'source' if 'autoclose' is set.
+   Otherwise 'source' is seeked back to where the buffered reads got to,
+   if it can seek, and can be used again.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromBufferedRW(SDL_RWops * source,
+                                                       size_t size,
+                                                       SDL_bool autoclose);
+
 extern DECLSPEC SDL_RWops *SDLCALL SDL_AllocRW(void);
 extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 
@@ -131,6 +192,7 @@ extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 #define RW_SEEK_END	2       /* Seek relative to the end of data */
 
 /* Macros to easily read and write from an SDL_RWops structure */
+#define SDL_RWsize(ctx)			(ctx)->size(ctx)
 #define SDL_RWseek(ctx, offset, whence)	(ctx)->seek(ctx, offset, whence)
 #define SDL_RWtell(ctx)			(ctx)->seek(ctx, 0, RW_SEEK_CUR)
 #define SDL_RWread(ctx, ptr, size, n)	(ctx)->read(ctx, ptr, size, n)
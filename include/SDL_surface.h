@@ -318,7 +318,7 @@ extern DECLSPEC int SDLCALL SDL_GetSurfaceBlendMode(SDL_Surface * surface,
  *
  * \return 0 on success, or -1 if the surface is not valid or the scale mode is not supported
  *
- * \note If the scale mode is not supported, the closest supported mode is chosen.  Currently only SDL_TEXTURESCALEMODE_FAST is supported on surfaces.
+ * \note If the scale mode is not supported, the closest supported mode is chosen.  Currently SDL_TEXTURESCALEMODE_FAST and SDL_TEXTURESCALEMODE_SLOW are supported on surfaces.  SDL_TEXTURESCALEMODE_SLOW uses bilinear filtering for 32-bit source surfaces with 8-bit channels, and point sampling otherwise.
  *
  * \sa SDL_GetSurfaceScaleMode()
  */
@@ -387,6 +387,14 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_ConvertSurface
 extern DECLSPEC int SDLCALL SDL_DrawPoint
     (SDL_Surface * dst, int x, int y, Uint32 color);
 
+/*
+ * This function draws 'count' points with 'color', clipping each one
+ * to the destination surface clip area.
+ * This function returns 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_DrawPoints
+    (SDL_Surface * dst, const SDL_Point * points, int count, Uint32 color);
+
 /*
  * This function blends a point with an RGBA value
  * The color should be a pixel of the format used by the surface, and 
@@ -397,6 +405,15 @@ extern DECLSPEC int SDLCALL SDL_BlendPoint
     (SDL_Surface * dst, int x, int y, int blendMode,
      Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
+/*
+ * This function blends 'count' points with an RGBA value, clipping each
+ * one to the destination surface clip area.
+ * This function returns 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_BlendPoints
+    (SDL_Surface * dst, const SDL_Point * points, int count, int blendMode,
+     Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
 /*
  * This function draws a line with 'color'
  * The color should be a pixel of the format used by the surface, and 
@@ -533,6 +550,18 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             SDL_Surface * dst,
                                             const SDL_Rect * dstrect);
 
+/**
+ * \fn int SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst, const SDL_Rect * dstrect)
+ *
+ * \brief Perform a bilinear filtered stretch blit between two 32-bit surfaces of the same pixel format.
+ *
+ * \note The pixel format must have 8-bit channels.  Unlike SDL_SoftStretch(), this function is thread-safe.
+ */
+extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
+                                                  const SDL_Rect * srcrect,
+                                                  SDL_Surface * dst,
+                                                  const SDL_Rect * dstrect);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 /* *INDENT-OFF* */
@@ -0,0 +1,187 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+
+/**
+ * \file SDL_threadpool.h
+ *
+ * A pool of persistent worker threads for running short tasks
+ *
+ * Tasks are submitted into a task group, and SDL_WaitTaskGroup() waits
+ * until every task in the group has run.  Each worker keeps its own queue
+ * of tasks and takes work from the others when it runs out, and a thread
+ * waiting for a group runs queued tasks itself instead of sleeping.  This
+ * means tasks may submit and wait for more tasks without deadlocking.
+ *
+ * SDL keeps a shared pool, sized from the number of CPUs, which it uses
+ * for its own work and which applications are welcome to use too: pass
+ * NULL wherever a pool is asked for.  Set the environment variable
+ * SDL_THREAD_POOL_SIZE to change the number of threads it uses, counting
+ * the calling thread; 1 runs every task on the thread that waits for it.
+ */
+
+#ifndef _SDL_threadpool_h
+#define _SDL_threadpool_h
+
+#include "SDL_stdinc.h"
+#include "SDL_error.h"
+
+#include "begin_code.h"
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+/* *INDENT-OFF* */
+extern "C" {
+/* *INDENT-ON* */
+#endif
+
+/* The thread pool and task group structures, defined in SDL_threadpool.c */
+struct SDL_ThreadPool;
+typedef struct SDL_ThreadPool SDL_ThreadPool;
+
+struct SDL_TaskGroup;
+typedef struct SDL_TaskGroup SDL_TaskGroup;
+
+/**
+ * \typedef SDL_TaskFunction
+ *
+ * \brief A task submitted with SDL_SubmitTask()
+ */
+typedef void (SDLCALL * SDL_TaskFunction) (void *data);
+
+/**
+ * \typedef SDL_ParallelForFunction
+ *
+ * \brief Called by SDL_ParallelFor() for the items from 'start' up to,
+ *        but not including, 'end'.
+ */
+typedef void (SDLCALL * SDL_ParallelForFunction) (void *data, int start,
+                                                  int end);
+
+/**
+ * \fn SDL_ThreadPool *SDL_CreateThreadPool(int num_threads)
+ *
+ * \brief Create a pool of worker threads.
+ *
+ * \param num_threads The number of worker threads to start, or 0 for one
+ *        less than the number of CPUs, since the thread waiting for the
+ *        tasks runs them too.
+ *
+ * \return The pool, or NULL if there was an error.
+ */
+extern DECLSPEC SDL_ThreadPool *SDLCALL SDL_CreateThreadPool(int
+                                                             num_threads);
+
+/**
+ * \fn SDL_ThreadPool *SDL_GetSharedThreadPool(void)
+ *
+ * \brief Get the pool SDL uses itself, creating it the first time.
+ *
+ * The shared pool is destroyed by SDL_Quit().  The first call should be
+ * made before any other threads use the pool.
+ */
+extern DECLSPEC SDL_ThreadPool *SDLCALL SDL_GetSharedThreadPool(void);
+
+/**
+ * \fn int SDL_GetThreadPoolSize(SDL_ThreadPool *pool)
+ *
+ * \brief Get the number of worker threads in a pool.
+ */
+extern DECLSPEC int SDLCALL SDL_GetThreadPoolSize(SDL_ThreadPool * pool);
+
+/**
+ * \fn void SDL_DestroyThreadPool(SDL_ThreadPool *pool)
+ *
+ * \brief Stop the worker threads, after running any tasks still queued,
+ *        and free the pool.
+ *
+ * \note Destroy the task groups that use the pool first.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyThreadPool(SDL_ThreadPool * pool);
+
+/**
+ * \fn SDL_TaskGroup *SDL_CreateTaskGroup(SDL_ThreadPool *pool)
+ *
+ * \brief Create a group for tasks to run on a pool, or on the shared pool
+ *        if 'pool' is NULL.
+ */
+extern DECLSPEC SDL_TaskGroup *SDLCALL SDL_CreateTaskGroup(SDL_ThreadPool *
+                                                          pool);
+
+/**
+ * \fn int SDL_SubmitTask(SDL_TaskGroup *group, SDL_TaskFunction task, void *data)
+ *
+ * \brief Queue a task to be run by one of the pool's threads.
+ *
+ * If the pool has no worker threads, the task is run before this returns.
+ *
+ * \return 0 on success, or -1 if the task couldn't be queued.
+ */
+extern DECLSPEC int SDLCALL SDL_SubmitTask(SDL_TaskGroup * group,
+                                           SDL_TaskFunction task,
+                                           void *data);
+
+/**
+ * \fn void SDL_WaitTaskGroup(SDL_TaskGroup *group)
+ *
+ * \brief Wait until every task submitted to the group has finished,
+ *        running queued tasks while waiting.
+ *
+ * The group can be used again afterwards.
+ */
+extern DECLSPEC void SDLCALL SDL_WaitTaskGroup(SDL_TaskGroup * group);
+
+/**
+ * \fn void SDL_DestroyTaskGroup(SDL_TaskGroup *group)
+ *
+ * \brief Wait for the group's tasks and free the group.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyTaskGroup(SDL_TaskGroup * group);
+
+/**
+ * \fn int SDL_ParallelFor(SDL_ThreadPool *pool, int start, int end, int grain, SDL_ParallelForFunction func, void *data)
+ *
+ * \brief Call 'func' for the range from 'start' up to 'end', split into
+ *        pieces that run in parallel, and wait for them all to finish.
+ *
+ * \param pool The pool to use, or NULL for the shared pool
+ * \param grain The fewest items to give each call, since very small
+ *        pieces cost more to hand out than running them saves
+ *
+ * \return 0 on success, or -1 if there was an error, in which case any
+ *         pieces that couldn't be queued have been run on the calling
+ *         thread.
+ */
+extern DECLSPEC int SDLCALL SDL_ParallelFor(SDL_ThreadPool * pool,
+                                            int start, int end, int grain,
+                                            SDL_ParallelForFunction func,
+                                            void *data);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+/* *INDENT-OFF* */
+}
+/* *INDENT-ON* */
+#endif
+#include "close_code.h"
+
+#endif /* _SDL_threadpool_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
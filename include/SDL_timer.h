@@ -54,6 +54,28 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetTicks(void);
 /* Wait a specified number of milliseconds before returning */
 extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
 
+/* Get the current value of the high resolution counter, which starts at 0
+ * when SDL is initialized and counts SDL_GetPerformanceFrequency() units
+ * per second.  Use it to time things too short for SDL_GetTicks().
+ *
+ * On UNIX the counter is in nanoseconds if SDL was configured with
+ * --enable-clock_gettime, and in microseconds otherwise.  Setting the
+ * environment variable SDL_TIMER_RDTSC=1 counts CPU cycles instead, which
+ * is cheaper to read, on x86 processors whose cycle counter runs at a
+ * constant rate.  Platforms without a better clock count milliseconds.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceCounter(void);
+
+/* Get the number of SDL_GetPerformanceCounter() units per second */
+extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceFrequency(void);
+
+/* Wait a specified number of nanoseconds before returning, more precisely
+ * than SDL_Delay() can.  This sleeps for most of the time and then spins
+ * for the last fraction of a millisecond, so it is meant for pacing frames
+ * rather than for long waits.
+ */
+extern DECLSPEC void SDLCALL SDL_DelayPrecise(Uint64 ns);
+
 /* Function prototype for the timer callback function */
 typedef Uint32(SDLCALL * SDL_TimerCallback) (Uint32 interval);
 
@@ -69,12 +91,12 @@ typedef Uint32(SDLCALL * SDL_TimerCallback) (Uint32 interval);
  * The timer callback function may run in a different thread than your
  * main code, and so shouldn't call any functions from within itself.
  *
- * The maximum resolution of this timer is 10 ms, which means that if
- * you request a 16 ms timer, your callback will run approximately 20 ms
- * later on an unloaded system.  If you wanted to set a flag signaling
- * a frame update at 30 frames per second (every 33 ms), you might set a 
- * timer for 30 ms:
- *   SDL_SetTimer((33/10)*10, flag_update);
+ * Where timers run in their own thread (currently on UNIX), the thread
+ * sleeps until the next timer is due, and callbacks run within about a
+ * millisecond of it, keeping to the original schedule rather than
+ * drifting.  On other platforms the resolution may be as coarse as
+ * TIMER_RESOLUTION, so if you request a 16 ms timer, your callback may
+ * run approximately 20 ms later on an unloaded system.
  *
  * If you use this function, you need to pass SDL_INIT_TIMER to SDL_Init().
  *
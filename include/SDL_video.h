@@ -1253,6 +1253,67 @@ extern DECLSPEC int SDLCALL SDL_RenderCopy(SDL_TextureID textureID,
                                            const SDL_Rect * srcrect,
                                            const SDL_Rect * dstrect);
 
+/**
+ * \fn int SDL_RenderPoints(const SDL_Point * points, int count)
+ *
+ * \brief Draw multiple points on the current rendering target.
+ *
+ * \param points The points to draw
+ * \param count The number of points to draw
+ *
+ * \return 0 on success, or -1 if there is no rendering context current
+ *
+ * \note This is equivalent to calling SDL_RenderPoint() for each point,
+ *       but lets the renderer process the whole set in one pass.
+ */
+extern DECLSPEC int SDLCALL SDL_RenderPoints(const SDL_Point * points,
+                                             int count);
+
+/**
+ * \fn int SDL_RenderLines(const SDL_Point * points, int count)
+ *
+ * \brief Draw multiple line segments on the current rendering target.
+ *
+ * \param points The end points of the segments, two for each segment
+ * \param count The number of line segments to draw
+ *
+ * \return 0 on success, or -1 if there is no rendering context current
+ *
+ * \note Segment i is drawn from points[2*i] to points[2*i+1].
+ */
+extern DECLSPEC int SDLCALL SDL_RenderLines(const SDL_Point * points,
+                                            int count);
+
+/**
+ * \fn int SDL_RenderFills(const SDL_Rect * rects, int count)
+ *
+ * \brief Fill multiple rectangles on the current rendering target with the drawing color.
+ *
+ * \param rects The rectangles to fill
+ * \param count The number of rectangles to fill
+ *
+ * \return 0 on success, or -1 if there is no rendering context current
+ */
+extern DECLSPEC int SDLCALL SDL_RenderFills(const SDL_Rect * rects,
+                                            int count);
+
+/**
+ * \fn int SDL_RenderCopies(SDL_TextureID textureID, const SDL_Rect * srcrects, const SDL_Rect * dstrects, int count)
+ *
+ * \brief Copy multiple portions of a texture to the current rendering target.
+ *
+ * \param texture The source texture.
+ * \param srcrects An array of source rectangles, or NULL to use the entire texture for each copy.
+ * \param dstrects An array of destination rectangles.
+ * \param count The number of copies to perform.
+ *
+ * \return 0 on success, or -1 if there is no rendering context current, or the driver doesn't support the requested operation.
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopies(SDL_TextureID textureID,
+                                             const SDL_Rect * srcrects,
+                                             const SDL_Rect * dstrects,
+                                             int count);
+
 /**
  * \fn int SDL_RenderReadPixels(const SDL_Rect *rect, void *pixels, int pitch)
  *
@@ -25,6 +25,7 @@
 
 #include "SDL.h"
 #include "SDL_fatal.h"
+#include "SDL_profile_c.h"
 #if !SDL_VIDEO_DISABLED
 #include "video/SDL_leaks.h"
 #endif
@@ -51,6 +52,8 @@ extern void SDL_StartTicks(void);
 extern int SDL_TimerInit(void);
 extern void SDL_TimerQuit(void);
 #endif
+extern void SDL_AsyncLoadQuit(void);
+extern void SDL_ThreadPoolQuit(void);
 #if defined(__WIN32__)
 extern int SDL_HelperWindowCreate(void);
 extern int SDL_HelperWindowDestroy(void);
@@ -182,6 +185,9 @@ SDL_Init(Uint32 flags)
     }
 #endif
 
+    /* Start counting, if SDL was built with profiling */
+    SDL_ProfileInit();
+
     /* Initialize the desired subsystems */
     if (SDL_InitSubSystem(flags) < 0) {
         return (-1);
@@ -257,7 +263,10 @@ SDL_Quit(void)
 #if defined(__WIN32__)
     SDL_HelperWindowDestroy();
 #endif
+    SDL_AsyncLoadQuit();
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
+    SDL_ThreadPoolQuit();
+    SDL_ProfileQuit();
 
 #ifdef CHECK_LEAKS
 #ifdef DEBUG_BUILD
@@ -0,0 +1,76 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Internal atomic operations on 32-bit values, for code that shares data
+   between threads without a lock.
+
+   SDL_ATOMIC_LOCKFREE is 1 if the compiler has them, and then:
+     SDL_AtomicCAS(p, old, new)  sets *p to new if it's old, returns true
+                                 if it did
+     SDL_AtomicAdd(p, v)         adds v to *p, returns the old value
+     SDL_MemoryBarrier()         a full fence, for the compiler and the CPU:
+                                 no load or store moves across it
+   All three order memory like SDL_MemoryBarrier().
+
+   Otherwise SDL_ATOMIC_LOCKFREE is 0 and none of them exist, so code
+   without them has to use a lock instead.
+ */
+
+#ifndef _SDL_atomic_c_h
+#define _SDL_atomic_c_h
+
+#if defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))
+
+#define SDL_ATOMIC_LOCKFREE	1
+#define SDL_AtomicCAS(p, old, new)	__sync_bool_compare_and_swap(p, old, new)
+#define SDL_AtomicAdd(p, v)	__sync_fetch_and_add(p, v)
+#define SDL_MemoryBarrier()	__sync_synchronize()
+
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400) && (defined(_M_IX86) || defined(_M_X64))
+
+#include <intrin.h>
+#pragma intrinsic(_InterlockedCompareExchange, _InterlockedExchangeAdd, _InterlockedExchange)
+
+#define SDL_ATOMIC_LOCKFREE	1
+#define SDL_AtomicCAS(p, old, new) \
+    (_InterlockedCompareExchange((volatile long *) (p), (long) (new), \
+                                 (long) (old)) == (long) (old))
+#define SDL_AtomicAdd(p, v) \
+    ((Uint32) _InterlockedExchangeAdd((volatile long *) (p), (long) (v)))
+/* _ReadWriteBarrier() only stops the compiler, an x86 CPU can still move
+   a load ahead of an earlier store.  A locked instruction stops both,
+   which is what MemoryBarrier() in winnt.h does. */
+#define SDL_MemoryBarrier() \
+    do { \
+        volatile long _fence; \
+        _InterlockedExchange(&_fence, 0); \
+    } while (0)
+
+#else
+
+#define SDL_ATOMIC_LOCKFREE	0
+
+#endif
+
+#endif /* _SDL_atomic_c_h */
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,290 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Profiling counters for the hot paths of SDL */
+
+#include "SDL_mutex.h"
+#include "SDL_thread.h"
+#include "SDL_profile_c.h"
+
+#if SDL_PROFILING
+
+#include <stdio.h>
+
+/* The counters live in a fixed table and are never freed, so the places
+   that keep a pointer to one don't have to worry about it going away.
+ */
+#define MAX_PROFILE_SLOTS	256
+#define MAX_PROFILE_NAME	64
+
+struct SDL_ProfileSlot
+{
+    const void *key;
+    char name[MAX_PROFILE_NAME];
+    Uint32 calls;
+    Uint64 units;
+    Uint64 max_units;
+    Uint64 ticks;               /* In performance counter units */
+    Uint64 max_ticks;
+    Uint64 budget_ns;
+    Uint32 overruns;
+};
+
+static SDL_ProfileSlot SDL_profile_slots[MAX_PROFILE_SLOTS];
+static int SDL_profile_count = 0;
+static SDL_mutex *SDL_profile_lock = NULL;
+static Uint64 SDL_profile_frequency = 0;
+
+/* Prints the counters every SDL_PROFILE_DUMP milliseconds */
+static SDL_Thread *SDL_profile_thread = NULL;
+static SDL_cond *SDL_profile_cond = NULL;
+static SDL_bool SDL_profile_quit = SDL_FALSE;
+static Uint32 SDL_profile_interval = 0;
+
+/* Counting can start before SDL_Init() creates the lock */
+#define LOCK_PROFILE() \
+    if (SDL_profile_lock) SDL_mutexP(SDL_profile_lock)
+#define UNLOCK_PROFILE() \
+    if (SDL_profile_lock) SDL_mutexV(SDL_profile_lock)
+
+static Uint64
+SDL_ProfileToNS(Uint64 ticks)
+{
+    if (!SDL_profile_frequency) {
+        SDL_profile_frequency = SDL_GetPerformanceFrequency();
+    }
+    return ((ticks / SDL_profile_frequency) * 1000000000 +
+            (ticks % SDL_profile_frequency) * 1000000000 /
+            SDL_profile_frequency);
+}
+
+static int SDLCALL
+SDL_ProfileDumpThread(void *unused)
+{
+    SDL_mutexP(SDL_profile_lock);
+    while (!SDL_profile_quit) {
+        SDL_CondWaitTimeout(SDL_profile_cond, SDL_profile_lock,
+                            SDL_profile_interval);
+        if (!SDL_profile_quit) {
+            SDL_mutexV(SDL_profile_lock);
+            SDL_DumpProfileCounters();
+            SDL_mutexP(SDL_profile_lock);
+        }
+    }
+    SDL_mutexV(SDL_profile_lock);
+    return 0;
+}
+
+void
+SDL_ProfileInit(void)
+{
+    const char *dump;
+
+    if (SDL_profile_lock) {
+        return;
+    }
+    SDL_profile_lock = SDL_CreateMutex();
+    SDL_profile_frequency = SDL_GetPerformanceFrequency();
+
+    dump = SDL_getenv("SDL_PROFILE_DUMP");
+    if (dump && SDL_atoi(dump) > 0 && SDL_profile_lock) {
+        SDL_profile_interval = SDL_atoi(dump);
+        SDL_profile_quit = SDL_FALSE;
+        SDL_profile_cond = SDL_CreateCond();
+        if (SDL_profile_cond) {
+            SDL_profile_thread =
+                SDL_CreateThread(SDL_ProfileDumpThread, NULL);
+        }
+    }
+}
+
+void
+SDL_ProfileQuit(void)
+{
+    if (SDL_profile_thread) {
+        SDL_mutexP(SDL_profile_lock);
+        SDL_profile_quit = SDL_TRUE;
+        SDL_CondSignal(SDL_profile_cond);
+        SDL_mutexV(SDL_profile_lock);
+        SDL_WaitThread(SDL_profile_thread, NULL);
+        SDL_profile_thread = NULL;
+
+        /* One last look at the whole run */
+        SDL_DumpProfileCounters();
+    }
+    if (SDL_profile_cond) {
+        SDL_DestroyCond(SDL_profile_cond);
+        SDL_profile_cond = NULL;
+    }
+    if (SDL_profile_lock) {
+        SDL_DestroyMutex(SDL_profile_lock);
+        SDL_profile_lock = NULL;
+    }
+}
+
+SDL_ProfileSlot *
+SDL_ProfileFind(const void *key, const char *name)
+{
+    SDL_ProfileSlot *slot = NULL;
+    int i;
+
+    LOCK_PROFILE();
+    for (i = 0; i < SDL_profile_count; ++i) {
+        if (key ? (SDL_profile_slots[i].key == key) :
+            (!SDL_profile_slots[i].key && name &&
+             SDL_strcmp(SDL_profile_slots[i].name, name) == 0)) {
+            slot = &SDL_profile_slots[i];
+            break;
+        }
+    }
+    if (!slot && name && SDL_profile_count < MAX_PROFILE_SLOTS) {
+        slot = &SDL_profile_slots[SDL_profile_count++];
+        slot->key = key;
+        SDL_strlcpy(slot->name, name, sizeof(slot->name));
+    }
+    UNLOCK_PROFILE();
+    return slot;
+}
+
+void
+SDL_ProfileRecord(SDL_ProfileSlot * slot, Uint64 start, Uint64 units,
+                  Uint64 budget_ns)
+{
+    Uint64 ticks;
+
+    if (!slot) {
+        return;
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+
+    LOCK_PROFILE();
+    ++slot->calls;
+    slot->units += units;
+    if (units > slot->max_units) {
+        slot->max_units = units;
+    }
+    slot->ticks += ticks;
+    if (ticks > slot->max_ticks) {
+        slot->max_ticks = ticks;
+    }
+    if (budget_ns) {
+        slot->budget_ns += budget_ns;
+        if (SDL_ProfileToNS(ticks) > budget_ns) {
+            ++slot->overruns;
+        }
+    }
+    UNLOCK_PROFILE();
+}
+
+int
+SDL_GetProfileCounters(SDL_ProfileCounter * counters, int maxcounters)
+{
+    int i, count;
+
+    LOCK_PROFILE();
+    count = SDL_profile_count;
+    for (i = 0; counters && i < count && i < maxcounters; ++i) {
+        const SDL_ProfileSlot *slot = &SDL_profile_slots[i];
+        SDL_ProfileCounter *counter = &counters[i];
+
+        counter->name = slot->name;
+        counter->calls = slot->calls;
+        counter->units = slot->units;
+        counter->max_units = slot->max_units;
+        counter->ns = SDL_ProfileToNS(slot->ticks);
+        counter->max_ns = SDL_ProfileToNS(slot->max_ticks);
+        counter->budget_ns = slot->budget_ns;
+        counter->overruns = slot->overruns;
+    }
+    UNLOCK_PROFILE();
+    return count;
+}
+
+void
+SDL_ResetProfileCounters(void)
+{
+    int i;
+
+    LOCK_PROFILE();
+    for (i = 0; i < SDL_profile_count; ++i) {
+        SDL_ProfileSlot *slot = &SDL_profile_slots[i];
+        slot->calls = 0;
+        slot->units = slot->max_units = 0;
+        slot->ticks = slot->max_ticks = 0;
+        slot->budget_ns = 0;
+        slot->overruns = 0;
+    }
+    UNLOCK_PROFILE();
+}
+
+void
+SDL_DumpProfileCounters(void)
+{
+    SDL_ProfileCounter counters[MAX_PROFILE_SLOTS];
+    int i, count;
+
+    count = SDL_GetProfileCounters(counters, SDL_arraysize(counters));
+    fprintf(stderr, "%-40s %9s %11s %10s %10s %12s\n", "SDL profile",
+            "calls", "total ms", "avg us", "max us", "avg units");
+    for (i = 0; i < count; ++i) {
+        const SDL_ProfileCounter *counter = &counters[i];
+
+        if (!counter->calls) {
+            continue;
+        }
+        fprintf(stderr, "%-40s %9u %11.3f %10.3f %10.3f %12.1f",
+                counter->name, counter->calls, counter->ns / 1000000.0,
+                counter->ns / 1000.0 / counter->calls,
+                counter->max_ns / 1000.0,
+                (double) counter->units / counter->calls);
+        if (counter->budget_ns) {
+            fprintf(stderr, "  %.1f%% of budget, %u overruns",
+                    counter->ns * 100.0 / counter->budget_ns,
+                    counter->overruns);
+        }
+        fprintf(stderr, "\n");
+    }
+}
+
+#else
+
+int
+SDL_GetProfileCounters(SDL_ProfileCounter * counters, int maxcounters)
+{
+    SDL_Unsupported();
+    return -1;
+}
+
+void
+SDL_ResetProfileCounters(void)
+{
+}
+
+void
+SDL_DumpProfileCounters(void)
+{
+}
+
+#endif /* SDL_PROFILING */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,73 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Internal interface to the profiling counters in SDL_profile.h */
+
+#ifndef _SDL_profile_c_h
+#define _SDL_profile_c_h
+
+#include "SDL_profile.h"
+#include "SDL_timer.h"
+
+#if SDL_PROFILING
+
+typedef struct SDL_ProfileSlot SDL_ProfileSlot;
+
+extern void SDL_ProfileInit(void);
+extern void SDL_ProfileQuit(void);
+
+/* Find the counter for 'key', or make one called 'name'.  Counters made
+   for a name alone are found by the name.  Returns NULL if there's no
+   such counter and 'name' is NULL, or there's no room for another one.
+ */
+extern SDL_ProfileSlot *SDL_ProfileFind(const void *key, const char *name);
+
+/* Add a call that started at performance counter 'start' to a counter.
+   If 'budget_ns' isn't 0, the call was meant to take no longer than that.
+ */
+extern void SDL_ProfileRecord(SDL_ProfileSlot * slot, Uint64 start,
+                              Uint64 units, Uint64 budget_ns);
+
+/* Time from here to SDL_PROFILE_END() under a fixed name.  This declares
+   variables, so it has to come last among the declarations.
+ */
+#define SDL_PROFILE_BEGIN(name) \
+    static SDL_ProfileSlot *SDL_profile_slot = NULL; \
+    const Uint64 SDL_profile_start = \
+        ((void) (SDL_profile_slot || \
+                 (SDL_profile_slot = SDL_ProfileFind(NULL, name))), \
+         SDL_GetPerformanceCounter())
+#define SDL_PROFILE_END(units) \
+    SDL_ProfileRecord(SDL_profile_slot, SDL_profile_start, (units), 0)
+
+#else
+
+#define SDL_ProfileInit()
+#define SDL_ProfileQuit()
+#define SDL_PROFILE_BEGIN(name)
+#define SDL_PROFILE_END(units)
+
+#endif /* SDL_PROFILING */
+
+#endif /* _SDL_profile_c_h */
+/* vi: set ts=4 sw=4 expandtab: */
@@ -28,6 +28,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_audiomem.h"
 #include "SDL_sysaudio.h"
+#include "../SDL_profile_c.h"
 
 #define _THIS    SDL_AudioDevice *this
 
@@ -277,52 +278,107 @@ finalize_audio_entry_points(void)
 }
 
 /* Streaming functions (for when the input and output buffer sizes are different) */
-/* Write [length] bytes from buf into the streamer */
-void
-SDL_StreamWrite(SDL_AudioStreamer * stream, Uint8 * buf, int length)
-{
-    int i;
 
-    for (i = 0; i < length; ++i) {
-        stream->buffer[stream->write_pos] = buf[i];
-        ++stream->write_pos;
-    }
+/* Each side publishes its position only after the data it covers has been
+   copied, and reads the other side's position before touching the data.
+   Without memory barriers the stream lock does that instead. */
+#if SDL_ATOMIC_LOCKFREE
+#define SDL_StreamBarrier()	SDL_MemoryBarrier()
+#define SDL_StreamLock(stream)
+#define SDL_StreamUnlock(stream)
+#else
+#define SDL_StreamBarrier()
+#define SDL_StreamLock(stream)	SDL_mutexP((stream)->lock)
+#define SDL_StreamUnlock(stream)	SDL_mutexV((stream)->lock)
+#endif
+
+/* Write up to [length] bytes from buf into the streamer, returns the
+   number of bytes written */
+int
+SDL_StreamWrite(SDL_AudioStreamer * stream, const Uint8 * buf, int length)
+{
+    Uint32 write_pos, offset, len, first;
+
+    SDL_StreamLock(stream);
+    write_pos = stream->write_pos;
+    offset = write_pos & (stream->max_len - 1);
+    len = SDL_min((Uint32) length,
+                  stream->max_len - (write_pos - stream->read_pos));
+    first = SDL_min(len, stream->max_len - offset);
+
+    SDL_StreamBarrier();
+    SDL_memcpy(stream->buffer + offset, buf, first);
+    SDL_memcpy(stream->buffer, buf + first, len - first);
+    SDL_StreamBarrier();
+    stream->write_pos = write_pos + len;
+    SDL_StreamUnlock(stream);
+    return (int) len;
 }
 
-/* Read [length] bytes out of the streamer into buf */
-void
+/* Read up to [length] bytes out of the streamer into buf, returns the
+   number of bytes read */
+int
 SDL_StreamRead(SDL_AudioStreamer * stream, Uint8 * buf, int length)
 {
-    int i;
-
-    for (i = 0; i < length; ++i) {
-        buf[i] = stream->buffer[stream->read_pos];
-        ++stream->read_pos;
-    }
+    Uint32 read_pos, offset, len, first;
+
+    SDL_StreamLock(stream);
+    read_pos = stream->read_pos;
+    offset = read_pos & (stream->max_len - 1);
+    len = SDL_min((Uint32) length, stream->write_pos - read_pos);
+    first = SDL_min(len, stream->max_len - offset);
+
+    SDL_StreamBarrier();
+    SDL_memcpy(buf, stream->buffer + offset, first);
+    SDL_memcpy(buf + first, stream->buffer, len - first);
+    SDL_StreamBarrier();
+    stream->read_pos = read_pos + len;
+    SDL_StreamUnlock(stream);
+    return (int) len;
 }
 
 int
 SDL_StreamLength(SDL_AudioStreamer * stream)
 {
-    return (stream->write_pos - stream->read_pos) % stream->max_len;
+    int length;
+
+    SDL_StreamLock(stream);
+    length = (int) (stream->write_pos - stream->read_pos);
+    SDL_StreamUnlock(stream);
+    return length;
 }
 
 /* Initialize the stream by allocating the buffer and setting the read/write heads to the beginning */
 int
 SDL_StreamInit(SDL_AudioStreamer * stream, int max_len, Uint8 silence)
 {
+    Uint32 size = 1;
+
+    /* Positions wrap with a mask, so round the size up to a power of two */
+    while (size < (Uint32) max_len) {
+        size <<= 1;
+    }
+
     /* First try to allocate the buffer */
-    stream->buffer = (Uint8 *) SDL_malloc(max_len);
+    stream->buffer = (Uint8 *) SDL_malloc(size);
     if (stream->buffer == NULL) {
         return -1;
     }
 
-    stream->max_len = max_len;
+    stream->max_len = size;
     stream->read_pos = 0;
     stream->write_pos = 0;
+#if !SDL_ATOMIC_LOCKFREE
+    stream->lock = SDL_CreateMutex();
+    if (stream->lock == NULL) {
+        SDL_free(stream->buffer);
+        stream->buffer = NULL;
+        return -1;
+    }
+#endif
 
     /* Zero out the buffer */
-    SDL_memset(stream->buffer, silence, max_len);
+    SDL_memset(stream->buffer, silence, size);
 
     return 0;
 }
@@ -333,10 +389,73 @@ SDL_StreamDeinit(SDL_AudioStreamer * stream)
 {
     if (stream->buffer != NULL) {
         SDL_free(stream->buffer);
+        stream->buffer = NULL;
     }
+#if !SDL_ATOMIC_LOCKFREE
+    if (stream->lock != NULL) {
+        SDL_DestroyMutex(stream->lock);
+        stream->lock = NULL;
+    }
+#endif
 }
 
 
+/* The callback for devices opened without one: play the queued audio */
+static void SDLCALL
+SDL_BufferQueueDrainCallback(void *userdata, Uint8 * stream, int len)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    SDL_AudioFormat format;
+    SDL_AudioBufferQueue *packet;
+
+    SDL_mutexP(device->queue_lock);
+    while ((len > 0) && ((packet = device->buffer_queue_head) != NULL)) {
+        const Uint32 avail = packet->datalen - packet->startpos;
+        const Uint32 cpy = SDL_min((Uint32) len, avail);
+
+        SDL_memcpy(stream, packet->data + packet->startpos, cpy);
+        packet->startpos += cpy;
+        device->queued_bytes -= cpy;
+        stream += cpy;
+        len -= cpy;
+
+        /* Keep the drained packet around for the next SDL_QueueAudio() */
+        if (packet->startpos == packet->datalen) {
+            device->buffer_queue_head = packet->next;
+            packet->next = device->buffer_queue_pool;
+            device->buffer_queue_pool = packet;
+        }
+    }
+    if (device->buffer_queue_head == NULL) {
+        device->buffer_queue_tail = NULL;
+    }
+    SDL_mutexV(device->queue_lock);
+
+    /* Ran dry, play silence in the application's format */
+    if (len > 0) {
+        if (device->convert.needed) {
+            format = device->convert.src_format;
+        } else {
+            format = device->spec.format;
+        }
+        SDL_memset(stream, (format == AUDIO_U8) ? 0x80 : 0x00, len);
+    }
+}
+
+static void
+SDL_ClearQueuedAudio_Device(SDL_AudioDevice * device)
+{
+    SDL_mutexP(device->queue_lock);
+    if (device->buffer_queue_tail) {
+        device->buffer_queue_tail->next = device->buffer_queue_pool;
+        device->buffer_queue_pool = device->buffer_queue_head;
+    }
+    device->buffer_queue_head = NULL;
+    device->buffer_queue_tail = NULL;
+    device->queued_bytes = 0;
+    SDL_mutexV(device->queue_lock);
+}
+
 /* The general mixing thread function */
 int SDLCALL
 SDL_RunAudio(void *devicep)
@@ -346,11 +465,10 @@ SDL_RunAudio(void *devicep)
     int stream_len;
     void *udata;
     void (SDLCALL * fill) (void *userdata, Uint8 * stream, int len);
-    int silence;
-
-    /* For streaming when the buffer sizes don't match up */
-    Uint8 *istream;
-    int istream_len;
+#if SDL_PROFILING
+    SDL_ProfileSlot *profile = SDL_ProfileFind(NULL, "SDL_RunAudio callback");
+    Uint64 start, period_ns;
+#endif
 
     /* Perform any thread setup */
     device->threadid = SDL_ThreadID();
@@ -364,124 +482,76 @@ SDL_RunAudio(void *devicep)
     device->use_streamer = 0;
 
     if (device->convert.needed) {
-        if (device->convert.src_format == AUDIO_U8) {
-            silence = 0x80;
-        } else {
-            silence = 0;
-        }
-
-#if 0                           /* !!! FIXME: I took len_div out of the structure. Use rate_incr instead? */
-        /* If the result of the conversion alters the length, i.e. resampling is being used, use the streamer */
-        if (device->convert.len_mult != 1 || device->convert.len_div != 1) {
-            /* The streamer's maximum length should be twice whichever is larger: spec.size or len_cvt */
-            stream_max_len = 2 * device->spec.size;
-            if (device->convert.len_mult > device->convert.len_div) {
-                stream_max_len *= device->convert.len_mult;
-                stream_max_len /= device->convert.len_div;
-            }
-            if (SDL_StreamInit(&device->streamer, stream_max_len, silence) <
-                0)
+        /* If the conversion alters the length, i.e. resampling or changing
+           the sample size, the output can't go straight to the device. */
+        if (device->convert.len_ratio != 1.0 ||
+            device->convert.rate_incr != 1.0) {
+            /* Room for a device buffer plus the largest converted one */
+            if (SDL_StreamInit(&device->streamer,
+                               device->spec.size +
+                               device->convert.len * device->convert.len_mult,
+                               device->spec.silence) < 0) {
                 return -1;
+            }
             device->use_streamer = 1;
-
-            /* istream_len should be the length of what we grab from the callback and feed to conversion,
-               so that we get close to spec_size. I.e. we want device.spec_size = istream_len * u / d
-             */
-            istream_len =
-                device->spec.size * device->convert.len_div /
-                device->convert.len_mult;
         }
-#endif
-
-        /* stream_len = device->convert.len; */
-        stream_len = device->spec.size;
+        stream_len = device->convert.len;
     } else {
-        silence = device->spec.silence;
         stream_len = device->spec.size;
     }
 
+#if SDL_PROFILING
+    /* A callback has to take less time than its audio takes to play */
+    period_ns = (Uint64) (1000000000.0 * device->spec.samples /
+                          device->spec.freq * stream_len /
+                          device->spec.size *
+                          (device->convert.needed ?
+                           device->convert.len_ratio : 1.0));
+#endif
+
     /* Determine if the streamer is necessary here */
     if (device->use_streamer == 1) {
-        /* This code is almost the same as the old code. The difference is, instead of reding
-           directly from the callback into "stream", then converting and sending the audio off,
-           we go: callback -> "istream" -> (conversion) -> streamer -> stream -> device.
-           However, reading and writing with streamer are done separately:
-           - We only call the callback and write to the streamer when the streamer does not
-           contain enough samples to output to the device.
-           - We only read from the streamer and tell the device to play when the streamer
-           does have enough samples to output.
-           This allows us to perform resampling in the conversion step, where the output of the
-           resampling process can be any number. We will have to see what a good size for the
-           stream's maximum length is, but I suspect 2*max(len_cvt, stream_len) is a good figure.
+        /* Callback buffers go: callback -> convert.buf -> (conversion) ->
+           streamer, until the streamer holds a device buffer's worth of
+           audio, which is then copied to the device in one piece. This
+           allows the conversion to produce any number of samples.
          */
         while (device->enabled) {
-            /* Only read in audio if the streamer doesn't have enough already (if it does not have enough samples to output) */
-            if (SDL_StreamLength(&device->streamer) < stream_len) {
-                /* Set up istream */
-                if (device->convert.needed) {
-                    if (device->convert.buf) {
-                        istream = device->convert.buf;
-                    } else {
-                        continue;
-                    }
-                } else {
-                    istream = current_audio.impl.GetDeviceBuf(device);
-                    if (istream == NULL) {
-                        istream = device->fake_stream;
-                    }
-                }
-
-                /* Read from the callback into the _input_ stream */
-                if (!device->paused) {
-                    SDL_mutexP(device->mixer_lock);
-                    (*fill) (udata, istream, istream_len);
-                    SDL_mutexV(device->mixer_lock);
-                }
-
-                /* Convert the audio if necessary and write to the streamer */
-                if (device->convert.needed) {
-                    SDL_ConvertAudio(&device->convert);
-                    if (istream == NULL) {
-                        istream = device->fake_stream;
-                    }
-                    /*SDL_memcpy(istream, device->convert.buf, device->convert.len_cvt); */
-                    SDL_StreamWrite(&device->streamer, device->convert.buf,
-                                    device->convert.len_cvt);
-                } else {
-                    SDL_StreamWrite(&device->streamer, istream, istream_len);
-                }
+            if (device->paused) {
+                SDL_Delay((device->spec.samples * 1000) / device->spec.freq);
+                continue;
             }
 
-            /* Only output audio if the streamer has enough to output */
-            if (SDL_StreamLength(&device->streamer) >= stream_len) {
-                /* Set up the output stream */
-                if (device->convert.needed) {
-                    if (device->convert.buf) {
-                        stream = device->convert.buf;
-                    } else {
-                        continue;
-                    }
-                } else {
-                    stream = current_audio.impl.GetDeviceBuf(device);
-                    if (stream == NULL) {
-                        stream = device->fake_stream;
-                    }
-                }
+            while (SDL_StreamLength(&device->streamer) < device->spec.size) {
+                SDL_mutexP(device->mixer_lock);
+#if SDL_PROFILING
+                start = SDL_GetPerformanceCounter();
+#endif
+                (*fill) (udata, device->convert.buf, stream_len);
+#if SDL_PROFILING
+                SDL_ProfileRecord(profile, start, stream_len, period_ns);
+#endif
+                SDL_mutexV(device->mixer_lock);
 
-                /* Now read from the streamer */
-                SDL_StreamRead(&device->streamer, stream, stream_len);
+                SDL_ConvertAudio(&device->convert);
+                SDL_StreamWrite(&device->streamer, device->convert.buf,
+                                device->convert.len_cvt);
+            }
 
-                /* Ready current buffer for play and change current buffer */
-                if (stream != device->fake_stream && !device->paused) {
-                    current_audio.impl.PlayDevice(device);
-                    /* Wait for an audio buffer to become available */
-                    current_audio.impl.WaitDevice(device);
-                } else {
-                    SDL_Delay((device->spec.samples * 1000) /
-                              device->spec.freq);
-                }
+            stream = current_audio.impl.GetDeviceBuf(device);
+            if (stream == NULL) {
+                stream = device->fake_stream;
             }
+            SDL_StreamRead(&device->streamer, stream, device->spec.size);
 
+            /* Ready current buffer for play and change current buffer */
+            if (stream != device->fake_stream) {
+                current_audio.impl.PlayDevice(device);
+                /* Wait for an audio buffer to become available */
+                current_audio.impl.WaitDevice(device);
+            } else {
+                SDL_Delay((device->spec.samples * 1000) / device->spec.freq);
+            }
         }
     } else {
         /* Otherwise, do not use the streamer. This is the old code. */
@@ -505,7 +575,13 @@ SDL_RunAudio(void *devicep)
 
             if (!device->paused) {
                 SDL_mutexP(device->mixer_lock);
+#if SDL_PROFILING
+                start = SDL_GetPerformanceCounter();
+#endif
                 (*fill) (udata, stream, stream_len);
+#if SDL_PROFILING
+                SDL_ProfileRecord(profile, start, stream_len, period_ns);
+#endif
                 SDL_mutexV(device->mixer_lock);
             }
 
@@ -654,6 +730,7 @@ SDL_AudioInit(const char *driver_name)
     }
 
     finalize_audio_entry_points();
+    SDL_InitAudioResampler();
 
     return (0);
 }
@@ -730,6 +807,15 @@ close_audio_device(SDL_AudioDevice * device)
     if (device->mixer_lock != NULL) {
         SDL_DestroyMutex(device->mixer_lock);
     }
+    if (device->queue_lock != NULL) {
+        SDL_ClearQueuedAudio_Device(device);
+        while (device->buffer_queue_pool != NULL) {
+            SDL_AudioBufferQueue *packet = device->buffer_queue_pool;
+            device->buffer_queue_pool = packet->next;
+            SDL_free(packet);
+        }
+        SDL_DestroyMutex(device->queue_lock);
+    }
     if (device->fake_stream != NULL) {
         SDL_FreeAudioMem(device->fake_stream);
     }
@@ -754,11 +840,6 @@ prepare_audiospec(const SDL_AudioSpec * orig, SDL_AudioSpec * prepared)
 {
     SDL_memcpy(prepared, orig, sizeof(SDL_AudioSpec));
 
-    if (orig->callback == NULL) {
-        SDL_SetError("SDL_OpenAudio() passed a NULL callback");
-        return 0;
-    }
-
     if (orig->freq == 0) {
         const char *env = SDL_getenv("SDL_AUDIO_FREQUENCY");
         if ((!env) || ((prepared->freq = SDL_atoi(env)) == 0)) {
@@ -896,6 +977,18 @@ open_audio_device(const char *devname, int iscapture,
     device->paused = 1;
     device->iscapture = iscapture;
 
+    /* Without a callback the application queues audio from any thread */
+    if (device->spec.callback == NULL) {
+        device->queue_lock = SDL_CreateMutex();
+        if (device->queue_lock == NULL) {
+            close_audio_device(device);
+            SDL_SetError("Couldn't create queue lock");
+            return 0;
+        }
+        device->spec.callback = SDL_BufferQueueDrainCallback;
+        device->spec.userdata = device;
+    }
+
     /* Create a semaphore for locking the sound buffers */
     if (!current_audio.impl.SkipMixerLock) {
         device->mixer_lock = SDL_CreateMutex();
@@ -960,8 +1053,8 @@ open_audio_device(const char *devname, int iscapture,
             return 0;
         }
         if (device->convert.needed) {
-            device->convert.len = (int) (((double) obtained->size) /
-                                         device->convert.len_ratio);
+            /* The callback fills a buffer in the application's format */
+            device->convert.len = obtained->size;
 
             device->convert.buf =
                 (Uint8 *) SDL_AllocAudioMem(device->convert.len *
@@ -1089,6 +1182,89 @@ SDL_PauseAudio(int pause_on)
 }
 
 
+int
+SDL_QueueAudio(SDL_AudioDeviceID devid, const void *_data, Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    const Uint8 *data = (const Uint8 *) _data;
+    SDL_AudioBufferQueue *packet;
+    int retval = 0;
+
+    if (!device) {
+        return -1;
+    }
+    if (device->queue_lock == NULL) {
+        SDL_SetError("Audio device has a callback, queueing not allowed");
+        return -1;
+    }
+
+    SDL_mutexP(device->queue_lock);
+    while (len > 0) {
+        Uint32 cpy;
+
+        packet = device->buffer_queue_tail;
+        if (!packet || (packet->datalen >= SDL_AUDIOBUFFERQUEUE_PACKETLEN)) {
+            /* Reuse a drained packet if there is one */
+            packet = device->buffer_queue_pool;
+            if (packet) {
+                device->buffer_queue_pool = packet->next;
+            } else {
+                packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof(*packet));
+                if (!packet) {
+                    SDL_OutOfMemory();
+                    retval = -1;
+                    break;
+                }
+            }
+            packet->datalen = 0;
+            packet->startpos = 0;
+            packet->next = NULL;
+
+            if (device->buffer_queue_tail) {
+                device->buffer_queue_tail->next = packet;
+            } else {
+                device->buffer_queue_head = packet;
+            }
+            device->buffer_queue_tail = packet;
+        }
+
+        cpy = SDL_min(len, SDL_AUDIOBUFFERQUEUE_PACKETLEN - packet->datalen);
+        SDL_memcpy(packet->data + packet->datalen, data, cpy);
+        packet->datalen += cpy;
+        device->queued_bytes += cpy;
+        data += cpy;
+        len -= cpy;
+    }
+    SDL_mutexV(device->queue_lock);
+
+    return retval;
+}
+
+Uint32
+SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint32 retval = 0;
+
+    if (device && device->queue_lock) {
+        SDL_mutexP(device->queue_lock);
+        retval = device->queued_bytes;
+        SDL_mutexV(device->queue_lock);
+    }
+    return retval;
+}
+
+void
+SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (device && device->queue_lock) {
+        SDL_ClearQueuedAudio_Device(device);
+    }
+}
+
+
 void
 SDL_LockAudioDevice(SDL_AudioDeviceID devid)
 {
@@ -1149,6 +1325,7 @@ SDL_AudioQuit(void)
     current_audio.impl.Deinitialize();
     SDL_memset(&current_audio, '\0', sizeof(current_audio));
     SDL_memset(open_devices, '\0', sizeof(open_devices));
+    SDL_QuitAudioResampler();
 }
 
 #define NUM_FORMATS 10
@@ -53,4 +53,13 @@ typedef struct
 } SDL_AudioRateFilters;
 extern const SDL_AudioRateFilters sdl_audio_rate_filters[];
 
+/* The polyphase resampler in SDL_audioresample.c */
+extern void SDL_InitAudioResampler(void);
+extern void SDL_QuitAudioResampler(void);
+extern SDL_AudioFilter SDL_BuildPolyphaseResampler(SDL_AudioCVT * cvt,
+                                                   SDL_AudioFormat format,
+                                                   int channels,
+                                                   int src_rate,
+                                                   int dst_rate);
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -25,6 +25,7 @@
 
 #include "SDL_audio.h"
 #include "SDL_audio_c.h"
+#include "../SDL_profile_c.h"
 
 /* #define DEBUG_CONVERT */
 
@@ -296,8 +297,8 @@ SDL_ConvertStereo(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     { \
         const type *src = (const type *) (cvt->buf + cvt->len_cvt); \
         type *dst = (type *) (cvt->buf + cvt->len_cvt * 2); \
-        for (i = cvt->len_cvt / 2; i; --i, --src) { \
-            const type val = *src; \
+        for (i = cvt->len_cvt / sizeof(type); i; --i) { \
+            const type val = *(--src); \
             dst -= 2; \
             dst[0] = dst[1] = val; \
         } \
@@ -342,7 +343,7 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Uint8 *) (cvt->buf + cvt->len_cvt);
             dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 3);
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 6;
                 src -= 2;
                 lf = src[0];
@@ -364,7 +365,7 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Sint8 *) cvt->buf + cvt->len_cvt;
             dst = (Sint8 *) cvt->buf + cvt->len_cvt * 3;
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 6;
                 src -= 2;
                 lf = src[0];
@@ -503,8 +504,8 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     case AUDIO_S32:
         {
             Sint32 lf, rf, ce;
-            const Uint32 *src = (const Uint32 *) cvt->buf + cvt->len_cvt;
-            Uint32 *dst = (Uint32 *) cvt->buf + cvt->len_cvt * 3;
+            const Uint32 *src = (const Uint32 *) (cvt->buf + cvt->len_cvt);
+            Uint32 *dst = (Uint32 *) (cvt->buf + cvt->len_cvt * 3);
 
             if (SDL_AUDIO_ISBIGENDIAN(format)) {
                 for (i = cvt->len_cvt / 8; i; --i) {
@@ -541,8 +542,8 @@ SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     case AUDIO_F32:
         {
             float lf, rf, ce;
-            const float *src = (const float *) cvt->buf + cvt->len_cvt;
-            float *dst = (float *) cvt->buf + cvt->len_cvt * 3;
+            const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+            float *dst = (float *) (cvt->buf + cvt->len_cvt * 3);
 
             if (SDL_AUDIO_ISBIGENDIAN(format)) {
                 for (i = cvt->len_cvt / 8; i; --i) {
@@ -599,7 +600,7 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Uint8 *) (cvt->buf + cvt->len_cvt);
             dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 2);
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 4;
                 src -= 2;
                 lf = src[0];
@@ -619,7 +620,7 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
             src = (Sint8 *) cvt->buf + cvt->len_cvt;
             dst = (Sint8 *) cvt->buf + cvt->len_cvt * 2;
-            for (i = cvt->len_cvt; i; --i) {
+            for (i = cvt->len_cvt / 2; i; --i) {
                 dst -= 4;
                 src -= 2;
                 lf = src[0];
@@ -774,6 +775,98 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 
 
+#if SDL_PROFILING
+/* Filters normally call the next one themselves.  To time each one on
+   its own, this takes the place of the next filter and hands back the
+   format the filter passed on, marked so it can't be mistaken for an
+   index if a filter doesn't call it.
+ */
+#define FILTER_DONE 0x10000
+
+static void SDLCALL
+SDL_ProfileNextFilter(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    cvt->filter_index = FILTER_DONE | format;
+}
+
+static SDL_ProfileSlot *
+SDL_ProfileFilter(SDL_AudioFilter filter)
+{
+    static const struct
+    {
+        SDL_AudioFilter filter;
+        const char *name;
+    } named[] = {
+        { SDL_ConvertMono, "SDL_ConvertMono" },
+        { SDL_ConvertStrip, "SDL_ConvertStrip" },
+        { SDL_ConvertStrip_2, "SDL_ConvertStrip_2" },
+        { SDL_ConvertStereo, "SDL_ConvertStereo" },
+        { SDL_ConvertSurround, "SDL_ConvertSurround" },
+        { SDL_ConvertSurround_4, "SDL_ConvertSurround_4" },
+    };
+    SDL_ProfileSlot *slot = SDL_ProfileFind((const void *) filter, NULL);
+    char name[64];
+    int i;
+
+    if (slot) {
+        return slot;
+    }
+    SDL_snprintf(name, sizeof(name), "SDL_ConvertAudio %p", (void *) filter);
+    for (i = 0; i < SDL_arraysize(named); ++i) {
+        if (named[i].filter == filter) {
+            SDL_snprintf(name, sizeof(name), "SDL_ConvertAudio %s",
+                         named[i].name);
+        }
+    }
+    for (i = 0; sdl_audio_type_filters[i].filter != NULL; ++i) {
+        const SDL_AudioTypeFilters *filt = &sdl_audio_type_filters[i];
+        if (filt->filter == filter) {
+            SDL_snprintf(name, sizeof(name),
+                         "SDL_ConvertAudio 0x%04x to 0x%04x",
+                         filt->src_fmt, filt->dst_fmt);
+        }
+    }
+    for (i = 0; sdl_audio_rate_filters[i].filter != NULL; ++i) {
+        const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
+        if (filt->filter == filter) {
+            SDL_snprintf(name, sizeof(name),
+                         "SDL_ConvertAudio 0x%04x %dch %s x%d",
+                         filt->fmt, filt->channels,
+                         filt->upsample ? "up" : "down", filt->multiple);
+        }
+    }
+    return SDL_ProfileFind((const void *) filter, name);
+}
+
+/* Runs the filter chain one filter at a time, timing each one */
+static void
+SDL_RunAudioFilters(SDL_AudioCVT * cvt)
+{
+    SDL_AudioFormat format = cvt->src_format;
+    int i;
+
+    for (i = 0; cvt->filters[i]; ++i) {
+        SDL_AudioFilter filter = cvt->filters[i];
+        SDL_AudioFilter next = cvt->filters[i + 1];
+        const int len = cvt->len_cvt;
+        Uint64 start;
+
+        cvt->filters[i + 1] = SDL_ProfileNextFilter;
+        cvt->filter_index = i;
+        start = SDL_GetPerformanceCounter();
+        filter(cvt, format);
+        SDL_ProfileRecord(SDL_ProfileFilter(filter), start, len, 0);
+        cvt->filters[i + 1] = next;
+
+        if (!(cvt->filter_index & FILTER_DONE)) {
+            break;              /* The filter ended the chain itself */
+        }
+        format = (SDL_AudioFormat) (cvt->filter_index & ~FILTER_DONE);
+    }
+}
+#endif /* SDL_PROFILING */
+
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -792,8 +885,12 @@ SDL_ConvertAudio(SDL_AudioCVT * cvt)
     }
 
     /* Set up the conversion and go! */
+#if SDL_PROFILING
+    SDL_RunAudioFilters(cvt);
+#else
     cvt->filter_index = 0;
     cvt->filters[0] (cvt, cvt->src_format);
+#endif
     return (0);
 }
 
@@ -859,15 +956,17 @@ SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
 
 
 static SDL_AudioFilter
-SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                         int src_rate, int dst_rate)
+SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, SDL_AudioFormat format,
+                         int dst_channels, int src_rate, int dst_rate)
 {
     /*
      * Fill in any future conversions that are specialized to a
      *  processor, platform, compiler, or library here.
      */
 
-    return NULL;                /* no specialized converter code available. */
+    /* The polyphase filter handles any ratio for native S16 and F32 */
+    return SDL_BuildPolyphaseResampler(cvt, format, dst_channels, src_rate,
+                                       dst_rate);
 }
 
 static int
@@ -904,11 +1003,12 @@ SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
 }
 
 static int
-SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                          int src_rate, int dst_rate)
+SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, SDL_AudioFormat format,
+                          int dst_channels, int src_rate, int dst_rate)
 {
     if (src_rate != dst_rate) {
-        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
+        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, format,
+                                                          dst_channels,
                                                           src_rate, dst_rate);
 
         /* No hand-tuned converter? Try the autogenerated ones. */
@@ -920,7 +1020,7 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
 
             for (i = 0; sdl_audio_rate_filters[i].filter != NULL; i++) {
                 const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
-                if ((filt->fmt == cvt->dst_format) &&
+                if ((filt->fmt == format) &&
                     (filt->channels == dst_channels) &&
                     (filt->upsample == upsample) &&
                     (filt->multiple == multiple)) {
@@ -951,6 +1051,66 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
 }
 
 
+/* Channel conversions that make the buffer smaller */
+static int
+SDL_BuildAudioReduceChannelsCVT(SDL_AudioCVT * cvt, int src_channels,
+                                int dst_channels)
+{
+    if ((src_channels == 6) && (dst_channels <= 2)) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertStrip;
+        src_channels = 2;
+        cvt->len_ratio /= 3;
+    }
+    if ((src_channels == 6) && (dst_channels == 4)) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertStrip_2;
+        src_channels = 4;
+        cvt->len_ratio /= 2;
+    }
+    /* This assumes that 4 channel audio is in the format:
+       Left {front/back} + Right {front/back}
+       so converting to L/R stereo works properly.
+     */
+    while (((src_channels % 2) == 0) && ((src_channels / 2) >= dst_channels)) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertMono;
+        src_channels /= 2;
+        cvt->len_ratio /= 2;
+    }
+    return src_channels;
+}
+
+/* Channel conversions that make the buffer bigger */
+static int
+SDL_BuildAudioExpandChannelsCVT(SDL_AudioCVT * cvt, int src_channels,
+                                int dst_channels)
+{
+    if ((src_channels == 1) && (dst_channels > 1)) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
+        cvt->len_mult *= 2;
+        src_channels = 2;
+        cvt->len_ratio *= 2;
+    }
+    if ((src_channels == 2) && (dst_channels == 6)) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertSurround;
+        src_channels = 6;
+        cvt->len_mult *= 3;
+        cvt->len_ratio *= 3;
+    }
+    if ((src_channels == 2) && (dst_channels == 4)) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertSurround_4;
+        src_channels = 4;
+        cvt->len_mult *= 2;
+        cvt->len_ratio *= 2;
+    }
+    while ((src_channels * 2) <= dst_channels) {
+        cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
+        cvt->len_mult *= 2;
+        src_channels *= 2;
+        cvt->len_ratio *= 2;
+    }
+    return src_channels;
+}
+
+
 /* Creates a set of audio filters to convert from one format to another.
    Returns -1 if the format conversion is not supported, 0 if there's
    no conversion needed, or 1 if the audio filter is set up.
@@ -962,18 +1122,20 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
                   SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
 {
     /*
-     * !!! FIXME: reorder filters based on which grow/shrink the buffer.
-     * !!! FIXME: ideally, we should do everything that shrinks the buffer
-     * !!! FIXME: first, so we don't have to process as many bytes in a given
-     * !!! FIXME: filter and abuse the CPU cache less. This might not be as
-     * !!! FIXME: good in practice as it sounds in theory, though.
+     * The filters are ordered so everything that shrinks the buffer runs
+     *  first and everything that grows it runs last, which keeps the
+     *  number of bytes each filter has to touch down.
      */
+    const int src_bitsize = SDL_AUDIO_BITSIZE(src_fmt);
+    const int dst_bitsize = SDL_AUDIO_BITSIZE(dst_fmt);
+    SDL_AudioFormat rate_fmt = dst_fmt;
+    int channels = src_channels;
 
     /* there are no unsigned types over 16 bits, so catch this upfront. */
-    if ((SDL_AUDIO_BITSIZE(src_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(src_fmt))) {
+    if ((src_bitsize > 16) && (!SDL_AUDIO_ISSIGNED(src_fmt))) {
         return -1;
     }
-    if ((SDL_AUDIO_BITSIZE(dst_fmt) > 16) && (!SDL_AUDIO_ISSIGNED(dst_fmt))) {
+    if ((dst_bitsize > 16) && (!SDL_AUDIO_ISSIGNED(dst_fmt))) {
         return -1;
     }
 
@@ -997,66 +1159,44 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     cvt->len_ratio = 1.0;
     cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
 
+    /* Drop channels while the samples are as small as they'll get */
+    if (src_channels > dst_channels) {
+        channels = SDL_BuildAudioReduceChannelsCVT(cvt, channels,
+                                                   dst_channels);
+    }
+
+    /* Downsample before widening the samples, if the polyphase filter can
+       work on the source format; the linear ones would lose quality. */
+    if ((src_bitsize < dst_bitsize) && (src_rate > dst_rate) &&
+        (SDL_HandTunedResampleCVT(cvt, src_fmt, channels, src_rate,
+                                  dst_rate) != NULL)) {
+        rate_fmt = src_fmt;
+        if (SDL_BuildAudioResampleCVT(cvt, rate_fmt, channels, src_rate,
+                                      dst_rate) == -1) {
+            return -1;
+        }
+    }
+
     /* Convert data types, if necessary. Updates (cvt). */
     if (SDL_BuildAudioTypeCVT(cvt, src_fmt, dst_fmt) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
-    /* Channel conversion */
-    if (src_channels != dst_channels) {
-        if ((src_channels == 1) && (dst_channels > 1)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
-            cvt->len_mult *= 2;
-            src_channels = 2;
-            cvt->len_ratio *= 2;
-        }
-        if ((src_channels == 2) && (dst_channels == 6)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertSurround;
-            src_channels = 6;
-            cvt->len_mult *= 3;
-            cvt->len_ratio *= 3;
-        }
-        if ((src_channels == 2) && (dst_channels == 4)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertSurround_4;
-            src_channels = 4;
-            cvt->len_mult *= 2;
-            cvt->len_ratio *= 2;
-        }
-        while ((src_channels * 2) <= dst_channels) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
-            cvt->len_mult *= 2;
-            src_channels *= 2;
-            cvt->len_ratio *= 2;
-        }
-        if ((src_channels == 6) && (dst_channels <= 2)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip;
-            src_channels = 2;
-            cvt->len_ratio /= 3;
-        }
-        if ((src_channels == 6) && (dst_channels == 4)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip_2;
-            src_channels = 4;
-            cvt->len_ratio /= 2;
-        }
-        /* This assumes that 4 channel audio is in the format:
-           Left {front/back} + Right {front/back}
-           so converting to L/R stereo works properly.
-         */
-        while (((src_channels % 2) == 0) &&
-               ((src_channels / 2) >= dst_channels)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertMono;
-            src_channels /= 2;
-            cvt->len_ratio /= 2;
-        }
-        if (src_channels != dst_channels) {
-            /* Uh oh.. */ ;
+    /* Do rate conversion, if necessary. Updates (cvt). */
+    if (rate_fmt == dst_fmt) {
+        if (SDL_BuildAudioResampleCVT(cvt, rate_fmt, channels, src_rate,
+                                      dst_rate) == -1) {
+            return -1;          /* shouldn't happen, but just in case... */
         }
     }
 
-    /* Do rate conversion, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) ==
-        -1) {
-        return -1;              /* shouldn't happen, but just in case... */
+    /* Add channels last, on the final samples */
+    if (channels < dst_channels) {
+        channels = SDL_BuildAudioExpandChannelsCVT(cvt, channels,
+                                                   dst_channels);
+    }
+    if (channels != dst_channels) {
+        /* Uh oh.. */ ;
     }
 
     /* Set up the filter information */
@@ -0,0 +1,604 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Polyphase windowed-sinc sample rate conversion
+
+   The rate ratio is reduced to phases/step (dst_rate/src_rate divided by
+   their greatest common divisor), and every output frame is the dot
+   product of the last 'taps' input frames with one of 'phases' filters,
+   each a Blackman windowed sinc shifted by a fraction of an input frame.
+   The filter tables only depend on the ratio and the filter length, so
+   they're shared between every SDL_AudioCVT that needs them.  SDL_AudioCVT
+   has no cleanup function, so a converter doesn't hold on to its table:
+   it looks it up again for each call and lets it go when it's done, and
+   the least recently used table nobody is converting with makes room for
+   a new one.
+
+   The filter runs in place on cvt->buf, a block of input frames at a time
+   converted to float, and keeps the input tail and the phase of the next
+   output frame in cvt->resampler so that a stream can be converted in
+   pieces of any size without clicks.
+
+   SDL_AUDIO_RESAMPLER_QUALITY selects the filter length: 0 keeps the
+   older linear resamplers, 1, 2 and 3 use 16, 32 and 64 taps.
+*/
+
+#include "SDL_audio.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_mutex.h"
+#include "SDL_audio_c.h"
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+/* Ratios that don't reduce to this many phases are approximated */
+#define RESAMPLE_MAX_PHASES 1024
+
+/* Passband edge, as a fraction of the lower Nyquist frequency */
+#define RESAMPLE_ROLLOFF    0.92
+
+/* Input frames converted to float at a time */
+#define RESAMPLE_BLOCK      128
+
+/* Filter tables kept around for converters to come back to */
+#define RESAMPLE_MAX_TABLES 8
+
+typedef void (*SDL_ResampleFunc) (const float *coeffs, const float *window,
+                                  int taps, int channels, float *out);
+
+static struct
+{
+    int phases;
+    int step;
+    int taps;
+    float *coeffs;
+    int users;                  /* Conversions running with the table */
+    Uint32 last_used;
+} SDL_resample_tables[RESAMPLE_MAX_TABLES];
+static int SDL_num_resample_tables;
+static Uint32 SDL_resample_clock;
+static SDL_mutex *SDL_resample_lock;
+
+void
+SDL_InitAudioResampler(void)
+{
+    if (!SDL_resample_lock) {
+        SDL_resample_lock = SDL_CreateMutex();
+    }
+}
+
+void
+SDL_QuitAudioResampler(void)
+{
+    int i, kept = 0;
+
+    /* Converters built before now make their tables again if they need to */
+    for (i = 0; i < SDL_num_resample_tables; ++i) {
+        if (SDL_resample_tables[i].users) {
+            SDL_resample_tables[kept++] = SDL_resample_tables[i];
+        } else {
+            SDL_free(SDL_resample_tables[i].coeffs);
+        }
+    }
+    SDL_num_resample_tables = kept;
+    if (SDL_resample_lock) {
+        SDL_DestroyMutex(SDL_resample_lock);
+        SDL_resample_lock = NULL;
+    }
+}
+
+static float *
+SDL_CreateResampleTable(int phases, int step, int taps)
+{
+    const double cutoff =
+        SDL_min(1.0, (double) phases / step) * RESAMPLE_ROLLOFF;
+    float *coeffs;
+    int p, f;
+
+    coeffs = (float *) SDL_malloc(phases * taps * sizeof(float));
+    if (!coeffs) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    for (p = 0; p < phases; ++p) {
+        float *row = &coeffs[p * taps];
+        double sum = 0.0;
+
+        /* Coefficients run from the oldest input frame to the newest */
+        for (f = 0; f < taps; ++f) {
+            const double x =
+                (taps - 1 - f) + (double) p / phases - (taps / 2);
+            const double n = x / taps + 0.5;
+            const double window = 0.42 - 0.5 * SDL_cos(2.0 * M_PI * n) +
+                0.08 * SDL_cos(4.0 * M_PI * n);
+            double sinc;
+
+            if (x == 0.0) {
+                sinc = cutoff;
+            } else {
+                sinc = SDL_sin(M_PI * cutoff * x) / (M_PI * x);
+            }
+            row[f] = (float) (sinc * window);
+            sum += row[f];
+        }
+
+        /* Unity gain at DC for every phase */
+        for (f = 0; f < taps; ++f) {
+            row[f] = (float) (row[f] / sum);
+        }
+    }
+    return coeffs;
+}
+
+/* Finds or makes the table for a ratio, SDL_ReleaseResampleTable() has
+   to be called with it when the conversion is done. */
+static float *
+SDL_AcquireResampleTable(int phases, int step, int taps)
+{
+    float *coeffs = NULL;
+    int i, slot = -1;
+
+    if (SDL_resample_lock) {
+        SDL_mutexP(SDL_resample_lock);
+    }
+    for (i = 0; i < SDL_num_resample_tables; ++i) {
+        if (SDL_resample_tables[i].phases == phases &&
+            SDL_resample_tables[i].step == step &&
+            SDL_resample_tables[i].taps == taps) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        coeffs = SDL_CreateResampleTable(phases, step, taps);
+        if (coeffs) {
+            if (SDL_num_resample_tables < RESAMPLE_MAX_TABLES) {
+                slot = SDL_num_resample_tables++;
+            } else {
+                for (i = 0; i < SDL_num_resample_tables; ++i) {
+                    if (!SDL_resample_tables[i].users &&
+                        (slot < 0 ||
+                         SDL_resample_tables[i].last_used <
+                         SDL_resample_tables[slot].last_used)) {
+                        slot = i;
+                    }
+                }
+                if (slot >= 0) {
+                    SDL_free(SDL_resample_tables[slot].coeffs);
+                }
+            }
+        }
+        /* If every table is in use this one is freed when it's released */
+        if (slot >= 0) {
+            SDL_resample_tables[slot].phases = phases;
+            SDL_resample_tables[slot].step = step;
+            SDL_resample_tables[slot].taps = taps;
+            SDL_resample_tables[slot].coeffs = coeffs;
+            SDL_resample_tables[slot].users = 0;
+        }
+    }
+    if (slot >= 0) {
+        coeffs = SDL_resample_tables[slot].coeffs;
+        ++SDL_resample_tables[slot].users;
+        SDL_resample_tables[slot].last_used = ++SDL_resample_clock;
+    }
+    if (SDL_resample_lock) {
+        SDL_mutexV(SDL_resample_lock);
+    }
+    return coeffs;
+}
+
+static void
+SDL_ReleaseResampleTable(float *coeffs)
+{
+    int i;
+
+    if (SDL_resample_lock) {
+        SDL_mutexP(SDL_resample_lock);
+    }
+    for (i = 0; i < SDL_num_resample_tables; ++i) {
+        if (SDL_resample_tables[i].coeffs == coeffs) {
+            --SDL_resample_tables[i].users;
+            break;
+        }
+    }
+    if (i == SDL_num_resample_tables) {
+        SDL_free(coeffs);
+    }
+    if (SDL_resample_lock) {
+        SDL_mutexV(SDL_resample_lock);
+    }
+}
+
+static void
+SDL_ResampleFrame(const float *coeffs, const float *window, int taps,
+                  int channels, float *out)
+{
+    int f, c;
+
+    for (c = 0; c < channels; ++c) {
+        out[c] = 0.0f;
+    }
+    for (f = 0; f < taps; ++f) {
+        for (c = 0; c < channels; ++c) {
+            out[c] += coeffs[f] * window[c];
+        }
+        window += channels;
+    }
+}
+
+#ifdef __SSE__
+/* The filter length is always a multiple of 4 */
+
+static void
+SDL_ResampleFrame1_SSE(const float *coeffs, const float *window, int taps,
+                       int channels, float *out)
+{
+    __m128 sum = _mm_setzero_ps();
+    int f;
+
+    for (f = 0; f < taps; f += 4) {
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&coeffs[f]),
+                                         _mm_loadu_ps(&window[f])));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+    _mm_store_ss(out, sum);
+}
+
+static void
+SDL_ResampleFrame2_SSE(const float *coeffs, const float *window, int taps,
+                       int channels, float *out)
+{
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    int f;
+
+    for (f = 0; f < taps; f += 4) {
+        const __m128 c = _mm_loadu_ps(&coeffs[f]);
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_unpacklo_ps(c, c),
+                                           _mm_loadu_ps(&window[0])));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_unpackhi_ps(c, c),
+                                           _mm_loadu_ps(&window[4])));
+        window += 8;
+    }
+    sum0 = _mm_add_ps(sum0, sum1);
+    sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+    _mm_storel_pi((__m64 *) out, sum0);
+}
+
+static void
+SDL_ResampleFrame4_SSE(const float *coeffs, const float *window, int taps,
+                       int channels, float *out)
+{
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    int f;
+
+    for (f = 0; f < taps; f += 4) {
+        const __m128 c = _mm_loadu_ps(&coeffs[f]);
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_shuffle_ps(c, c, 0x00),
+                                           _mm_loadu_ps(&window[0])));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_shuffle_ps(c, c, 0x55),
+                                           _mm_loadu_ps(&window[4])));
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_shuffle_ps(c, c, 0xAA),
+                                           _mm_loadu_ps(&window[8])));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_shuffle_ps(c, c, 0xFF),
+                                           _mm_loadu_ps(&window[12])));
+        window += 16;
+    }
+    _mm_storeu_ps(out, _mm_add_ps(sum0, sum1));
+}
+
+static void
+SDL_ResampleFrame6_SSE(const float *coeffs, const float *window, int taps,
+                       int channels, float *out)
+{
+    /* Two frames are three vectors: channels 0-3, 4,5,0,1 and 2-5 */
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    __m128 sum2 = _mm_setzero_ps();
+    float s[12];
+    int f;
+
+    for (f = 0; f < taps; f += 4) {
+        const __m128 c = _mm_loadu_ps(&coeffs[f]);
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_shuffle_ps(c, c, 0x00),
+                                           _mm_loadu_ps(&window[0])));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_shuffle_ps(c, c, 0x50),
+                                           _mm_loadu_ps(&window[4])));
+        sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_shuffle_ps(c, c, 0x55),
+                                           _mm_loadu_ps(&window[8])));
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_shuffle_ps(c, c, 0xAA),
+                                           _mm_loadu_ps(&window[12])));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_shuffle_ps(c, c, 0xFA),
+                                           _mm_loadu_ps(&window[16])));
+        sum2 = _mm_add_ps(sum2, _mm_mul_ps(_mm_shuffle_ps(c, c, 0xFF),
+                                           _mm_loadu_ps(&window[20])));
+        window += 24;
+    }
+    _mm_storeu_ps(&s[0], sum0);
+    _mm_storeu_ps(&s[4], sum1);
+    _mm_storeu_ps(&s[8], sum2);
+    out[0] = s[0] + s[6];
+    out[1] = s[1] + s[7];
+    out[2] = s[2] + s[8];
+    out[3] = s[3] + s[9];
+    out[4] = s[4] + s[10];
+    out[5] = s[5] + s[11];
+}
+#endif /* __SSE__ */
+
+static SDL_ResampleFunc
+SDL_ChooseResampleFunc(int channels)
+{
+#ifdef __SSE__
+    if (SDL_HasSSE()) {
+        switch (channels) {
+        case 1:
+            return SDL_ResampleFrame1_SSE;
+        case 2:
+            return SDL_ResampleFrame2_SSE;
+        case 4:
+            return SDL_ResampleFrame4_SSE;
+        case 6:
+            return SDL_ResampleFrame6_SSE;
+        }
+    }
+#endif
+    return SDL_ResampleFrame;
+}
+
+/* Number of output frames that come before input frame 'end / phases' */
+static int
+SDL_ResampleCount(Sint64 end, int step)
+{
+    if (end <= 0) {
+        return 0;
+    }
+    return (int) ((end + step - 1) / step);
+}
+
+/* Converts 'count' input frames starting at 'first' to float, frames
+   before the start of the buffer come from the end of the last call. */
+static void
+SDL_LoadFrames(const SDL_AudioCVT * cvt, SDL_AudioFormat format,
+               int first, int count, float *dst)
+{
+    const SDL_AudioResampler *state = &cvt->resampler;
+    const int channels = state->channels;
+    int i;
+
+    if (first < 0) {
+        const int frames = SDL_min(-first, count);
+        SDL_memcpy(dst,
+                   &state->history[(first + state->taps - 1) * channels],
+                   frames * channels * sizeof(float));
+        dst += frames * channels;
+        first += frames;
+        count -= frames;
+    }
+    if (count <= 0) {
+        return;
+    }
+
+    if (format == AUDIO_S16SYS) {
+        const Sint16 *src = (const Sint16 *) cvt->buf + first * channels;
+        for (i = 0; i < count * channels; ++i) {
+            dst[i] = (float) src[i];
+        }
+    } else {
+        const float *src = (const float *) cvt->buf + first * channels;
+        SDL_memcpy(dst, src, count * channels * sizeof(float));
+    }
+}
+
+static void
+SDL_StoreFrame(SDL_AudioCVT * cvt, SDL_AudioFormat format, int frame,
+               const float *src)
+{
+    const int channels = cvt->resampler.channels;
+    int c;
+
+    if (format == AUDIO_S16SYS) {
+        Sint16 *dst = (Sint16 *) cvt->buf + frame * channels;
+        for (c = 0; c < channels; ++c) {
+            const float sample = src[c];
+            if (sample >= 32767.0f) {
+                dst[c] = 32767;
+            } else if (sample <= -32768.0f) {
+                dst[c] = -32768;
+            } else if (sample < 0.0f) {
+                dst[c] = (Sint16) (sample - 0.5f);
+            } else {
+                dst[c] = (Sint16) (sample + 0.5f);
+            }
+        }
+    } else {
+        float *dst = (float *) cvt->buf + frame * channels;
+        for (c = 0; c < channels; ++c) {
+            dst[c] = src[c];
+        }
+    }
+}
+
+/* Writes every output frame whose newest input frame is in [first,last),
+   'window' holds input frames from first - (taps - 1) to last - 1. */
+static void
+SDL_ResampleBlock(SDL_AudioCVT * cvt, SDL_AudioFormat format,
+                  SDL_ResampleFunc resample, const float *window,
+                  int first, int last)
+{
+    const SDL_AudioResampler *state = &cvt->resampler;
+    const int phases = state->phases;
+    const int step = state->step;
+    const int taps = state->taps;
+    const int channels = state->channels;
+    int frame = SDL_ResampleCount((Sint64) first * phases - state->phase,
+                                  step);
+    const int end = SDL_ResampleCount((Sint64) last * phases - state->phase,
+                                      step);
+    const Sint64 pos = state->phase + (Sint64) frame * step;
+    int input = (int) (pos / phases);
+    int phase = (int) (pos % phases);
+    float out[SDL_AUDIOCVT_MAX_CHANNELS];
+
+    for (; frame < end; ++frame) {
+        resample(&state->coeffs[phase * taps],
+                 &window[(input - first) * channels], taps, channels, out);
+        SDL_StoreFrame(cvt, format, frame, out);
+        phase += step;
+        input += phase / phases;
+        phase %= phases;
+    }
+}
+
+static void SDLCALL
+SDL_ResamplePolyphase(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    SDL_AudioResampler *state = &cvt->resampler;
+    const int channels = state->channels;
+    const int history = state->taps - 1;
+    const int framesize = channels * (SDL_AUDIO_BITSIZE(format) / 8);
+    const int frames = cvt->len_cvt / framesize;
+    const Sint64 end = (Sint64) frames * state->phases - state->phase;
+    const int outframes = SDL_ResampleCount(end, state->step);
+    const SDL_ResampleFunc resample = SDL_ChooseResampleFunc(channels);
+    float window[(SDL_AUDIOCVT_MAX_TAPS - 1 + RESAMPLE_BLOCK) *
+                 SDL_AUDIOCVT_MAX_CHANNELS];
+    float tail[(SDL_AUDIOCVT_MAX_TAPS - 1) * SDL_AUDIOCVT_MAX_CHANNELS];
+    float *coeffs;
+    int first, last;
+
+    coeffs = SDL_AcquireResampleTable(state->phases, state->step,
+                                      state->taps);
+    if (!coeffs) {
+        /* Out of memory, keep the stream's timing with silence */
+        SDL_memset(cvt->buf, 0, outframes * framesize);
+        state->phase = (int) ((Sint64) outframes * state->step - end);
+        SDL_memset(state->history, 0, history * channels * sizeof(float));
+        cvt->len_cvt = outframes * framesize;
+        if (cvt->filters[++cvt->filter_index]) {
+            cvt->filters[cvt->filter_index] (cvt, format);
+        }
+        return;
+    }
+    state->coeffs = coeffs;
+
+    /* Save what the next call needs before the output overwrites it */
+    SDL_LoadFrames(cvt, format, frames - history, history, tail);
+
+    if (state->phases > state->step) {
+        /* Upsampling writes ahead of the input, so go backwards */
+        for (first = ((frames - 1) / RESAMPLE_BLOCK) * RESAMPLE_BLOCK;
+             first >= 0; first -= RESAMPLE_BLOCK) {
+            last = SDL_min(first + RESAMPLE_BLOCK, frames);
+            SDL_LoadFrames(cvt, format, first - history,
+                           history + last - first, window);
+            SDL_ResampleBlock(cvt, format, resample, window, first, last);
+        }
+    } else {
+        SDL_LoadFrames(cvt, format, -history, history, window);
+        for (first = 0; first < frames; first += RESAMPLE_BLOCK) {
+            last = SDL_min(first + RESAMPLE_BLOCK, frames);
+            SDL_LoadFrames(cvt, format, first, last - first,
+                           &window[history * channels]);
+            SDL_ResampleBlock(cvt, format, resample, window, first, last);
+            SDL_memmove(window, &window[(last - first) * channels],
+                        history * channels * sizeof(float));
+        }
+    }
+
+    state->coeffs = NULL;
+    SDL_ReleaseResampleTable(coeffs);
+
+    state->phase = (int) ((Sint64) outframes * state->step - end);
+    SDL_memcpy(state->history, tail, history * channels * sizeof(float));
+
+    cvt->len_cvt = outframes * framesize;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static int
+SDL_GreatestCommonDivisor(int a, int b)
+{
+    while (b) {
+        const int r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+SDL_AudioFilter
+SDL_BuildPolyphaseResampler(SDL_AudioCVT * cvt, SDL_AudioFormat format,
+                            int channels, int src_rate, int dst_rate)
+{
+    SDL_AudioResampler *state = &cvt->resampler;
+    const char *hint = SDL_getenv("SDL_AUDIO_RESAMPLER_QUALITY");
+    const int quality = hint ? SDL_atoi(hint) : 2;
+    const int divisor = SDL_GreatestCommonDivisor(src_rate, dst_rate);
+    int phases = dst_rate / divisor;
+    int step = src_rate / divisor;
+    float *coeffs;
+    int taps;
+
+    if (quality <= 0) {
+        return NULL;
+    }
+    if (format != AUDIO_S16SYS && format != AUDIO_F32SYS) {
+        return NULL;
+    }
+    if (channels < 1 || channels > SDL_AUDIOCVT_MAX_CHANNELS) {
+        return NULL;
+    }
+
+    taps = 16 << (SDL_min(quality, 3) - 1);
+    if (phases > RESAMPLE_MAX_PHASES) {
+        step = (int) (((double) step * RESAMPLE_MAX_PHASES) / phases + 0.5);
+        phases = RESAMPLE_MAX_PHASES;
+        if (step < 1) {
+            step = 1;
+        }
+    }
+
+    /* Make the table now, so the first conversion doesn't have to */
+    coeffs = SDL_AcquireResampleTable(phases, step, taps);
+    if (!coeffs) {
+        return NULL;
+    }
+    SDL_ReleaseResampleTable(coeffs);
+
+    SDL_zerop(state);
+    state->taps = taps;
+    state->channels = channels;
+    state->phases = phases;
+    state->step = step;
+    return SDL_ResamplePolyphase;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -2301,7 +2301,7 @@ SDL_Upsample_U8_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 16;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 8)) * cvt->rate_incr)) * 8;
     register int eps = 0;
     Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 1;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -2333,7 +2333,7 @@ SDL_Downsample_U8_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 16;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 8)) * cvt->rate_incr)) * 8;
     register int eps = 0;
     Uint8 *dst = (Uint8 *) cvt->buf;
     const Uint8 *src = (Uint8 *) cvt->buf;
@@ -2365,7 +2365,7 @@ SDL_Upsample_U8_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 2;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -2402,7 +2402,7 @@ SDL_Downsample_U8_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Uint8 *dst = (Uint8 *) cvt->buf;
     const Uint8 *src = (Uint8 *) cvt->buf;
@@ -2439,7 +2439,7 @@ SDL_Upsample_U8_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 4;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -2486,7 +2486,7 @@ SDL_Downsample_U8_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Uint8 *dst = (Uint8 *) cvt->buf;
     const Uint8 *src = (Uint8 *) cvt->buf;
@@ -2533,7 +2533,7 @@ SDL_Upsample_U8_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 96;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 48)) * cvt->rate_incr)) * 48;
     register int eps = 0;
     Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 6;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -2590,7 +2590,7 @@ SDL_Downsample_U8_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 96;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 48)) * cvt->rate_incr)) * 48;
     register int eps = 0;
     Uint8 *dst = (Uint8 *) cvt->buf;
     const Uint8 *src = (Uint8 *) cvt->buf;
@@ -2647,7 +2647,7 @@ SDL_Upsample_U8_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 8;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -2714,7 +2714,7 @@ SDL_Downsample_U8_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Uint8 *dst = (Uint8 *) cvt->buf;
     const Uint8 *src = (Uint8 *) cvt->buf;
@@ -2781,7 +2781,7 @@ SDL_Upsample_S8_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 16;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 8)) * cvt->rate_incr)) * 8;
     register int eps = 0;
     Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 1;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -2813,7 +2813,7 @@ SDL_Downsample_S8_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 16;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 8)) * cvt->rate_incr)) * 8;
     register int eps = 0;
     Sint8 *dst = (Sint8 *) cvt->buf;
     const Sint8 *src = (Sint8 *) cvt->buf;
@@ -2845,7 +2845,7 @@ SDL_Upsample_S8_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 2;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -2882,7 +2882,7 @@ SDL_Downsample_S8_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Sint8 *dst = (Sint8 *) cvt->buf;
     const Sint8 *src = (Sint8 *) cvt->buf;
@@ -2919,7 +2919,7 @@ SDL_Upsample_S8_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 4;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -2966,7 +2966,7 @@ SDL_Downsample_S8_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint8 *dst = (Sint8 *) cvt->buf;
     const Sint8 *src = (Sint8 *) cvt->buf;
@@ -3013,7 +3013,7 @@ SDL_Upsample_S8_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 96;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 48)) * cvt->rate_incr)) * 48;
     register int eps = 0;
     Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 6;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -3070,7 +3070,7 @@ SDL_Downsample_S8_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 96;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 48)) * cvt->rate_incr)) * 48;
     register int eps = 0;
     Sint8 *dst = (Sint8 *) cvt->buf;
     const Sint8 *src = (Sint8 *) cvt->buf;
@@ -3127,7 +3127,7 @@ SDL_Upsample_S8_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 8;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -3194,7 +3194,7 @@ SDL_Downsample_S8_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint8 *dst = (Sint8 *) cvt->buf;
     const Sint8 *src = (Sint8 *) cvt->buf;
@@ -3261,7 +3261,7 @@ SDL_Upsample_U16LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 1;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -3293,7 +3293,7 @@ SDL_Downsample_U16LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -3325,7 +3325,7 @@ SDL_Upsample_U16LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -3362,7 +3362,7 @@ SDL_Downsample_U16LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -3399,7 +3399,7 @@ SDL_Upsample_U16LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -3446,7 +3446,7 @@ SDL_Downsample_U16LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -3493,7 +3493,7 @@ SDL_Upsample_U16LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 6;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -3550,7 +3550,7 @@ SDL_Downsample_U16LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -3607,7 +3607,7 @@ SDL_Upsample_U16LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -3674,7 +3674,7 @@ SDL_Downsample_U16LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -3741,7 +3741,7 @@ SDL_Upsample_S16LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 1;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -3773,7 +3773,7 @@ SDL_Downsample_S16LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -3805,7 +3805,7 @@ SDL_Upsample_S16LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -3842,7 +3842,7 @@ SDL_Downsample_S16LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -3879,7 +3879,7 @@ SDL_Upsample_S16LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -3926,7 +3926,7 @@ SDL_Downsample_S16LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -3973,7 +3973,7 @@ SDL_Upsample_S16LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 6;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -4030,7 +4030,7 @@ SDL_Downsample_S16LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -4087,7 +4087,7 @@ SDL_Upsample_S16LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -4154,7 +4154,7 @@ SDL_Downsample_S16LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -4221,7 +4221,7 @@ SDL_Upsample_U16MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 1;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -4253,7 +4253,7 @@ SDL_Downsample_U16MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -4285,7 +4285,7 @@ SDL_Upsample_U16MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -4322,7 +4322,7 @@ SDL_Downsample_U16MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -4359,7 +4359,7 @@ SDL_Upsample_U16MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -4406,7 +4406,7 @@ SDL_Downsample_U16MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -4453,7 +4453,7 @@ SDL_Upsample_U16MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 6;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -4510,7 +4510,7 @@ SDL_Downsample_U16MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -4567,7 +4567,7 @@ SDL_Upsample_U16MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -4634,7 +4634,7 @@ SDL_Downsample_U16MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Uint16 *dst = (Uint16 *) cvt->buf;
     const Uint16 *src = (Uint16 *) cvt->buf;
@@ -4701,7 +4701,7 @@ SDL_Upsample_S16MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 1;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -4733,7 +4733,7 @@ SDL_Downsample_S16MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 32;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 16)) * cvt->rate_incr)) * 16;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -4765,7 +4765,7 @@ SDL_Upsample_S16MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -4802,7 +4802,7 @@ SDL_Downsample_S16MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -4839,7 +4839,7 @@ SDL_Upsample_S16MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -4886,7 +4886,7 @@ SDL_Downsample_S16MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -4933,7 +4933,7 @@ SDL_Upsample_S16MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 6;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -4990,7 +4990,7 @@ SDL_Downsample_S16MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 192;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 96)) * cvt->rate_incr)) * 96;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -5047,7 +5047,7 @@ SDL_Upsample_S16MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -5114,7 +5114,7 @@ SDL_Downsample_S16MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint16 *dst = (Sint16 *) cvt->buf;
     const Sint16 *src = (Sint16 *) cvt->buf;
@@ -5181,7 +5181,7 @@ SDL_Upsample_S32LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 1;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -5213,7 +5213,7 @@ SDL_Downsample_S32LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5245,7 +5245,7 @@ SDL_Upsample_S32LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -5282,7 +5282,7 @@ SDL_Downsample_S32LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5319,7 +5319,7 @@ SDL_Upsample_S32LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -5366,7 +5366,7 @@ SDL_Downsample_S32LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5413,7 +5413,7 @@ SDL_Upsample_S32LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 6;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -5470,7 +5470,7 @@ SDL_Downsample_S32LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5527,7 +5527,7 @@ SDL_Upsample_S32LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -5594,7 +5594,7 @@ SDL_Downsample_S32LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5661,7 +5661,7 @@ SDL_Upsample_S32MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 1;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -5693,7 +5693,7 @@ SDL_Downsample_S32MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5725,7 +5725,7 @@ SDL_Upsample_S32MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -5762,7 +5762,7 @@ SDL_Downsample_S32MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5799,7 +5799,7 @@ SDL_Upsample_S32MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -5846,7 +5846,7 @@ SDL_Downsample_S32MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -5893,7 +5893,7 @@ SDL_Upsample_S32MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 6;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -5950,7 +5950,7 @@ SDL_Downsample_S32MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -6007,7 +6007,7 @@ SDL_Upsample_S32MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -6074,7 +6074,7 @@ SDL_Downsample_S32MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     Sint32 *dst = (Sint32 *) cvt->buf;
     const Sint32 *src = (Sint32 *) cvt->buf;
@@ -6141,7 +6141,7 @@ SDL_Upsample_F32LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 1;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -6173,7 +6173,7 @@ SDL_Downsample_F32LSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6205,7 +6205,7 @@ SDL_Upsample_F32LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 2;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -6242,7 +6242,7 @@ SDL_Downsample_F32LSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6279,7 +6279,7 @@ SDL_Upsample_F32LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 4;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -6326,7 +6326,7 @@ SDL_Downsample_F32LSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6373,7 +6373,7 @@ SDL_Upsample_F32LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 6;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -6430,7 +6430,7 @@ SDL_Downsample_F32LSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6487,7 +6487,7 @@ SDL_Upsample_F32LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 8;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -6554,7 +6554,7 @@ SDL_Downsample_F32LSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6621,7 +6621,7 @@ SDL_Upsample_F32MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 1;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 1;
@@ -6653,7 +6653,7 @@ SDL_Downsample_F32MSB_1c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 64;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 32)) * cvt->rate_incr)) * 32;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6685,7 +6685,7 @@ SDL_Upsample_F32MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 2;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 2;
@@ -6722,7 +6722,7 @@ SDL_Downsample_F32MSB_2c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 128;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 64)) * cvt->rate_incr)) * 64;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6759,7 +6759,7 @@ SDL_Upsample_F32MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 4;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 4;
@@ -6806,7 +6806,7 @@ SDL_Downsample_F32MSB_4c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 256;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 128)) * cvt->rate_incr)) * 128;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6853,7 +6853,7 @@ SDL_Upsample_F32MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 6;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 6;
@@ -6910,7 +6910,7 @@ SDL_Downsample_F32MSB_6c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 384;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 192)) * cvt->rate_incr)) * 192;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -6967,7 +6967,7 @@ SDL_Upsample_F32MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     float *dst = ((float *) (cvt->buf + dstsize)) - 8;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 8;
@@ -7034,7 +7034,7 @@ SDL_Downsample_F32MSB_8c(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - 512;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / 256)) * cvt->rate_incr)) * 256;
     register int eps = 0;
     float *dst = (float *) cvt->buf;
     const float *src = (float *) cvt->buf;
@@ -7105,9 +7105,9 @@ SDL_Upsample_U8_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 1;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 2;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 1;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 2;
     Sint16 last_sample0 = (Sint16) src[0];
     while (dst != target) {
         const Sint16 sample0 = (Sint16) src[0];
@@ -7160,9 +7160,9 @@ SDL_Upsample_U8_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 1;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 4;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 1;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 4;
     Sint16 last_sample0 = (Sint16) src[0];
     while (dst != target) {
         const Sint16 sample0 = (Sint16) src[0];
@@ -7217,9 +7217,9 @@ SDL_Upsample_U8_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 2;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 4;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 2;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 4;
     Sint16 last_sample1 = (Sint16) src[1];
     Sint16 last_sample0 = (Sint16) src[0];
     while (dst != target) {
@@ -7281,9 +7281,9 @@ SDL_Upsample_U8_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 2;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 8;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 2;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 8;
     Sint16 last_sample1 = (Sint16) src[1];
     Sint16 last_sample0 = (Sint16) src[0];
     while (dst != target) {
@@ -7349,9 +7349,9 @@ SDL_Upsample_U8_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 4;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 8;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 4;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 8;
     Sint16 last_sample3 = (Sint16) src[3];
     Sint16 last_sample2 = (Sint16) src[2];
     Sint16 last_sample1 = (Sint16) src[1];
@@ -7431,9 +7431,9 @@ SDL_Upsample_U8_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 4;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 16;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 4;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 16;
     Sint16 last_sample3 = (Sint16) src[3];
     Sint16 last_sample2 = (Sint16) src[2];
     Sint16 last_sample1 = (Sint16) src[1];
@@ -7521,9 +7521,9 @@ SDL_Upsample_U8_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 6;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 12;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 6;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 12;
     Sint16 last_sample5 = (Sint16) src[5];
     Sint16 last_sample4 = (Sint16) src[4];
     Sint16 last_sample3 = (Sint16) src[3];
@@ -7621,9 +7621,9 @@ SDL_Upsample_U8_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 6;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 24;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 6;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 24;
     Sint16 last_sample5 = (Sint16) src[5];
     Sint16 last_sample4 = (Sint16) src[4];
     Sint16 last_sample3 = (Sint16) src[3];
@@ -7733,9 +7733,9 @@ SDL_Upsample_U8_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 8;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 16;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 8;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 16;
     Sint16 last_sample7 = (Sint16) src[7];
     Sint16 last_sample6 = (Sint16) src[6];
     Sint16 last_sample5 = (Sint16) src[5];
@@ -7851,9 +7851,9 @@ SDL_Upsample_U8_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 8;
+    Uint8 *dst = ((Uint8 *) (cvt->buf + dstsize)) - 32;
     const Uint8 *src = ((Uint8 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Uint8 *target = ((const Uint8 *) cvt->buf) - 8;
+    const Uint8 *target = ((const Uint8 *) cvt->buf) - 32;
     Sint16 last_sample7 = (Sint16) src[7];
     Sint16 last_sample6 = (Sint16) src[6];
     Sint16 last_sample5 = (Sint16) src[5];
@@ -7985,9 +7985,9 @@ SDL_Upsample_S8_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 1;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 2;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 1;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 2;
     Sint16 last_sample0 = (Sint16) ((Sint8) src[0]);
     while (dst != target) {
         const Sint16 sample0 = (Sint16) ((Sint8) src[0]);
@@ -8040,9 +8040,9 @@ SDL_Upsample_S8_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 1;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 4;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 1;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 4;
     Sint16 last_sample0 = (Sint16) ((Sint8) src[0]);
     while (dst != target) {
         const Sint16 sample0 = (Sint16) ((Sint8) src[0]);
@@ -8097,9 +8097,9 @@ SDL_Upsample_S8_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 2;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 4;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 2;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 4;
     Sint16 last_sample1 = (Sint16) ((Sint8) src[1]);
     Sint16 last_sample0 = (Sint16) ((Sint8) src[0]);
     while (dst != target) {
@@ -8161,9 +8161,9 @@ SDL_Upsample_S8_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 2;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 8;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 2;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 8;
     Sint16 last_sample1 = (Sint16) ((Sint8) src[1]);
     Sint16 last_sample0 = (Sint16) ((Sint8) src[0]);
     while (dst != target) {
@@ -8229,9 +8229,9 @@ SDL_Upsample_S8_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 4;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 8;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 4;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 8;
     Sint16 last_sample3 = (Sint16) ((Sint8) src[3]);
     Sint16 last_sample2 = (Sint16) ((Sint8) src[2]);
     Sint16 last_sample1 = (Sint16) ((Sint8) src[1]);
@@ -8311,9 +8311,9 @@ SDL_Upsample_S8_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 4;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 16;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 4;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 16;
     Sint16 last_sample3 = (Sint16) ((Sint8) src[3]);
     Sint16 last_sample2 = (Sint16) ((Sint8) src[2]);
     Sint16 last_sample1 = (Sint16) ((Sint8) src[1]);
@@ -8401,9 +8401,9 @@ SDL_Upsample_S8_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 6;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 12;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 6;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 12;
     Sint16 last_sample5 = (Sint16) ((Sint8) src[5]);
     Sint16 last_sample4 = (Sint16) ((Sint8) src[4]);
     Sint16 last_sample3 = (Sint16) ((Sint8) src[3]);
@@ -8501,9 +8501,9 @@ SDL_Upsample_S8_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 6;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 24;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 6;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 24;
     Sint16 last_sample5 = (Sint16) ((Sint8) src[5]);
     Sint16 last_sample4 = (Sint16) ((Sint8) src[4]);
     Sint16 last_sample3 = (Sint16) ((Sint8) src[3]);
@@ -8613,9 +8613,9 @@ SDL_Upsample_S8_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 8;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 16;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 8;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 16;
     Sint16 last_sample7 = (Sint16) ((Sint8) src[7]);
     Sint16 last_sample6 = (Sint16) ((Sint8) src[6]);
     Sint16 last_sample5 = (Sint16) ((Sint8) src[5]);
@@ -8731,9 +8731,9 @@ SDL_Upsample_S8_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 8;
+    Sint8 *dst = ((Sint8 *) (cvt->buf + dstsize)) - 32;
     const Sint8 *src = ((Sint8 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint8 *target = ((const Sint8 *) cvt->buf) - 8;
+    const Sint8 *target = ((const Sint8 *) cvt->buf) - 32;
     Sint16 last_sample7 = (Sint16) ((Sint8) src[7]);
     Sint16 last_sample6 = (Sint16) ((Sint8) src[6]);
     Sint16 last_sample5 = (Sint16) ((Sint8) src[5]);
@@ -8865,9 +8865,9 @@ SDL_Upsample_U16LSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 1;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 1;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 2;
     Sint32 last_sample0 = (Sint32) SDL_SwapLE16(src[0]);
     while (dst != target) {
         const Sint32 sample0 = (Sint32) SDL_SwapLE16(src[0]);
@@ -8920,9 +8920,9 @@ SDL_Upsample_U16LSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 1;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 1;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
     Sint32 last_sample0 = (Sint32) SDL_SwapLE16(src[0]);
     while (dst != target) {
         const Sint32 sample0 = (Sint32) SDL_SwapLE16(src[0]);
@@ -8977,9 +8977,9 @@ SDL_Upsample_U16LSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 2;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
     Sint32 last_sample1 = (Sint32) SDL_SwapLE16(src[1]);
     Sint32 last_sample0 = (Sint32) SDL_SwapLE16(src[0]);
     while (dst != target) {
@@ -9041,9 +9041,9 @@ SDL_Upsample_U16LSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 2;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
     Sint32 last_sample1 = (Sint32) SDL_SwapLE16(src[1]);
     Sint32 last_sample0 = (Sint32) SDL_SwapLE16(src[0]);
     while (dst != target) {
@@ -9109,9 +9109,9 @@ SDL_Upsample_U16LSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
     Sint32 last_sample3 = (Sint32) SDL_SwapLE16(src[3]);
     Sint32 last_sample2 = (Sint32) SDL_SwapLE16(src[2]);
     Sint32 last_sample1 = (Sint32) SDL_SwapLE16(src[1]);
@@ -9191,9 +9191,9 @@ SDL_Upsample_U16LSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 16;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 16;
     Sint32 last_sample3 = (Sint32) SDL_SwapLE16(src[3]);
     Sint32 last_sample2 = (Sint32) SDL_SwapLE16(src[2]);
     Sint32 last_sample1 = (Sint32) SDL_SwapLE16(src[1]);
@@ -9281,9 +9281,9 @@ SDL_Upsample_U16LSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 6;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 12;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 6;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 12;
     Sint32 last_sample5 = (Sint32) SDL_SwapLE16(src[5]);
     Sint32 last_sample4 = (Sint32) SDL_SwapLE16(src[4]);
     Sint32 last_sample3 = (Sint32) SDL_SwapLE16(src[3]);
@@ -9381,9 +9381,9 @@ SDL_Upsample_U16LSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 6;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 24;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 6;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 24;
     Sint32 last_sample5 = (Sint32) SDL_SwapLE16(src[5]);
     Sint32 last_sample4 = (Sint32) SDL_SwapLE16(src[4]);
     Sint32 last_sample3 = (Sint32) SDL_SwapLE16(src[3]);
@@ -9493,9 +9493,9 @@ SDL_Upsample_U16LSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 16;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 16;
     Sint32 last_sample7 = (Sint32) SDL_SwapLE16(src[7]);
     Sint32 last_sample6 = (Sint32) SDL_SwapLE16(src[6]);
     Sint32 last_sample5 = (Sint32) SDL_SwapLE16(src[5]);
@@ -9611,9 +9611,9 @@ SDL_Upsample_U16LSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 32;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 32;
     Sint32 last_sample7 = (Sint32) SDL_SwapLE16(src[7]);
     Sint32 last_sample6 = (Sint32) SDL_SwapLE16(src[6]);
     Sint32 last_sample5 = (Sint32) SDL_SwapLE16(src[5]);
@@ -9745,9 +9745,9 @@ SDL_Upsample_S16LSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 1;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 1;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 2;
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapLE16(src[0]));
     while (dst != target) {
         const Sint32 sample0 = (Sint32) ((Sint16) SDL_SwapLE16(src[0]));
@@ -9800,9 +9800,9 @@ SDL_Upsample_S16LSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 1;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 1;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapLE16(src[0]));
     while (dst != target) {
         const Sint32 sample0 = (Sint32) ((Sint16) SDL_SwapLE16(src[0]));
@@ -9857,9 +9857,9 @@ SDL_Upsample_S16LSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 2;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapLE16(src[1]));
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapLE16(src[0]));
     while (dst != target) {
@@ -9921,9 +9921,9 @@ SDL_Upsample_S16LSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 2;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapLE16(src[1]));
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapLE16(src[0]));
     while (dst != target) {
@@ -9989,9 +9989,9 @@ SDL_Upsample_S16LSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapLE16(src[3]));
     Sint32 last_sample2 = (Sint32) ((Sint16) SDL_SwapLE16(src[2]));
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapLE16(src[1]));
@@ -10071,9 +10071,9 @@ SDL_Upsample_S16LSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 16;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 16;
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapLE16(src[3]));
     Sint32 last_sample2 = (Sint32) ((Sint16) SDL_SwapLE16(src[2]));
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapLE16(src[1]));
@@ -10161,9 +10161,9 @@ SDL_Upsample_S16LSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 6;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 12;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 6;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 12;
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapLE16(src[5]));
     Sint32 last_sample4 = (Sint32) ((Sint16) SDL_SwapLE16(src[4]));
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapLE16(src[3]));
@@ -10261,9 +10261,9 @@ SDL_Upsample_S16LSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 6;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 24;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 6;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 24;
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapLE16(src[5]));
     Sint32 last_sample4 = (Sint32) ((Sint16) SDL_SwapLE16(src[4]));
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapLE16(src[3]));
@@ -10373,9 +10373,9 @@ SDL_Upsample_S16LSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 16;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 16;
     Sint32 last_sample7 = (Sint32) ((Sint16) SDL_SwapLE16(src[7]));
     Sint32 last_sample6 = (Sint32) ((Sint16) SDL_SwapLE16(src[6]));
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapLE16(src[5]));
@@ -10491,9 +10491,9 @@ SDL_Upsample_S16LSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 32;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 32;
     Sint32 last_sample7 = (Sint32) ((Sint16) SDL_SwapLE16(src[7]));
     Sint32 last_sample6 = (Sint32) ((Sint16) SDL_SwapLE16(src[6]));
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapLE16(src[5]));
@@ -10625,9 +10625,9 @@ SDL_Upsample_U16MSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 1;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 1;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 2;
     Sint32 last_sample0 = (Sint32) SDL_SwapBE16(src[0]);
     while (dst != target) {
         const Sint32 sample0 = (Sint32) SDL_SwapBE16(src[0]);
@@ -10680,9 +10680,9 @@ SDL_Upsample_U16MSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 1;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 1;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
     Sint32 last_sample0 = (Sint32) SDL_SwapBE16(src[0]);
     while (dst != target) {
         const Sint32 sample0 = (Sint32) SDL_SwapBE16(src[0]);
@@ -10737,9 +10737,9 @@ SDL_Upsample_U16MSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 2;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
     Sint32 last_sample1 = (Sint32) SDL_SwapBE16(src[1]);
     Sint32 last_sample0 = (Sint32) SDL_SwapBE16(src[0]);
     while (dst != target) {
@@ -10801,9 +10801,9 @@ SDL_Upsample_U16MSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 2;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 2;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
     Sint32 last_sample1 = (Sint32) SDL_SwapBE16(src[1]);
     Sint32 last_sample0 = (Sint32) SDL_SwapBE16(src[0]);
     while (dst != target) {
@@ -10869,9 +10869,9 @@ SDL_Upsample_U16MSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
     Sint32 last_sample3 = (Sint32) SDL_SwapBE16(src[3]);
     Sint32 last_sample2 = (Sint32) SDL_SwapBE16(src[2]);
     Sint32 last_sample1 = (Sint32) SDL_SwapBE16(src[1]);
@@ -10951,9 +10951,9 @@ SDL_Upsample_U16MSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 4;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 16;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 4;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 16;
     Sint32 last_sample3 = (Sint32) SDL_SwapBE16(src[3]);
     Sint32 last_sample2 = (Sint32) SDL_SwapBE16(src[2]);
     Sint32 last_sample1 = (Sint32) SDL_SwapBE16(src[1]);
@@ -11041,9 +11041,9 @@ SDL_Upsample_U16MSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 6;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 12;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 6;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 12;
     Sint32 last_sample5 = (Sint32) SDL_SwapBE16(src[5]);
     Sint32 last_sample4 = (Sint32) SDL_SwapBE16(src[4]);
     Sint32 last_sample3 = (Sint32) SDL_SwapBE16(src[3]);
@@ -11141,9 +11141,9 @@ SDL_Upsample_U16MSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 6;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 24;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 6;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 24;
     Sint32 last_sample5 = (Sint32) SDL_SwapBE16(src[5]);
     Sint32 last_sample4 = (Sint32) SDL_SwapBE16(src[4]);
     Sint32 last_sample3 = (Sint32) SDL_SwapBE16(src[3]);
@@ -11253,9 +11253,9 @@ SDL_Upsample_U16MSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 16;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 16;
     Sint32 last_sample7 = (Sint32) SDL_SwapBE16(src[7]);
     Sint32 last_sample6 = (Sint32) SDL_SwapBE16(src[6]);
     Sint32 last_sample5 = (Sint32) SDL_SwapBE16(src[5]);
@@ -11371,9 +11371,9 @@ SDL_Upsample_U16MSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 8;
+    Uint16 *dst = ((Uint16 *) (cvt->buf + dstsize)) - 32;
     const Uint16 *src = ((Uint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Uint16 *target = ((const Uint16 *) cvt->buf) - 8;
+    const Uint16 *target = ((const Uint16 *) cvt->buf) - 32;
     Sint32 last_sample7 = (Sint32) SDL_SwapBE16(src[7]);
     Sint32 last_sample6 = (Sint32) SDL_SwapBE16(src[6]);
     Sint32 last_sample5 = (Sint32) SDL_SwapBE16(src[5]);
@@ -11505,9 +11505,9 @@ SDL_Upsample_S16MSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 1;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 1;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 2;
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapBE16(src[0]));
     while (dst != target) {
         const Sint32 sample0 = (Sint32) ((Sint16) SDL_SwapBE16(src[0]));
@@ -11560,9 +11560,9 @@ SDL_Upsample_S16MSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 1;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 1;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapBE16(src[0]));
     while (dst != target) {
         const Sint32 sample0 = (Sint32) ((Sint16) SDL_SwapBE16(src[0]));
@@ -11617,9 +11617,9 @@ SDL_Upsample_S16MSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 2;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapBE16(src[1]));
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapBE16(src[0]));
     while (dst != target) {
@@ -11681,9 +11681,9 @@ SDL_Upsample_S16MSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 2;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 2;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapBE16(src[1]));
     Sint32 last_sample0 = (Sint32) ((Sint16) SDL_SwapBE16(src[0]));
     while (dst != target) {
@@ -11749,9 +11749,9 @@ SDL_Upsample_S16MSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapBE16(src[3]));
     Sint32 last_sample2 = (Sint32) ((Sint16) SDL_SwapBE16(src[2]));
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapBE16(src[1]));
@@ -11831,9 +11831,9 @@ SDL_Upsample_S16MSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 4;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 16;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 4;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 16;
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapBE16(src[3]));
     Sint32 last_sample2 = (Sint32) ((Sint16) SDL_SwapBE16(src[2]));
     Sint32 last_sample1 = (Sint32) ((Sint16) SDL_SwapBE16(src[1]));
@@ -11921,9 +11921,9 @@ SDL_Upsample_S16MSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 6;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 12;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 6;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 12;
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapBE16(src[5]));
     Sint32 last_sample4 = (Sint32) ((Sint16) SDL_SwapBE16(src[4]));
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapBE16(src[3]));
@@ -12021,9 +12021,9 @@ SDL_Upsample_S16MSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 6;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 24;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 6;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 24;
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapBE16(src[5]));
     Sint32 last_sample4 = (Sint32) ((Sint16) SDL_SwapBE16(src[4]));
     Sint32 last_sample3 = (Sint32) ((Sint16) SDL_SwapBE16(src[3]));
@@ -12133,9 +12133,9 @@ SDL_Upsample_S16MSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 16;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 16;
     Sint32 last_sample7 = (Sint32) ((Sint16) SDL_SwapBE16(src[7]));
     Sint32 last_sample6 = (Sint32) ((Sint16) SDL_SwapBE16(src[6]));
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapBE16(src[5]));
@@ -12251,9 +12251,9 @@ SDL_Upsample_S16MSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 8;
+    Sint16 *dst = ((Sint16 *) (cvt->buf + dstsize)) - 32;
     const Sint16 *src = ((Sint16 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint16 *target = ((const Sint16 *) cvt->buf) - 8;
+    const Sint16 *target = ((const Sint16 *) cvt->buf) - 32;
     Sint32 last_sample7 = (Sint32) ((Sint16) SDL_SwapBE16(src[7]));
     Sint32 last_sample6 = (Sint32) ((Sint16) SDL_SwapBE16(src[6]));
     Sint32 last_sample5 = (Sint32) ((Sint16) SDL_SwapBE16(src[5]));
@@ -12385,9 +12385,9 @@ SDL_Upsample_S32LSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 1;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 1;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 2;
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapLE32(src[0]));
     while (dst != target) {
         const Sint64 sample0 = (Sint64) ((Sint32) SDL_SwapLE32(src[0]));
@@ -12440,9 +12440,9 @@ SDL_Upsample_S32LSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 1;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 1;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapLE32(src[0]));
     while (dst != target) {
         const Sint64 sample0 = (Sint64) ((Sint32) SDL_SwapLE32(src[0]));
@@ -12497,9 +12497,9 @@ SDL_Upsample_S32LSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 2;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapLE32(src[1]));
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapLE32(src[0]));
     while (dst != target) {
@@ -12561,9 +12561,9 @@ SDL_Upsample_S32LSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 2;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapLE32(src[1]));
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapLE32(src[0]));
     while (dst != target) {
@@ -12629,9 +12629,9 @@ SDL_Upsample_S32LSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapLE32(src[3]));
     Sint64 last_sample2 = (Sint64) ((Sint32) SDL_SwapLE32(src[2]));
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapLE32(src[1]));
@@ -12711,9 +12711,9 @@ SDL_Upsample_S32LSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 16;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 16;
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapLE32(src[3]));
     Sint64 last_sample2 = (Sint64) ((Sint32) SDL_SwapLE32(src[2]));
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapLE32(src[1]));
@@ -12801,9 +12801,9 @@ SDL_Upsample_S32LSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 6;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 12;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 6;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 12;
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapLE32(src[5]));
     Sint64 last_sample4 = (Sint64) ((Sint32) SDL_SwapLE32(src[4]));
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapLE32(src[3]));
@@ -12901,9 +12901,9 @@ SDL_Upsample_S32LSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 6;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 24;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 6;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 24;
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapLE32(src[5]));
     Sint64 last_sample4 = (Sint64) ((Sint32) SDL_SwapLE32(src[4]));
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapLE32(src[3]));
@@ -13013,9 +13013,9 @@ SDL_Upsample_S32LSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 16;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 16;
     Sint64 last_sample7 = (Sint64) ((Sint32) SDL_SwapLE32(src[7]));
     Sint64 last_sample6 = (Sint64) ((Sint32) SDL_SwapLE32(src[6]));
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapLE32(src[5]));
@@ -13131,9 +13131,9 @@ SDL_Upsample_S32LSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 32;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 32;
     Sint64 last_sample7 = (Sint64) ((Sint32) SDL_SwapLE32(src[7]));
     Sint64 last_sample6 = (Sint64) ((Sint32) SDL_SwapLE32(src[6]));
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapLE32(src[5]));
@@ -13265,9 +13265,9 @@ SDL_Upsample_S32MSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 1;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 1;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 2;
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapBE32(src[0]));
     while (dst != target) {
         const Sint64 sample0 = (Sint64) ((Sint32) SDL_SwapBE32(src[0]));
@@ -13320,9 +13320,9 @@ SDL_Upsample_S32MSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 1;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 1;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 1;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapBE32(src[0]));
     while (dst != target) {
         const Sint64 sample0 = (Sint64) ((Sint32) SDL_SwapBE32(src[0]));
@@ -13377,9 +13377,9 @@ SDL_Upsample_S32MSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 2;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapBE32(src[1]));
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapBE32(src[0]));
     while (dst != target) {
@@ -13441,9 +13441,9 @@ SDL_Upsample_S32MSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 2;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 2;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 2;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapBE32(src[1]));
     Sint64 last_sample0 = (Sint64) ((Sint32) SDL_SwapBE32(src[0]));
     while (dst != target) {
@@ -13509,9 +13509,9 @@ SDL_Upsample_S32MSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapBE32(src[3]));
     Sint64 last_sample2 = (Sint64) ((Sint32) SDL_SwapBE32(src[2]));
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapBE32(src[1]));
@@ -13591,9 +13591,9 @@ SDL_Upsample_S32MSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 4;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 16;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 4;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 4;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 16;
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapBE32(src[3]));
     Sint64 last_sample2 = (Sint64) ((Sint32) SDL_SwapBE32(src[2]));
     Sint64 last_sample1 = (Sint64) ((Sint32) SDL_SwapBE32(src[1]));
@@ -13681,9 +13681,9 @@ SDL_Upsample_S32MSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 6;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 12;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 6;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 12;
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapBE32(src[5]));
     Sint64 last_sample4 = (Sint64) ((Sint32) SDL_SwapBE32(src[4]));
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapBE32(src[3]));
@@ -13781,9 +13781,9 @@ SDL_Upsample_S32MSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 6;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 24;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 6;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 6;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 24;
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapBE32(src[5]));
     Sint64 last_sample4 = (Sint64) ((Sint32) SDL_SwapBE32(src[4]));
     Sint64 last_sample3 = (Sint64) ((Sint32) SDL_SwapBE32(src[3]));
@@ -13893,9 +13893,9 @@ SDL_Upsample_S32MSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 16;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 16;
     Sint64 last_sample7 = (Sint64) ((Sint32) SDL_SwapBE32(src[7]));
     Sint64 last_sample6 = (Sint64) ((Sint32) SDL_SwapBE32(src[6]));
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapBE32(src[5]));
@@ -14011,9 +14011,9 @@ SDL_Upsample_S32MSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 8;
+    Sint32 *dst = ((Sint32 *) (cvt->buf + dstsize)) - 32;
     const Sint32 *src = ((Sint32 *) (cvt->buf + cvt->len_cvt)) - 8;
-    const Sint32 *target = ((const Sint32 *) cvt->buf) - 8;
+    const Sint32 *target = ((const Sint32 *) cvt->buf) - 32;
     Sint64 last_sample7 = (Sint64) ((Sint32) SDL_SwapBE32(src[7]));
     Sint64 last_sample6 = (Sint64) ((Sint32) SDL_SwapBE32(src[6]));
     Sint64 last_sample5 = (Sint64) ((Sint32) SDL_SwapBE32(src[5]));
@@ -14145,9 +14145,9 @@ SDL_Upsample_F32LSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 1;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 2;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 1;
-    const float *target = ((const float *) cvt->buf) - 1;
+    const float *target = ((const float *) cvt->buf) - 2;
     double last_sample0 = (double) SDL_SwapFloatLE(src[0]);
     while (dst != target) {
         const double sample0 = (double) SDL_SwapFloatLE(src[0]);
@@ -14200,9 +14200,9 @@ SDL_Upsample_F32LSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 1;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 1;
-    const float *target = ((const float *) cvt->buf) - 1;
+    const float *target = ((const float *) cvt->buf) - 4;
     double last_sample0 = (double) SDL_SwapFloatLE(src[0]);
     while (dst != target) {
         const double sample0 = (double) SDL_SwapFloatLE(src[0]);
@@ -14257,9 +14257,9 @@ SDL_Upsample_F32LSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 2;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 2;
-    const float *target = ((const float *) cvt->buf) - 2;
+    const float *target = ((const float *) cvt->buf) - 4;
     double last_sample1 = (double) SDL_SwapFloatLE(src[1]);
     double last_sample0 = (double) SDL_SwapFloatLE(src[0]);
     while (dst != target) {
@@ -14321,9 +14321,9 @@ SDL_Upsample_F32LSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 2;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 2;
-    const float *target = ((const float *) cvt->buf) - 2;
+    const float *target = ((const float *) cvt->buf) - 8;
     double last_sample1 = (double) SDL_SwapFloatLE(src[1]);
     double last_sample0 = (double) SDL_SwapFloatLE(src[0]);
     while (dst != target) {
@@ -14389,9 +14389,9 @@ SDL_Upsample_F32LSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 4;
-    const float *target = ((const float *) cvt->buf) - 4;
+    const float *target = ((const float *) cvt->buf) - 8;
     double last_sample3 = (double) SDL_SwapFloatLE(src[3]);
     double last_sample2 = (double) SDL_SwapFloatLE(src[2]);
     double last_sample1 = (double) SDL_SwapFloatLE(src[1]);
@@ -14471,9 +14471,9 @@ SDL_Upsample_F32LSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 16;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 4;
-    const float *target = ((const float *) cvt->buf) - 4;
+    const float *target = ((const float *) cvt->buf) - 16;
     double last_sample3 = (double) SDL_SwapFloatLE(src[3]);
     double last_sample2 = (double) SDL_SwapFloatLE(src[2]);
     double last_sample1 = (double) SDL_SwapFloatLE(src[1]);
@@ -14561,9 +14561,9 @@ SDL_Upsample_F32LSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 6;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 12;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 6;
-    const float *target = ((const float *) cvt->buf) - 6;
+    const float *target = ((const float *) cvt->buf) - 12;
     double last_sample5 = (double) SDL_SwapFloatLE(src[5]);
     double last_sample4 = (double) SDL_SwapFloatLE(src[4]);
     double last_sample3 = (double) SDL_SwapFloatLE(src[3]);
@@ -14661,9 +14661,9 @@ SDL_Upsample_F32LSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 6;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 24;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 6;
-    const float *target = ((const float *) cvt->buf) - 6;
+    const float *target = ((const float *) cvt->buf) - 24;
     double last_sample5 = (double) SDL_SwapFloatLE(src[5]);
     double last_sample4 = (double) SDL_SwapFloatLE(src[4]);
     double last_sample3 = (double) SDL_SwapFloatLE(src[3]);
@@ -14773,9 +14773,9 @@ SDL_Upsample_F32LSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 16;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 8;
-    const float *target = ((const float *) cvt->buf) - 8;
+    const float *target = ((const float *) cvt->buf) - 16;
     double last_sample7 = (double) SDL_SwapFloatLE(src[7]);
     double last_sample6 = (double) SDL_SwapFloatLE(src[6]);
     double last_sample5 = (double) SDL_SwapFloatLE(src[5]);
@@ -14891,9 +14891,9 @@ SDL_Upsample_F32LSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 32;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 8;
-    const float *target = ((const float *) cvt->buf) - 8;
+    const float *target = ((const float *) cvt->buf) - 32;
     double last_sample7 = (double) SDL_SwapFloatLE(src[7]);
     double last_sample6 = (double) SDL_SwapFloatLE(src[6]);
     double last_sample5 = (double) SDL_SwapFloatLE(src[5]);
@@ -15025,9 +15025,9 @@ SDL_Upsample_F32MSB_1c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 1;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 2;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 1;
-    const float *target = ((const float *) cvt->buf) - 1;
+    const float *target = ((const float *) cvt->buf) - 2;
     double last_sample0 = (double) SDL_SwapFloatBE(src[0]);
     while (dst != target) {
         const double sample0 = (double) SDL_SwapFloatBE(src[0]);
@@ -15080,9 +15080,9 @@ SDL_Upsample_F32MSB_1c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 1;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 1;
-    const float *target = ((const float *) cvt->buf) - 1;
+    const float *target = ((const float *) cvt->buf) - 4;
     double last_sample0 = (double) SDL_SwapFloatBE(src[0]);
     while (dst != target) {
         const double sample0 = (double) SDL_SwapFloatBE(src[0]);
@@ -15137,9 +15137,9 @@ SDL_Upsample_F32MSB_2c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 2;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 2;
-    const float *target = ((const float *) cvt->buf) - 2;
+    const float *target = ((const float *) cvt->buf) - 4;
     double last_sample1 = (double) SDL_SwapFloatBE(src[1]);
     double last_sample0 = (double) SDL_SwapFloatBE(src[0]);
     while (dst != target) {
@@ -15201,9 +15201,9 @@ SDL_Upsample_F32MSB_2c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 2;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 2;
-    const float *target = ((const float *) cvt->buf) - 2;
+    const float *target = ((const float *) cvt->buf) - 8;
     double last_sample1 = (double) SDL_SwapFloatBE(src[1]);
     double last_sample0 = (double) SDL_SwapFloatBE(src[0]);
     while (dst != target) {
@@ -15269,9 +15269,9 @@ SDL_Upsample_F32MSB_4c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 4;
-    const float *target = ((const float *) cvt->buf) - 4;
+    const float *target = ((const float *) cvt->buf) - 8;
     double last_sample3 = (double) SDL_SwapFloatBE(src[3]);
     double last_sample2 = (double) SDL_SwapFloatBE(src[2]);
     double last_sample1 = (double) SDL_SwapFloatBE(src[1]);
@@ -15351,9 +15351,9 @@ SDL_Upsample_F32MSB_4c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 4;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 16;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 4;
-    const float *target = ((const float *) cvt->buf) - 4;
+    const float *target = ((const float *) cvt->buf) - 16;
     double last_sample3 = (double) SDL_SwapFloatBE(src[3]);
     double last_sample2 = (double) SDL_SwapFloatBE(src[2]);
     double last_sample1 = (double) SDL_SwapFloatBE(src[1]);
@@ -15441,9 +15441,9 @@ SDL_Upsample_F32MSB_6c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 6;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 12;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 6;
-    const float *target = ((const float *) cvt->buf) - 6;
+    const float *target = ((const float *) cvt->buf) - 12;
     double last_sample5 = (double) SDL_SwapFloatBE(src[5]);
     double last_sample4 = (double) SDL_SwapFloatBE(src[4]);
     double last_sample3 = (double) SDL_SwapFloatBE(src[3]);
@@ -15541,9 +15541,9 @@ SDL_Upsample_F32MSB_6c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 6;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 24;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 6;
-    const float *target = ((const float *) cvt->buf) - 6;
+    const float *target = ((const float *) cvt->buf) - 24;
     double last_sample5 = (double) SDL_SwapFloatBE(src[5]);
     double last_sample4 = (double) SDL_SwapFloatBE(src[4]);
     double last_sample3 = (double) SDL_SwapFloatBE(src[3]);
@@ -15653,9 +15653,9 @@ SDL_Upsample_F32MSB_8c_x2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 2;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 16;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 8;
-    const float *target = ((const float *) cvt->buf) - 8;
+    const float *target = ((const float *) cvt->buf) - 16;
     double last_sample7 = (double) SDL_SwapFloatBE(src[7]);
     double last_sample6 = (double) SDL_SwapFloatBE(src[6]);
     double last_sample5 = (double) SDL_SwapFloatBE(src[5]);
@@ -15771,9 +15771,9 @@ SDL_Upsample_F32MSB_8c_x4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 
     const int srcsize = cvt->len_cvt;
     const int dstsize = cvt->len_cvt * 4;
-    float *dst = ((float *) (cvt->buf + dstsize)) - 8;
+    float *dst = ((float *) (cvt->buf + dstsize)) - 32;
     const float *src = ((float *) (cvt->buf + cvt->len_cvt)) - 8;
-    const float *target = ((const float *) cvt->buf) - 8;
+    const float *target = ((const float *) cvt->buf) - 32;
     double last_sample7 = (double) SDL_SwapFloatBE(src[7]);
     double last_sample6 = (double) SDL_SwapFloatBE(src[6]);
     double last_sample5 = (double) SDL_SwapFloatBE(src[5]);
@@ -29,6 +29,7 @@
 #include "SDL_sysaudio.h"
 #include "SDL_mixer_MMX.h"
 #include "SDL_mixer_MMX_VC.h"
+#include "SDL_mixer_SSE.h"
 #include "SDL_mixer_m68k.h"
 
 /* This table is used to add two sound values together and pin
@@ -98,6 +99,16 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+#ifdef SDL_MIXER_SSE2
+    /* The vector code does what it can, the loops below finish the rest */
+    {
+        const Uint32 mixed = SDL_MixAudio_SSE(dst, src, format, len, volume);
+        dst += mixed;
+        src += mixed;
+        len -= mixed;
+    }
+#endif
+
     switch (format) {
 
     case AUDIO_U8:
@@ -0,0 +1,391 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* SSE2 and AVX2 versions of SDL_MixAudio for 16 bit, 32 bit and float
+   samples, in either byte order.
+
+   These match the C loops in SDL_mixer.c bit for bit: the volume is
+   applied with a division that truncates toward zero, integer sums
+   saturate, and float sums are clamped to +/-FLT_MAX (a sum of two floats
+   rounds the same in single precision as through a double).
+ */
+
+#include "SDL_cpuinfo.h"
+#include "SDL_audio.h"
+#include "SDL_mixer_SSE.h"
+
+#ifdef SDL_MIXER_SSE2
+
+#include <emmintrin.h>
+#ifdef SDL_MIXER_AVX2
+#include <immintrin.h>
+#endif
+
+#define SDL_FLOAT_MAX   3.402823466e+38F
+
+/***********************************************
+*   SSE2, 16 bytes per iteration
+***********************************************/
+
+static __inline__ __m128i
+SDL_Swap16_SSE2(__m128i x)
+{
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+static __inline__ __m128i
+SDL_Swap32_SSE2(__m128i x)
+{
+    x = SDL_Swap16_SSE2(x);
+    x = _mm_shufflelo_epi16(x, 0xB1);
+    return _mm_shufflehi_epi16(x, 0xB1);
+}
+
+/* x / SDL_MIX_MAXVOLUME, rounding toward zero like C does */
+static __inline__ __m128i
+SDL_Div128_SSE2(__m128i x)
+{
+    const __m128i bias = _mm_srli_epi32(_mm_srai_epi32(x, 31), 25);
+    return _mm_srai_epi32(_mm_add_epi32(x, bias), 7);
+}
+
+static void
+SDL_MixS16_SSE2(Uint8 * dst, const Uint8 * src, Uint32 count, int volume,
+                int swap)
+{
+    const __m128i vol = _mm_set1_epi16((short) volume);
+
+    while (count--) {
+        __m128i s = _mm_loadu_si128((const __m128i *) src);
+        __m128i d = _mm_loadu_si128((const __m128i *) dst);
+        if (swap) {
+            s = SDL_Swap16_SSE2(s);
+            d = SDL_Swap16_SSE2(d);
+        }
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m128i lo = _mm_mullo_epi16(s, vol);
+            const __m128i hi = _mm_mulhi_epi16(s, vol);
+            s = _mm_packs_epi32(SDL_Div128_SSE2(_mm_unpacklo_epi16(lo, hi)),
+                                SDL_Div128_SSE2(_mm_unpackhi_epi16(lo, hi)));
+        }
+        d = _mm_adds_epi16(d, s);
+        if (swap) {
+            d = SDL_Swap16_SSE2(d);
+        }
+        _mm_storeu_si128((__m128i *) dst, d);
+        src += 16;
+        dst += 16;
+    }
+}
+
+/* Low 32 bits of a 32x32 bit multiply, which SSE2 only has for 2 lanes */
+static __inline__ __m128i
+SDL_Mul32_SSE2(__m128i a, __m128i b)
+{
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32),
+                                      _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08),
+                              _mm_shuffle_epi32(odd, 0x08));
+}
+
+static void
+SDL_MixS32_SSE2(Uint8 * dst, const Uint8 * src, Uint32 count, int volume,
+                int swap)
+{
+    const __m128i vol = _mm_set1_epi32(volume);
+    const __m128i low7 = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const __m128i max = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i zero = _mm_setzero_si128();
+
+    while (count--) {
+        __m128i s = _mm_loadu_si128((const __m128i *) src);
+        __m128i d = _mm_loadu_si128((const __m128i *) dst);
+        __m128i sum, mask;
+        if (swap) {
+            s = SDL_Swap32_SSE2(s);
+            d = SDL_Swap32_SSE2(d);
+        }
+        if (volume != SDL_MIX_MAXVOLUME) {
+            /* s = 128*q + r, so s*v/128 = q*v + r*v/128 without needing
+               64 bits, then round negative inexact results up */
+            const __m128i rv = _mm_mullo_epi16(_mm_and_si128(s, low7), vol);
+            const __m128i inexact =
+                _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(rv, low7),
+                                                 zero), one);
+            const __m128i q = SDL_Mul32_SSE2(_mm_srai_epi32(s, 7), vol);
+            s = _mm_add_epi32(_mm_add_epi32(q, _mm_srai_epi32(rv, 7)),
+                              _mm_and_si128(inexact, _mm_srai_epi32(s, 31)));
+        }
+        /* Saturate where the signs of both inputs differ from the sum */
+        sum = _mm_add_epi32(d, s);
+        mask = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(d, sum),
+                                            _mm_xor_si128(s, sum)), 31);
+        d = _mm_or_si128(_mm_andnot_si128(mask, sum),
+                         _mm_and_si128(mask,
+                                       _mm_xor_si128(_mm_srai_epi32(d, 31),
+                                                     max)));
+        if (swap) {
+            d = SDL_Swap32_SSE2(d);
+        }
+        _mm_storeu_si128((__m128i *) dst, d);
+        src += 16;
+        dst += 16;
+    }
+}
+
+static void
+SDL_MixF32_SSE2(Uint8 * dst, const Uint8 * src, Uint32 count, int volume,
+                int swap)
+{
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 max = _mm_set1_ps(SDL_FLOAT_MAX);
+    const __m128 min = _mm_set1_ps(-SDL_FLOAT_MAX);
+
+    while (count--) {
+        __m128i s = _mm_loadu_si128((const __m128i *) src);
+        __m128i d = _mm_loadu_si128((const __m128i *) dst);
+        __m128 sum;
+        if (swap) {
+            s = SDL_Swap32_SSE2(s);
+            d = SDL_Swap32_SSE2(d);
+        }
+        sum = _mm_mul_ps(_mm_mul_ps(_mm_castsi128_ps(s), fvolume),
+                         fmaxvolume);
+        sum = _mm_add_ps(sum, _mm_castsi128_ps(d));
+        /* Operands in this order so NaN passes through as in C */
+        sum = _mm_max_ps(min, _mm_min_ps(max, sum));
+        d = _mm_castps_si128(sum);
+        if (swap) {
+            d = SDL_Swap32_SSE2(d);
+        }
+        _mm_storeu_si128((__m128i *) dst, d);
+        src += 16;
+        dst += 16;
+    }
+}
+
+/***********************************************
+*   AVX2, 32 bytes per iteration
+***********************************************/
+
+#ifdef SDL_MIXER_AVX2
+
+#define SDL_TARGET_AVX2 __attribute__((target("avx2")))
+
+static __inline__ SDL_TARGET_AVX2 __m256i
+SDL_Swap_AVX2(__m256i x, int size)
+{
+    const __m256i swap16 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                            9, 8, 11, 10, 13, 12, 15, 14,
+                                            1, 0, 3, 2, 5, 4, 7, 6,
+                                            9, 8, 11, 10, 13, 12, 15, 14);
+    const __m256i swap32 = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                            11, 10, 9, 8, 15, 14, 13, 12,
+                                            3, 2, 1, 0, 7, 6, 5, 4,
+                                            11, 10, 9, 8, 15, 14, 13, 12);
+    return _mm256_shuffle_epi8(x, (size == 2) ? swap16 : swap32);
+}
+
+static __inline__ SDL_TARGET_AVX2 __m256i
+SDL_Div128_AVX2(__m256i x)
+{
+    const __m256i bias = _mm256_srli_epi32(_mm256_srai_epi32(x, 31), 25);
+    return _mm256_srai_epi32(_mm256_add_epi32(x, bias), 7);
+}
+
+static SDL_TARGET_AVX2 void
+SDL_MixS16_AVX2(Uint8 * dst, const Uint8 * src, Uint32 count, int volume,
+                int swap)
+{
+    const __m256i vol = _mm256_set1_epi16((short) volume);
+
+    while (count--) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) src);
+        __m256i d = _mm256_loadu_si256((const __m256i *) dst);
+        if (swap) {
+            s = SDL_Swap_AVX2(s, 2);
+            d = SDL_Swap_AVX2(d, 2);
+        }
+        if (volume != SDL_MIX_MAXVOLUME) {
+            /* unpack and pack both work within 128 bit lanes */
+            const __m256i lo = _mm256_mullo_epi16(s, vol);
+            const __m256i hi = _mm256_mulhi_epi16(s, vol);
+            s = _mm256_packs_epi32(SDL_Div128_AVX2
+                                   (_mm256_unpacklo_epi16(lo, hi)),
+                                   SDL_Div128_AVX2(_mm256_unpackhi_epi16
+                                                   (lo, hi)));
+        }
+        d = _mm256_adds_epi16(d, s);
+        if (swap) {
+            d = SDL_Swap_AVX2(d, 2);
+        }
+        _mm256_storeu_si256((__m256i *) dst, d);
+        src += 32;
+        dst += 32;
+    }
+}
+
+static SDL_TARGET_AVX2 void
+SDL_MixS32_AVX2(Uint8 * dst, const Uint8 * src, Uint32 count, int volume,
+                int swap)
+{
+    const __m256i vol = _mm256_set1_epi32(volume);
+    const __m256i low7 = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const __m256i max = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (count--) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) src);
+        __m256i d = _mm256_loadu_si256((const __m256i *) dst);
+        __m256i sum, mask;
+        if (swap) {
+            s = SDL_Swap_AVX2(s, 4);
+            d = SDL_Swap_AVX2(d, 4);
+        }
+        if (volume != SDL_MIX_MAXVOLUME) {
+            const __m256i rv =
+                _mm256_mullo_epi16(_mm256_and_si256(s, low7), vol);
+            const __m256i inexact =
+                _mm256_andnot_si256(_mm256_cmpeq_epi32
+                                    (_mm256_and_si256(rv, low7), zero), one);
+            const __m256i q =
+                _mm256_mullo_epi32(_mm256_srai_epi32(s, 7), vol);
+            s = _mm256_add_epi32(_mm256_add_epi32(q,
+                                                  _mm256_srai_epi32(rv, 7)),
+                                 _mm256_and_si256(inexact,
+                                                  _mm256_srai_epi32(s, 31)));
+        }
+        sum = _mm256_add_epi32(d, s);
+        mask = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(d, sum),
+                                                  _mm256_xor_si256(s, sum)),
+                                 31);
+        d = _mm256_blendv_epi8(sum,
+                               _mm256_xor_si256(_mm256_srai_epi32(d, 31),
+                                                max), mask);
+        if (swap) {
+            d = SDL_Swap_AVX2(d, 4);
+        }
+        _mm256_storeu_si256((__m256i *) dst, d);
+        src += 32;
+        dst += 32;
+    }
+}
+
+static SDL_TARGET_AVX2 void
+SDL_MixF32_AVX2(Uint8 * dst, const Uint8 * src, Uint32 count, int volume,
+                int swap)
+{
+    const __m256 fvolume = _mm256_set1_ps((float) volume);
+    const __m256 fmaxvolume =
+        _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m256 max = _mm256_set1_ps(SDL_FLOAT_MAX);
+    const __m256 min = _mm256_set1_ps(-SDL_FLOAT_MAX);
+
+    while (count--) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) src);
+        __m256i d = _mm256_loadu_si256((const __m256i *) dst);
+        __m256 sum;
+        if (swap) {
+            s = SDL_Swap_AVX2(s, 4);
+            d = SDL_Swap_AVX2(d, 4);
+        }
+        /* No FMA here, the product has to be rounded as in C */
+        sum = _mm256_mul_ps(_mm256_mul_ps(_mm256_castsi256_ps(s), fvolume),
+                            fmaxvolume);
+        sum = _mm256_add_ps(sum, _mm256_castsi256_ps(d));
+        sum = _mm256_max_ps(min, _mm256_min_ps(max, sum));
+        d = _mm256_castps_si256(sum);
+        if (swap) {
+            d = SDL_Swap_AVX2(d, 4);
+        }
+        _mm256_storeu_si256((__m256i *) dst, d);
+        src += 32;
+        dst += 32;
+    }
+}
+
+#endif /* SDL_MIXER_AVX2 */
+
+typedef void (*SDL_MixFunc) (Uint8 * dst, const Uint8 * src, Uint32 count,
+                             int volume, int swap);
+
+Uint32
+SDL_MixAudio_SSE(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+                 Uint32 len, int volume)
+{
+    SDL_MixFunc s16, s32, f32;
+    Uint32 vecsize;
+
+    /* Louder than SDL_MIX_MAXVOLUME wraps around in the C versions */
+    if (volume <= 0 || volume > SDL_MIX_MAXVOLUME) {
+        return 0;
+    }
+
+#ifdef SDL_MIXER_AVX2
+    if (SDL_HasAVX2()) {
+        s16 = SDL_MixS16_AVX2;
+        s32 = SDL_MixS32_AVX2;
+        f32 = SDL_MixF32_AVX2;
+        vecsize = 32;
+    } else
+#endif
+    if (SDL_HasSSE2()) {
+        s16 = SDL_MixS16_SSE2;
+        s32 = SDL_MixS32_SSE2;
+        f32 = SDL_MixF32_SSE2;
+        vecsize = 16;
+    } else {
+        return 0;
+    }
+
+    len /= vecsize;
+    if (len == 0) {
+        return 0;
+    }
+
+    switch (format) {
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+        s16(dst, src, len, volume, (format == AUDIO_S16MSB));
+        break;
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+        s32(dst, src, len, volume, (format == AUDIO_S32MSB));
+        break;
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        f32(dst, src, len, volume, (format == AUDIO_F32MSB));
+        break;
+    default:
+        return 0;
+    }
+    return len * vecsize;
+}
+
+#endif /* SDL_MIXER_SSE2 */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,42 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* SSE2 and AVX2 versions of SDL_MixAudio for 16 bit, 32 bit and float
+   samples.  They give exactly the same results as the C versions.
+ */
+
+#ifdef __SSE2__
+#define SDL_MIXER_SSE2 1
+#if defined(__GNUC__) && ((__GNUC__ >= 5) || defined(__clang__))
+#define SDL_MIXER_AVX2 1
+#endif
+
+/* Mixes as much of the buffer as fits whole vectors and returns the number
+   of bytes done, or 0 if the format, volume or CPU isn't handled here.
+ */
+extern Uint32 SDL_MixAudio_SSE(Uint8 * dst, const Uint8 * src,
+                               SDL_AudioFormat format, Uint32 len,
+                               int volume);
+#endif /* __SSE2__ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -26,6 +26,7 @@
 
 #include "SDL_mutex.h"
 #include "SDL_thread.h"
+#include "../SDL_atomic_c.h"
 
 /* The SDL audio driver */
 typedef struct SDL_AudioDevice SDL_AudioDevice;
@@ -69,15 +70,31 @@ typedef struct SDL_AudioDriver
 } SDL_AudioDriver;
 
 
-/* Streamer */
+/* Streamer, a ring buffer for one reader and one writer thread */
 typedef struct
 {
     Uint8 *buffer;
-    int max_len;                /* the maximum length in bytes */
-    int read_pos, write_pos;    /* the position of the write and read heads in bytes */
+    Uint32 max_len;             /* the buffer length in bytes, a power of two */
+    volatile Uint32 read_pos;   /* total bytes read, only the reader changes it */
+    volatile Uint32 write_pos;  /* total bytes written, only the writer changes it */
+#if !SDL_ATOMIC_LOCKFREE
+    SDL_mutex *lock;            /* without memory barriers, both sides lock */
+#endif
 } SDL_AudioStreamer;
 
 
+/* A chunk of audio queued with SDL_QueueAudio() */
+#define SDL_AUDIOBUFFERQUEUE_PACKETLEN (8 * 1024)
+
+typedef struct SDL_AudioBufferQueue
+{
+    Uint8 data[SDL_AUDIOBUFFERQUEUE_PACKETLEN];
+    Uint32 datalen;             /* bytes currently in use */
+    Uint32 startpos;            /* bytes already played */
+    struct SDL_AudioBufferQueue *next;
+} SDL_AudioBufferQueue;
+
+
 /* Define the SDL audio driver structure */
 struct SDL_AudioDevice
 {
@@ -106,6 +123,13 @@ struct SDL_AudioDevice
     /* A semaphore for locking the mixing buffers */
     SDL_mutex *mixer_lock;
 
+    /* Audio queued for a device without a callback, and spare packets */
+    SDL_mutex *queue_lock;
+    SDL_AudioBufferQueue *buffer_queue_head;
+    SDL_AudioBufferQueue *buffer_queue_tail;
+    SDL_AudioBufferQueue *buffer_queue_pool;
+    Uint32 queued_bytes;
+
     /* A thread to feed the audio device */
     SDL_Thread *thread;
     Uint32 threadid;
@@ -36,7 +36,7 @@ struct MS_ADPCM_decodestate
     Sint16 iSamp1;
     Sint16 iSamp2;
 };
-static struct MS_ADPCM_decoder
+struct MS_ADPCM_decoder
 {
     WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
@@ -44,42 +44,55 @@ static struct MS_ADPCM_decoder
     Sint16 aCoeff[7][2];
     /* * * */
     struct MS_ADPCM_decodestate state[2];
-} MS_ADPCM_state;
+};
 
 static int
-InitMS_ADPCM(WaveFMT * format)
+InitMS_ADPCM(struct MS_ADPCM_decoder *decoder, WaveFMT * format)
 {
     Uint8 *rogue_feel;
     Uint16 extra_info;
     int i;
 
     /* Set the rogue pointer to the MS_ADPCM specific data */
-    MS_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    MS_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    MS_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    MS_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    MS_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    MS_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
+    decoder->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    decoder->wavefmt.channels = SDL_SwapLE16(format->channels);
+    decoder->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    decoder->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    decoder->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->wavefmt.bitspersample = SDL_SwapLE16(format->bitspersample);
     rogue_feel = (Uint8 *) format + sizeof(*format);
     if (sizeof(*format) == 16) {
         extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
-    MS_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    MS_ADPCM_state.wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    if (MS_ADPCM_state.wNumCoef != 7) {
+    if (decoder->wNumCoef != 7) {
         SDL_SetError("Unknown set of MS_ADPCM coefficients");
         return (-1);
     }
-    for (i = 0; i < MS_ADPCM_state.wNumCoef; ++i) {
-        MS_ADPCM_state.aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    for (i = 0; i < decoder->wNumCoef; ++i) {
+        decoder->aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
-        MS_ADPCM_state.aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+        decoder->aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
+
+    /* Make sure a block holds the samples it claims to */
+    if (decoder->wavefmt.channels < 1 || decoder->wavefmt.channels > 2) {
+        SDL_SetError("MS ADPCM decoder can only handle 1 or 2 channels");
+        return (-1);
+    }
+    if (decoder->wSamplesPerBlock < 2 ||
+        ((decoder->wSamplesPerBlock - 2) * decoder->wavefmt.channels) % 2 ||
+        (7 * decoder->wavefmt.channels +
+         ((decoder->wSamplesPerBlock - 2) * decoder->wavefmt.channels) / 2 >
+         decoder->wavefmt.blockalign)) {
+        SDL_SetError("Invalid MS ADPCM block size");
+        return (-1);
+    }
     return (0);
 }
 
@@ -117,23 +130,109 @@ MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
     return (new_sample);
 }
 
+/* Decode one block of MS ADPCM data into 'wSamplesPerBlock' frames */
 static int
-MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+MS_ADPCM_decode_block(struct MS_ADPCM_decoder *decoder, Uint8 * encoded,
+                      Uint8 * decoded)
 {
     struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
+    Sint32 samplesleft;
     Sint8 nybble, stereo;
     Sint16 *coeff[2];
     Sint32 new_sample;
 
+    stereo = (decoder->wavefmt.channels == 2);
+    state[0] = &decoder->state[0];
+    state[1] = &decoder->state[stereo];
+
+    /* Grab the initial information for this block */
+    state[0]->hPredictor = *encoded++;
+    if (stereo) {
+        state[1]->hPredictor = *encoded++;
+    }
+    state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
+        encoded += sizeof(Sint16);
+    }
+    state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+        encoded += sizeof(Sint16);
+    }
+    state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+        encoded += sizeof(Sint16);
+    }
+    if (state[0]->hPredictor >= decoder->wNumCoef ||
+        state[1]->hPredictor >= decoder->wNumCoef) {
+        SDL_SetError("Invalid MS ADPCM predictor");
+        return (-1);
+    }
+    coeff[0] = decoder->aCoeff[state[0]->hPredictor];
+    coeff[1] = decoder->aCoeff[state[1]->hPredictor];
+
+    /* Store the two initial samples we start with */
+    decoded[0] = state[0]->iSamp2 & 0xFF;
+    decoded[1] = state[0]->iSamp2 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp2 & 0xFF;
+        decoded[1] = state[1]->iSamp2 >> 8;
+        decoded += 2;
+    }
+    decoded[0] = state[0]->iSamp1 & 0xFF;
+    decoded[1] = state[0]->iSamp1 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp1 & 0xFF;
+        decoded[1] = state[1]->iSamp1 >> 8;
+        decoded += 2;
+    }
+
+    /* Decode and store the other samples in this block */
+    samplesleft = (decoder->wSamplesPerBlock - 2) *
+        decoder->wavefmt.channels;
+    while (samplesleft > 0) {
+        nybble = (*encoded) >> 4;
+        new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
+        decoded += 2;
+
+        nybble = (*encoded) & 0x0F;
+        new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
+        decoded += 2;
+
+        ++encoded;
+        samplesleft -= 2;
+    }
+    return (0);
+}
+
+static int
+MS_ADPCM_decode(struct MS_ADPCM_decoder *decoder,
+                Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    Uint8 *freeable, *encoded, *decoded;
+    Sint32 encoded_len;
+    Uint32 decoded_len;
+
     /* Allocate the proper sized output buffer */
     encoded_len = *audio_len;
     encoded = *audio_buf;
     freeable = *audio_buf;
-    *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
-        MS_ADPCM_state.wSamplesPerBlock *
-        MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
+    decoded_len = decoder->wSamplesPerBlock *
+        decoder->wavefmt.channels * sizeof(Sint16);
+    *audio_len = (encoded_len / decoder->wavefmt.blockalign) * decoded_len;
     *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
     if (*audio_buf == NULL) {
         SDL_Error(SDL_ENOMEM);
@@ -142,76 +241,16 @@ MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     decoded = *audio_buf;
 
     /* Get ready... Go! */
-    stereo = (MS_ADPCM_state.wavefmt.channels == 2);
-    state[0] = &MS_ADPCM_state.state[0];
-    state[1] = &MS_ADPCM_state.state[stereo];
-    while (encoded_len >= MS_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        state[0]->hPredictor = *encoded++;
-        if (stereo) {
-            state[1]->hPredictor = *encoded++;
-        }
-        state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        coeff[0] = MS_ADPCM_state.aCoeff[state[0]->hPredictor];
-        coeff[1] = MS_ADPCM_state.aCoeff[state[1]->hPredictor];
-
-        /* Store the two initial samples we start with */
-        decoded[0] = state[0]->iSamp2 & 0xFF;
-        decoded[1] = state[0]->iSamp2 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp2 & 0xFF;
-            decoded[1] = state[1]->iSamp2 >> 8;
-            decoded += 2;
-        }
-        decoded[0] = state[0]->iSamp1 & 0xFF;
-        decoded[1] = state[0]->iSamp1 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp1 & 0xFF;
-            decoded[1] = state[1]->iSamp1 >> 8;
-            decoded += 2;
-        }
-
-        /* Decode and store the other samples in this block */
-        samplesleft = (MS_ADPCM_state.wSamplesPerBlock - 2) *
-            MS_ADPCM_state.wavefmt.channels;
-        while (samplesleft > 0) {
-            nybble = (*encoded) >> 4;
-            new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            nybble = (*encoded) & 0x0F;
-            new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            ++encoded;
-            samplesleft -= 2;
+    while (encoded_len >= decoder->wavefmt.blockalign) {
+        if (MS_ADPCM_decode_block(decoder, encoded, decoded) < 0) {
+            SDL_free(*audio_buf);
+            *audio_buf = NULL;
+            SDL_free(freeable);
+            return (-1);
         }
-        encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
+        encoded += decoder->wavefmt.blockalign;
+        decoded += decoded_len;
+        encoded_len -= decoder->wavefmt.blockalign;
     }
     SDL_free(freeable);
     return (0);
@@ -222,34 +261,50 @@ struct IMA_ADPCM_decodestate
     Sint32 sample;
     Sint8 index;
 };
-static struct IMA_ADPCM_decoder
+struct IMA_ADPCM_decoder
 {
     WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
     /* * * */
     struct IMA_ADPCM_decodestate state[2];
-} IMA_ADPCM_state;
+};
 
 static int
-InitIMA_ADPCM(WaveFMT * format)
+InitIMA_ADPCM(struct IMA_ADPCM_decoder *decoder, WaveFMT * format)
 {
     Uint8 *rogue_feel;
     Uint16 extra_info;
 
     /* Set the rogue pointer to the IMA_ADPCM specific data */
-    IMA_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    IMA_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    IMA_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    IMA_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    IMA_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    IMA_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
+    decoder->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    decoder->wavefmt.channels = SDL_SwapLE16(format->channels);
+    decoder->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    decoder->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    decoder->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->wavefmt.bitspersample = SDL_SwapLE16(format->bitspersample);
     rogue_feel = (Uint8 *) format + sizeof(*format);
     if (sizeof(*format) == 16) {
         extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
-    IMA_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    /* Check to make sure we have enough variables in the state array,
+       and that a block holds the samples it claims to */
+    if (decoder->wavefmt.channels < 1 ||
+        decoder->wavefmt.channels > SDL_arraysize(decoder->state)) {
+        SDL_SetError("IMA ADPCM decoder can only handle %d channels",
+                     SDL_arraysize(decoder->state));
+        return (-1);
+    }
+    if (decoder->wSamplesPerBlock < 1 ||
+        (decoder->wSamplesPerBlock - 1) % 8 ||
+        (4 * decoder->wavefmt.channels +
+         ((decoder->wSamplesPerBlock - 1) * decoder->wavefmt.channels) / 2 >
+         decoder->wavefmt.blockalign)) {
+        SDL_SetError("Invalid IMA ADPCM block size");
+        return (-1);
+    }
     return (0);
 }
 
@@ -336,30 +391,68 @@ Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
     }
 }
 
-static int
-IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+/* Decode one block of IMA ADPCM data into 'wSamplesPerBlock' frames */
+static void
+IMA_ADPCM_decode_block(struct IMA_ADPCM_decoder *decoder, Uint8 * encoded,
+                       Uint8 * decoded)
 {
     struct IMA_ADPCM_decodestate *state;
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
+    Sint32 samplesleft;
     unsigned int c, channels;
 
-    /* Check to make sure we have enough variables in the state array */
-    channels = IMA_ADPCM_state.wavefmt.channels;
-    if (channels > SDL_arraysize(IMA_ADPCM_state.state)) {
-        SDL_SetError("IMA ADPCM decoder can only handle %d channels",
-                     SDL_arraysize(IMA_ADPCM_state.state));
-        return (-1);
+    channels = decoder->wavefmt.channels;
+    state = decoder->state;
+
+    /* Grab the initial information for this block */
+    for (c = 0; c < channels; ++c) {
+        /* Fill the state information for this block */
+        state[c].sample = ((encoded[1] << 8) | encoded[0]);
+        encoded += 2;
+        if (state[c].sample & 0x8000) {
+            state[c].sample -= 0x10000;
+        }
+        state[c].index = *encoded++;
+        if (state[c].index > 88 || state[c].index < 0) {
+            state[c].index = 88;
+        }
+        /* Reserved byte in buffer header, should be 0 */
+        if (*encoded++ != 0) {
+            /* Uh oh, corrupt data?  Buggy code? */ ;
+        }
+
+        /* Store the initial sample we start with */
+        decoded[0] = (Uint8) (state[c].sample & 0xFF);
+        decoded[1] = (Uint8) (state[c].sample >> 8);
+        decoded += 2;
     }
-    state = IMA_ADPCM_state.state;
+
+    /* Decode and store the other samples in this block */
+    samplesleft = (decoder->wSamplesPerBlock - 1) * channels;
+    while (samplesleft > 0) {
+        for (c = 0; c < channels; ++c) {
+            Fill_IMA_ADPCM_block(decoded, encoded, c, channels, &state[c]);
+            encoded += 4;
+            samplesleft -= 8;
+        }
+        decoded += (channels * 8 * 2);
+    }
+}
+
+static int
+IMA_ADPCM_decode(struct IMA_ADPCM_decoder *decoder,
+                 Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    Uint8 *freeable, *encoded, *decoded;
+    Sint32 encoded_len;
+    Uint32 decoded_len;
 
     /* Allocate the proper sized output buffer */
     encoded_len = *audio_len;
     encoded = *audio_buf;
     freeable = *audio_buf;
-    *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
-        IMA_ADPCM_state.wSamplesPerBlock *
-        IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
+    decoded_len = decoder->wSamplesPerBlock *
+        decoder->wavefmt.channels * sizeof(Sint16);
+    *audio_len = (encoded_len / decoder->wavefmt.blockalign) * decoded_len;
     *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
     if (*audio_buf == NULL) {
         SDL_Error(SDL_ENOMEM);
@@ -368,86 +461,59 @@ IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
     decoded = *audio_buf;
 
     /* Get ready... Go! */
-    while (encoded_len >= IMA_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        for (c = 0; c < channels; ++c) {
-            /* Fill the state information for this block */
-            state[c].sample = ((encoded[1] << 8) | encoded[0]);
-            encoded += 2;
-            if (state[c].sample & 0x8000) {
-                state[c].sample -= 0x10000;
-            }
-            state[c].index = *encoded++;
-            /* Reserved byte in buffer header, should be 0 */
-            if (*encoded++ != 0) {
-                /* Uh oh, corrupt data?  Buggy code? */ ;
-            }
-
-            /* Store the initial sample we start with */
-            decoded[0] = (Uint8) (state[c].sample & 0xFF);
-            decoded[1] = (Uint8) (state[c].sample >> 8);
-            decoded += 2;
-        }
-
-        /* Decode and store the other samples in this block */
-        samplesleft = (IMA_ADPCM_state.wSamplesPerBlock - 1) * channels;
-        while (samplesleft > 0) {
-            for (c = 0; c < channels; ++c) {
-                Fill_IMA_ADPCM_block(decoded, encoded,
-                                     c, channels, &state[c]);
-                encoded += 4;
-                samplesleft -= 8;
-            }
-            decoded += (channels * 8 * 2);
-        }
-        encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
+    while (encoded_len >= decoder->wavefmt.blockalign) {
+        IMA_ADPCM_decode_block(decoder, encoded, decoded);
+        encoded += decoder->wavefmt.blockalign;
+        decoded += decoded_len;
+        encoded_len -= decoder->wavefmt.blockalign;
     }
     SDL_free(freeable);
     return (0);
 }
 
-SDL_AudioSpec *
-SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
-               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+/* What the format chunk says about how to decode the data chunk */
+typedef struct WaveDecoder
+{
+    Uint16 encoding;
+    Uint32 blockalign;          /* Bytes in each block of data */
+    Uint32 blockframes;         /* Frames decoded from each block */
+    Uint32 framesize;           /* Bytes in each decoded frame */
+    struct MS_ADPCM_decoder MS_ADPCM_state;
+    struct IMA_ADPCM_decoder IMA_ADPCM_state;
+} WaveDecoder;
+
+/* Read the WAVE header and format chunk, leaving 'src' at the next chunk */
+static int
+ReadWaveFormat(SDL_RWops * src, SDL_AudioSpec * spec, WaveDecoder * decoder,
+               Uint32 * wavelen, Uint32 * headerDiff)
 {
     int was_error;
     Chunk chunk;
     int lenread;
-    int IEEE_float_encoded, MS_ADPCM_encoded, IMA_ADPCM_encoded;
-    int samplesize;
 
     /* WAV magic header */
     Uint32 RIFFchunk;
-    Uint32 wavelen = 0;
     Uint32 WAVEmagic;
-    Uint32 headerDiff = 0;
 
     /* FMT chunk */
     WaveFMT *format = NULL;
 
-    /* Make sure we are passed a valid data source */
-    was_error = 0;
-    if (src == NULL) {
-        was_error = 1;
-        goto done;
-    }
-
     /* Check the magic header */
+    was_error = 0;
     RIFFchunk = SDL_ReadLE32(src);
-    wavelen = SDL_ReadLE32(src);
-    if (wavelen == WAVE) {      /* The RIFFchunk has already been read */
-        WAVEmagic = wavelen;
-        wavelen = RIFFchunk;
+    *wavelen = SDL_ReadLE32(src);
+    if (*wavelen == WAVE) {     /* The RIFFchunk has already been read */
+        WAVEmagic = *wavelen;
+        *wavelen = RIFFchunk;
         RIFFchunk = RIFF;
     } else {
         WAVEmagic = SDL_ReadLE32(src);
     }
     if ((RIFFchunk != RIFF) || (WAVEmagic != WAVE)) {
         SDL_SetError("Unrecognized file type (not WAVE)");
-        was_error = 1;
-        goto done;
+        return (-1);
     }
-    headerDiff += sizeof(Uint32);       /* for WAVE */
+    *headerDiff += sizeof(Uint32);      /* for WAVE */
 
     /* Read the audio data format chunk */
     chunk.data = NULL;
@@ -457,11 +523,10 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         }
         lenread = ReadChunk(src, &chunk);
         if (lenread < 0) {
-            was_error = 1;
-            goto done;
+            return (-1);
         }
         /* 2 Uint32's for chunk header+len, plus the lenread */
-        headerDiff += lenread + 2 * sizeof(Uint32);
+        *headerDiff += lenread + 2 * sizeof(Uint32);
     } while ((chunk.magic == FACT) || (chunk.magic == LIST));
 
     /* Decode the audio data format */
@@ -471,30 +536,27 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         was_error = 1;
         goto done;
     }
-    IEEE_float_encoded = MS_ADPCM_encoded = IMA_ADPCM_encoded = 0;
-    switch (SDL_SwapLE16(format->encoding)) {
+    decoder->encoding = SDL_SwapLE16(format->encoding);
+    switch (decoder->encoding) {
     case PCM_CODE:
         /* We can understand this */
         break;
     case IEEE_FLOAT_CODE:
-        IEEE_float_encoded = 1;
         /* We can understand this */
         break;
     case MS_ADPCM_CODE:
         /* Try to understand this */
-        if (InitMS_ADPCM(format) < 0) {
+        if (InitMS_ADPCM(&decoder->MS_ADPCM_state, format) < 0) {
             was_error = 1;
             goto done;
         }
-        MS_ADPCM_encoded = 1;
         break;
     case IMA_ADPCM_CODE:
         /* Try to understand this */
-        if (InitIMA_ADPCM(format) < 0) {
+        if (InitIMA_ADPCM(&decoder->IMA_ADPCM_state, format) < 0) {
             was_error = 1;
             goto done;
         }
-        IMA_ADPCM_encoded = 1;
         break;
     case MP3_CODE:
         SDL_SetError("MPEG Layer 3 data not supported",
@@ -510,7 +572,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     SDL_memset(spec, 0, (sizeof *spec));
     spec->freq = SDL_SwapLE32(format->frequency);
 
-    if (IEEE_float_encoded) {
+    if (decoder->encoding == IEEE_FLOAT_CODE) {
         if ((SDL_SwapLE16(format->bitspersample)) != 32) {
             was_error = 1;
         } else {
@@ -519,7 +581,8 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     } else {
         switch (SDL_SwapLE16(format->bitspersample)) {
         case 4:
-            if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
+            if (decoder->encoding == MS_ADPCM_CODE ||
+                decoder->encoding == IMA_ADPCM_CODE) {
                 spec->format = AUDIO_S16;
             } else {
                 was_error = 1;
@@ -547,6 +610,68 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     }
     spec->channels = (Uint8) SDL_SwapLE16(format->channels);
     spec->samples = 4096;       /* Good default buffer size */
+    if (spec->channels == 0) {
+        SDL_SetError("WAVE file has no channels");
+        was_error = 1;
+        goto done;
+    }
+
+    /* Work out the size of the blocks the data is decoded in */
+    decoder->framesize =
+        ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
+    switch (decoder->encoding) {
+    case MS_ADPCM_CODE:
+        decoder->blockalign = decoder->MS_ADPCM_state.wavefmt.blockalign;
+        decoder->blockframes = decoder->MS_ADPCM_state.wSamplesPerBlock;
+        break;
+    case IMA_ADPCM_CODE:
+        decoder->blockalign = decoder->IMA_ADPCM_state.wavefmt.blockalign;
+        decoder->blockframes = decoder->IMA_ADPCM_state.wSamplesPerBlock;
+        break;
+    default:
+        decoder->blockalign = decoder->framesize;
+        decoder->blockframes = 1;
+        break;
+    }
+
+  done:
+    SDL_free(format);
+    return (was_error ? -1 : 0);
+}
+
+SDL_AudioSpec *
+SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
+               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    int was_error;
+    Chunk chunk;
+    int lenread;
+    WaveDecoder decoder;
+    Uint32 wavelen = 0;
+    Uint32 headerDiff = 0;
+    SDL_RWops *buffered = NULL;
+
+    /* Make sure we are passed a valid data source */
+    was_error = 0;
+    chunk.length = 0;
+    if (src == NULL) {
+        was_error = 1;
+        goto done;
+    }
+
+    /* Read the chunk headers through a buffer, unless they're already in
+       memory.  Without 'freesrc', the source has to seek afterwards. */
+    if (!SDL_RWGetMemory(src, NULL) && (freesrc || SDL_RWtell(src) >= 0)) {
+        buffered = SDL_RWFromBufferedRW(src, 0, freesrc);
+        if (buffered) {
+            src = buffered;
+        }
+    }
+
+    if (ReadWaveFormat(src, spec, &decoder, &wavelen, &headerDiff) < 0) {
+        was_error = 1;
+        goto done;
+    }
 
     /* Read the audio data chunk */
     *audio_buf = NULL;
@@ -566,33 +691,36 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     } while (chunk.magic != DATA);
     headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
 
-    if (MS_ADPCM_encoded) {
-        if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
+    switch (decoder.encoding) {
+    case MS_ADPCM_CODE:
+        if (MS_ADPCM_decode(&decoder.MS_ADPCM_state, audio_buf, audio_len) <
+            0) {
             was_error = 1;
             goto done;
         }
-    }
-    if (IMA_ADPCM_encoded) {
-        if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
+        break;
+    case IMA_ADPCM_CODE:
+        if (IMA_ADPCM_decode(&decoder.IMA_ADPCM_state, audio_buf, audio_len)
+            < 0) {
             was_error = 1;
             goto done;
         }
+        break;
     }
 
-    /* Don't return a buffer that isn't a multiple of samplesize */
-    samplesize = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
-    *audio_len &= ~(samplesize - 1);
+    /* Don't return a buffer that isn't a multiple of the frame size */
+    *audio_len -= *audio_len % decoder.framesize;
 
   done:
-    if (format != NULL) {
-        SDL_free(format);
-    }
     if (src) {
         if (freesrc) {
             SDL_RWclose(src);
         } else {
             /* seek to the end of the file (given by the RIFF chunk) */
             SDL_RWseek(src, wavelen - chunk.length - headerDiff, RW_SEEK_CUR);
+            if (buffered) {
+                SDL_RWclose(buffered);
+            }
         }
     }
     if (was_error) {
@@ -612,6 +740,245 @@ SDL_FreeWAV(Uint8 * audio_buf)
     }
 }
 
+/* A WAVE file being read a little at a time */
+struct SDL_WAVStream
+{
+    SDL_RWops *src;
+    SDL_RWops *buffered;        /* Reads 'src' through a buffer, or NULL */
+    SDL_RWops *rw;              /* Whichever of those is read */
+    int freesrc;
+    WaveDecoder decoder;
+    Sint64 data_start;          /* Offset of the data, or -1 if unknown */
+    Uint32 length;              /* Frames in the data */
+    Uint32 frame;               /* The next frame to read */
+    Uint32 rw_block;            /* The block 'rw' is at, or NO_BLOCK */
+    Uint8 *encoded;             /* One block of ADPCM data */
+    Uint8 *decoded;             /* The frames decoded from it */
+    Uint32 decoded_block;       /* The block in 'decoded', or NO_BLOCK */
+};
+
+#define NO_BLOCK    0xFFFFFFFF
+
+SDL_WAVStream *
+SDL_OpenWAVStream_RW(SDL_RWops * src, int freesrc, SDL_AudioSpec * spec)
+{
+    SDL_WAVStream *stream;
+    WaveDecoder *decoder;
+    Uint32 wavelen, headerDiff = 0;
+    Uint32 header[2];
+
+    /* Make sure we are passed a valid data source */
+    if (src == NULL) {
+        return (NULL);
+    }
+    stream = (SDL_WAVStream *) SDL_calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return (NULL);
+    }
+    stream->src = src;
+    stream->rw = src;
+    stream->freesrc = freesrc;
+    stream->decoded_block = NO_BLOCK;
+    decoder = &stream->decoder;
+
+    /* Small reads go through a buffer, unless the data is in memory */
+    if (!SDL_RWGetMemory(src, NULL)) {
+        stream->buffered =
+            SDL_RWFromBufferedRW(src, 0, freesrc ? SDL_TRUE : SDL_FALSE);
+        if (stream->buffered) {
+            stream->rw = stream->buffered;
+        }
+    }
+
+    if (ReadWaveFormat(stream->rw, spec, decoder, &wavelen, &headerDiff) < 0) {
+        goto error;
+    }
+
+    /* Skip to the audio data chunk, without reading anything else */
+    for (;;) {
+        if (SDL_RWread(stream->rw, header, sizeof(header), 1) != 1) {
+            SDL_SetError("WAVE file has no data");
+            goto error;
+        }
+        if (SDL_SwapLE32(header[0]) == DATA) {
+            break;
+        }
+        if (SDL_RWseek(stream->rw, SDL_SwapLE32(header[1]), RW_SEEK_CUR) <
+            0) {
+            goto error;
+        }
+    }
+    stream->data_start = SDL_RWtell(stream->rw);
+    stream->length = (SDL_SwapLE32(header[1]) / decoder->blockalign) *
+        decoder->blockframes;
+
+    /* ADPCM data is decoded a block at a time */
+    if (decoder->encoding == MS_ADPCM_CODE ||
+        decoder->encoding == IMA_ADPCM_CODE) {
+        stream->encoded = (Uint8 *) SDL_malloc(decoder->blockalign);
+        stream->decoded = (Uint8 *)
+            SDL_malloc(decoder->blockframes * decoder->framesize);
+        if (stream->encoded == NULL || stream->decoded == NULL) {
+            SDL_OutOfMemory();
+            goto error;
+        }
+    }
+    return (stream);
+
+  error:
+    SDL_CloseWAVStream(stream);
+    return (NULL);
+}
+
+/* Move the source to the start of a block of the data */
+static int
+SeekWAVBlock(SDL_WAVStream * stream, Uint32 block)
+{
+    if (stream->data_start < 0) {
+        SDL_SetError("WAVE stream can't seek");
+        return (-1);
+    }
+    if (SDL_RWseek(stream->rw, stream->data_start +
+                   (Sint64) block * stream->decoder.blockalign,
+                   RW_SEEK_SET) < 0) {
+        stream->rw_block = NO_BLOCK;
+        return (-1);
+    }
+    stream->rw_block = block;
+    return (0);
+}
+
+int
+SDL_ReadWAVStream(SDL_WAVStream * stream, void *buf, Uint32 frames)
+{
+    WaveDecoder *decoder;
+    Uint8 *dst = (Uint8 *) buf;
+    Uint32 block, offset, count, done;
+
+    if (stream == NULL) {
+        SDL_SetError("Passed a NULL WAVE stream");
+        return (-1);
+    }
+    decoder = &stream->decoder;
+    if (frames > stream->length - stream->frame) {
+        frames = stream->length - stream->frame;
+    }
+
+    for (done = 0; done < frames; done += count) {
+        block = stream->frame / decoder->blockframes;
+        offset = stream->frame % decoder->blockframes;
+
+        if (stream->decoded == NULL) {
+            /* PCM data is read straight into the caller's buffer */
+            if (stream->rw_block != block &&
+                SeekWAVBlock(stream, block) < 0) {
+                return (done ? (int) done : -1);
+            }
+            count = (Uint32) SDL_RWread(stream->rw, dst, decoder->framesize,
+                                        frames - done);
+            stream->rw_block += count;
+            if (count < frames - done) {
+                /* The file ends early, maybe part way through a frame */
+                stream->rw_block = NO_BLOCK;
+                stream->frame += count;
+                done += count;
+                break;
+            }
+        } else {
+            if (stream->decoded_block != block) {
+                if (stream->rw_block != block &&
+                    SeekWAVBlock(stream, block) < 0) {
+                    return (done ? (int) done : -1);
+                }
+                if (SDL_RWread(stream->rw, stream->encoded,
+                               decoder->blockalign, 1) != 1) {
+                    stream->rw_block = NO_BLOCK;
+                    break;
+                }
+                ++stream->rw_block;
+                stream->decoded_block = NO_BLOCK;
+                if (decoder->encoding == MS_ADPCM_CODE) {
+                    if (MS_ADPCM_decode_block(&decoder->MS_ADPCM_state,
+                                              stream->encoded,
+                                              stream->decoded) < 0) {
+                        return (done ? (int) done : -1);
+                    }
+                } else {
+                    IMA_ADPCM_decode_block(&decoder->IMA_ADPCM_state,
+                                           stream->encoded,
+                                           stream->decoded);
+                }
+                stream->decoded_block = block;
+            }
+            count = decoder->blockframes - offset;
+            if (count > frames - done) {
+                count = frames - done;
+            }
+            SDL_memcpy(dst, stream->decoded + offset * decoder->framesize,
+                       count * decoder->framesize);
+        }
+        dst += count * decoder->framesize;
+        stream->frame += count;
+    }
+    return ((int) done);
+}
+
+int
+SDL_SeekWAVStream(SDL_WAVStream * stream, Uint32 frame)
+{
+    if (stream == NULL) {
+        SDL_SetError("Passed a NULL WAVE stream");
+        return (-1);
+    }
+    if (frame > stream->length) {
+        frame = stream->length;
+    }
+    if (frame != stream->frame && stream->data_start < 0) {
+        SDL_SetError("WAVE stream can't seek");
+        return (-1);
+    }
+
+    /* The source is moved by the next read, if it needs to be */
+    stream->frame = frame;
+    return (0);
+}
+
+Uint32
+SDL_TellWAVStream(SDL_WAVStream * stream)
+{
+    return (stream ? stream->frame : 0);
+}
+
+Uint32
+SDL_GetWAVStreamLength(SDL_WAVStream * stream)
+{
+    return (stream ? stream->length : 0);
+}
+
+void
+SDL_CloseWAVStream(SDL_WAVStream * stream)
+{
+    if (stream == NULL) {
+        return;
+    }
+    if (stream->buffered) {
+        SDL_RWclose(stream->buffered);
+    } else if (stream->freesrc) {
+        SDL_RWclose(stream->src);
+    }
+    if (stream->encoded) {
+        SDL_free(stream->encoded);
+    }
+    if (stream->decoded) {
+        SDL_free(stream->decoded);
+    }
+    SDL_free(stream);
+}
+
 static int
 ReadChunk(SDL_RWops * src, Chunk * chunk)
 {
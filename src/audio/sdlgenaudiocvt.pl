@@ -381,6 +381,7 @@ sub buildArbitraryResampleFunc {
     $custom_converters++;
 
     my $fudge = $fsize * $channels * 2;  # !!! FIXME
+    my $framesize = $fsize * $channels;
     my $eps_adjust = ($upsample) ? 'dstsize' : 'srcsize';
     my $incr = '';
     my $incr2 = '';
@@ -396,7 +397,7 @@ ${sym}(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 #endif
 
     const int srcsize = cvt->len_cvt - $fudge;
-    const int dstsize = (int) (((double)cvt->len_cvt) * cvt->rate_incr);
+    const int dstsize = ((int) (((double)(cvt->len_cvt / $framesize)) * cvt->rate_incr)) * $framesize;
     register int eps = 0;
 EOF
 
@@ -538,12 +539,14 @@ ${sym}(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 EOF
 
     # Upsampling (growing the buffer) needs to work backwards, since we
-    #  overwrite the buffer as we go.
+    #  overwrite the buffer as we go. Each input frame writes $multiple
+    #  output frames, so start that far from the end.
     if ($upsample) {
+        my $dstframes = $channels * $multiple;
         print <<EOF;
-    $fctype *dst = (($fctype *) (cvt->buf + dstsize)) - $channels;
+    $fctype *dst = (($fctype *) (cvt->buf + dstsize)) - $dstframes;
     const $fctype *src = (($fctype *) (cvt->buf + cvt->len_cvt)) - $channels;
-    const $fctype *target = ((const $fctype *) cvt->buf) - $channels;
+    const $fctype *target = ((const $fctype *) cvt->buf) - $dstframes;
 EOF
     } else {
         print <<EOF;
@@ -25,6 +25,18 @@
 
 #include "SDL_cpuinfo.h"
 
+#ifdef HAVE_SYSCONF
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYSCTLBYNAME
+#include <sys/types.h>
+#include <sys/sysctl.h>
+#endif
+#ifdef __WIN32__
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
 #if defined(__MACOSX__) && defined(__ppc__)
 #include <sys/sysctl.h>         /* For AltiVec check */
 #elif SDL_ALTIVEC_BLITTERS && HAVE_SETJMP
@@ -40,6 +52,7 @@
 #define CPU_HAS_SSE	0x00000040
 #define CPU_HAS_SSE2	0x00000080
 #define CPU_HAS_ALTIVEC	0x00000100
+#define CPU_HAS_AVX2	0x00000200
 
 #if SDL_ALTIVEC_BLITTERS && HAVE_SETJMP && !__MACOSX__
 /* This is the brute force way of detecting instruction sets...
@@ -352,6 +365,73 @@ CPU_haveSSE2(void)
     return 0;
 }
 
+/* AVX2 needs the CPU flag (leaf 7) and the OS saving the YMM state */
+static __inline__ int
+CPU_haveAVX2(void)
+{
+    int has_AVX2 = 0;
+    if (!CPU_haveCPUID()) {
+        return 0;
+    }
+/* *INDENT-OFF* */
+#if defined(__GNUC__) && (defined(i386) || defined(__x86_64__))
+    {
+        int a, b, c, d;
+#ifdef __x86_64__
+#define CPU_cpuid(func, a, b, c, d) \
+        __asm__ ("movq %%rbx,%%rsi; cpuid; xchgq %%rbx,%%rsi" \
+                 : "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func), "c" (0))
+#else
+#define CPU_cpuid(func, a, b, c, d) \
+        __asm__ ("movl %%ebx,%%esi; cpuid; xchgl %%ebx,%%esi" \
+                 : "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func), "c" (0))
+#endif
+        CPU_cpuid(0, a, b, c, d);
+        if (a >= 7) {
+            CPU_cpuid(1, a, b, c, d);
+            if ((c & 0x18000000) == 0x18000000) {
+                /* xgetbv with ecx = 0 */
+                __asm__ (".byte 0x0f, 0x01, 0xd0" : "=a" (a), "=d" (d) : "c" (0));
+                if ((a & 0x06) == 0x06) {
+                    CPU_cpuid(7, a, b, c, d);
+                    has_AVX2 = (b & 0x00000020);
+                }
+            }
+        }
+#undef CPU_cpuid
+    }
+#elif (defined(_MSC_VER) && defined(_M_IX86)) || defined(__WATCOMC__)
+	__asm {
+        push    ebx
+        xor     eax, eax
+        cpuid                       ; Get the highest standard function
+        cmp     eax, 7
+        jl      done
+        mov     eax, 1
+        cpuid
+        and     ecx, 18000000h      ; OSXSAVE and AVX
+        cmp     ecx, 18000000h
+        jne     done
+        xor     ecx, ecx
+        _emit   0x0f                ; xgetbv
+        _emit   0x01
+        _emit   0xd0
+        and     eax, 6              ; XMM and YMM state enabled
+        cmp     eax, 6
+        jne     done
+        mov     eax, 7
+        xor     ecx, ecx
+        cpuid
+        and     ebx, 20h
+        mov     has_AVX2, ebx
+done:
+        pop     ebx
+	}
+#endif
+/* *INDENT-ON* */
+    return has_AVX2;
+}
+
 static __inline__ int
 CPU_haveAltiVec(void)
 {
@@ -406,6 +486,9 @@ SDL_GetCPUFeatures(void)
         if (CPU_haveAltiVec()) {
             SDL_CPUFeatures |= CPU_HAS_ALTIVEC;
         }
+        if (CPU_haveAVX2()) {
+            SDL_CPUFeatures |= CPU_HAS_AVX2;
+        }
     }
     return SDL_CPUFeatures;
 }
@@ -482,6 +565,47 @@ SDL_HasAltiVec(void)
     return SDL_FALSE;
 }
 
+SDL_bool
+SDL_HasAVX2(void)
+{
+    if (SDL_GetCPUFeatures() & CPU_HAS_AVX2) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+static int SDL_CPUCount = 0;
+
+int
+SDL_GetCPUCount(void)
+{
+    if (!SDL_CPUCount) {
+#if defined(HAVE_SYSCONF) && defined(_SC_NPROCESSORS_ONLN)
+        if (SDL_CPUCount <= 0) {
+            SDL_CPUCount = (int) sysconf(_SC_NPROCESSORS_ONLN);
+        }
+#endif
+#ifdef HAVE_SYSCTLBYNAME
+        if (SDL_CPUCount <= 0) {
+            size_t size = sizeof(SDL_CPUCount);
+            sysctlbyname("hw.ncpu", &SDL_CPUCount, &size, NULL, 0);
+        }
+#endif
+#ifdef __WIN32__
+        if (SDL_CPUCount <= 0) {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            SDL_CPUCount = info.dwNumberOfProcessors;
+        }
+#endif
+        /* There's always at least the one we're running on */
+        if (SDL_CPUCount <= 0) {
+            SDL_CPUCount = 1;
+        }
+    }
+    return SDL_CPUCount;
+}
+
 #ifdef TEST_MAIN
 
 #include <stdio.h>
@@ -489,6 +613,7 @@ SDL_HasAltiVec(void)
 int
 main()
 {
+    printf("CPU count: %d\n", SDL_GetCPUCount());
     printf("RDTSC: %d\n", SDL_HasRDTSC());
     printf("MMX: %d\n", SDL_HasMMX());
     printf("MMXExt: %d\n", SDL_HasMMXExt());
@@ -497,6 +622,7 @@ main()
     printf("SSE: %d\n", SDL_HasSSE());
     printf("SSE2: %d\n", SDL_HasSSE2());
     printf("AltiVec: %d\n", SDL_HasAltiVec());
+    printf("AVX2: %d\n", SDL_HasAVX2());
     return 0;
 }
 
@@ -30,6 +30,8 @@
 #include "SDL_sysevents.h"
 #include "SDL_events_c.h"
 #include "../timer/SDL_timer_c.h"
+#include "../SDL_atomic_c.h"
+#include "../SDL_profile_c.h"
 #if !SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
 #endif
@@ -40,19 +42,93 @@ void *SDL_EventOKParam;
 Uint8 SDL_ProcessEvents[SDL_NUMEVENTS];
 static Uint32 SDL_eventstate = 0;
 
-/* Private data -- event queue */
-#define MAXEVENTS	128
+/* Private data -- event queue
+
+   Producers add events to a ring of slots without taking the lock.  Each
+   slot holds the ticket of the next producer allowed to fill it, so a
+   producer claims a slot by advancing the tail ticket and publishes it by
+   bumping the slot's ticket again.  Whoever reads the queue holds the lock
+   and first moves the finished slots, in order, onto a doubly linked list
+   of entries, so events can be cut from anywhere in constant time.  The
+   list grows in chunks up to SDL_EventQ.max events, which leaves room for
+   a full ring within the configured queue size.  If the ring is full,
+   the producer takes the lock and empties it onto the list itself, so
+   events are only dropped once the list is full too.
+
+   Window manager messages travel in the slot and then the entry with
+   their event.  When the event is taken off the queue, the message is
+   copied to a ring that only readers write, so it stays good until
+   MAXWMMSGS more of them have been read.
+ */
+#define MAXWMMSGS	128
+#define EVENTQ_SLOTS	256     /* Must be a power of two */
+#define EVENTQ_CHUNK	128
+#define EVENTQ_DEFAULT_MAX	4096
+
+#if SDL_ATOMIC_LOCKFREE
+#define EVENTQ_LOCKFREE	1
+#define SDL_EventCAS(p, old, new)	SDL_AtomicCAS(p, old, new)
+#define SDL_EventAdd(p, v)	SDL_AtomicAdd(p, v)
+#define SDL_EventBarrier()	SDL_MemoryBarrier()
+#else
+/* No atomic operations, producers take the lock too, and everything these
+   are used for happens with the queue locked, which orders it */
+#define EVENTQ_LOCKFREE	0
+#define SDL_EventCAS(p, old, new)	((*(p) == (old)) ? ((*(p) = (new)), 1) : 0)
+#define SDL_EventAdd(p, v)	((*(p) += (v)) - (v))
+#define SDL_EventBarrier()
+#endif
+
+typedef struct SDL_EventSlot
+{
+    volatile Uint32 ticket;
+    SDL_Event event;
+    struct SDL_SysWMmsg wmmsg;
+} SDL_EventSlot;
+
+typedef struct SDL_EventEntry
+{
+    SDL_Event event;
+    struct SDL_SysWMmsg wmmsg;
+    struct SDL_EventEntry *prev;
+    struct SDL_EventEntry *next;
+} SDL_EventEntry;
+
+typedef struct SDL_EventChunk
+{
+    struct SDL_EventChunk *next;
+    SDL_EventEntry entries[EVENTQ_CHUNK];
+} SDL_EventChunk;
+
 static struct
 {
     SDL_mutex *lock;
     int active;
-    int head;
-    int tail;
-    SDL_Event event[MAXEVENTS];
+    volatile Uint32 tail;       /* Next ticket handed to a producer */
+    SDL_EventSlot slots[EVENTQ_SLOTS];
+    Uint32 head;                /* Next ticket to move onto the list */
+    SDL_EventEntry *first;
+    SDL_EventEntry *last;
+    SDL_EventEntry *free;
+    SDL_EventChunk *chunks;
+    int count;
+    int allocated;
+    int max;
+    int peak;
+    volatile Uint32 dropped;
     int wmmsg_next;
-    struct SDL_SysWMmsg wmmsg[MAXEVENTS];
+    struct SDL_SysWMmsg wmmsg[MAXWMMSGS];
 } SDL_EventQ;
 
+/* Private data -- threads sleeping in SDL_WaitEventTimeout() */
+static struct
+{
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    volatile int waiting;
+    Uint32 wakeups;
+} SDL_EventWait;
+
 /* Private data -- event locking structure */
 static struct
 {
@@ -158,7 +234,13 @@ SDL_StartEventThread(Uint32 flags)
     if (SDL_EventQ.lock == NULL) {
         return (-1);
     }
+    SDL_EventWait.lock = SDL_CreateMutex();
+    SDL_EventWait.cond = SDL_CreateCond();
+    if (SDL_EventWait.lock == NULL || SDL_EventWait.cond == NULL) {
+        return (-1);
+    }
 #endif /* !SDL_THREADS_DISABLED */
+    SDL_EventWait.waiting = 0;
     SDL_EventQ.active = 1;
 
     if ((flags & SDL_INIT_EVENTTHREAD) == SDL_INIT_EVENTTHREAD) {
@@ -198,6 +280,14 @@ SDL_StopEventThread(void)
 #ifndef IPOD
     SDL_DestroyMutex(SDL_EventQ.lock);
 #endif
+    if (SDL_EventWait.cond) {
+        SDL_DestroyCond(SDL_EventWait.cond);
+        SDL_EventWait.cond = NULL;
+    }
+    if (SDL_EventWait.lock) {
+        SDL_DestroyMutex(SDL_EventWait.lock);
+        SDL_EventWait.lock = NULL;
+    }
 }
 
 Uint32
@@ -206,6 +296,33 @@ SDL_EventThreadID(void)
     return (event_thread);
 }
 
+/* Empty the queue and free the list -- called with no other users */
+static void
+SDL_ClearEventQ(void)
+{
+    Uint32 i;
+
+    while (SDL_EventQ.chunks) {
+        SDL_EventChunk *chunk = SDL_EventQ.chunks;
+        SDL_EventQ.chunks = chunk->next;
+        SDL_free(chunk);
+    }
+    SDL_EventQ.first = NULL;
+    SDL_EventQ.last = NULL;
+    SDL_EventQ.free = NULL;
+    SDL_EventQ.count = 0;
+    SDL_EventQ.allocated = 0;
+    SDL_EventQ.peak = 0;
+    SDL_EventQ.dropped = 0;
+
+    for (i = 0; i < EVENTQ_SLOTS; ++i) {
+        SDL_EventQ.slots[i].ticket = i;
+    }
+    SDL_EventQ.head = 0;
+    SDL_EventQ.tail = 0;
+    SDL_EventQ.wmmsg_next = 0;
+}
+
 /* Public functions */
 
 void
@@ -220,15 +337,14 @@ SDL_StopEventLoop(void)
     SDL_QuitQuit();
 
     /* Clean out EventQ */
-    SDL_EventQ.head = 0;
-    SDL_EventQ.tail = 0;
-    SDL_EventQ.wmmsg_next = 0;
+    SDL_ClearEventQ();
 }
 
 /* This function (and associated calls) may be called more than once */
 int
 SDL_StartEventLoop(Uint32 flags)
 {
+    const char *env;
     int retcode;
 
     /* Clean out the event queue */
@@ -236,6 +352,14 @@ SDL_StartEventLoop(Uint32 flags)
     SDL_EventQ.lock = NULL;
     SDL_StopEventLoop();
 
+    /* See how many events may wait in the queue */
+    SDL_EventQ.max = EVENTQ_DEFAULT_MAX;
+    env = SDL_getenv("SDL_EVENT_QUEUE_SIZE");
+    if (env) {
+        SDL_EventQ.max = SDL_max(SDL_atoi(env), 2 * EVENTQ_SLOTS);
+    }
+    SDL_EventQ.max -= EVENTQ_SLOTS;
+
     /* No filter to start with, process most event types */
     SDL_EventOK = NULL;
     SDL_memset(SDL_ProcessEvents, SDL_ENABLE, sizeof(SDL_ProcessEvents));
@@ -263,59 +387,215 @@ SDL_StartEventLoop(Uint32 flags)
 }
 
 
-/* Add an event to the event queue -- called with the queue locked */
+/* Add an event to a free slot in the ring, returns 0 if it's full */
 static int
-SDL_AddEvent(SDL_Event * event)
+SDL_EnqueueEvent(SDL_Event * event)
 {
-    int tail, added;
+    SDL_EventSlot *slot;
+    Uint32 ticket = SDL_EventQ.tail;
 
-    tail = (SDL_EventQ.tail + 1) % MAXEVENTS;
-    if (tail == SDL_EventQ.head) {
-        /* Overflow, drop event */
-        added = 0;
-    } else {
-        SDL_EventQ.event[SDL_EventQ.tail] = *event;
-        if (event->type == SDL_SYSWMEVENT) {
-            /* Note that it's possible to lose an event */
-            int next = SDL_EventQ.wmmsg_next;
-            SDL_EventQ.wmmsg[next] = *event->syswm.msg;
-            SDL_EventQ.event[SDL_EventQ.tail].syswm.msg =
-                &SDL_EventQ.wmmsg[next];
-            SDL_EventQ.wmmsg_next = (next + 1) % MAXEVENTS;
+    for (;;) {
+        Sint32 lag;
+
+        slot = &SDL_EventQ.slots[ticket & (EVENTQ_SLOTS - 1)];
+        lag = (Sint32) (slot->ticket - ticket);
+        if (lag == 0) {
+            if (SDL_EventCAS(&SDL_EventQ.tail, ticket, ticket + 1)) {
+                break;
+            }
+        } else if (lag < 0) {
+            /* The slot hasn't been emptied since the last lap */
+            return 0;
         }
-        SDL_EventQ.tail = tail;
-        added = 1;
+        /* Another producer got here first */
+        ticket = SDL_EventQ.tail;
+    }
+
+    slot->event = *event;
+    if (event->type == SDL_SYSWMEVENT) {
+        slot->wmmsg = *event->syswm.msg;
     }
-    return (added);
+    SDL_EventBarrier();
+    slot->ticket = ticket + 1;
+    return 1;
 }
 
-/* Cut an event, and return the next valid spot, or the tail */
-/*                           -- called with the queue locked */
+/* Add a chunk of entries to the free list, returns 0 if there's no room */
 static int
-SDL_CutEvent(int spot)
-{
-    if (spot == SDL_EventQ.head) {
-        SDL_EventQ.head = (SDL_EventQ.head + 1) % MAXEVENTS;
-        return (SDL_EventQ.head);
-    } else if ((spot + 1) % MAXEVENTS == SDL_EventQ.tail) {
-        SDL_EventQ.tail = spot;
-        return (SDL_EventQ.tail);
-    } else
-        /* We cut the middle -- shift everything over */
-    {
-        int here, next;
-
-        /* This can probably be optimized with SDL_memcpy() -- careful! */
-        if (--SDL_EventQ.tail < 0) {
-            SDL_EventQ.tail = MAXEVENTS - 1;
+SDL_GrowEventQ(void)
+{
+    SDL_EventChunk *chunk;
+    int i;
+
+    chunk = (SDL_EventChunk *) SDL_malloc(sizeof(*chunk));
+    if (!chunk) {
+        return 0;
+    }
+    for (i = 0; i < EVENTQ_CHUNK; ++i) {
+        chunk->entries[i].next = SDL_EventQ.free;
+        SDL_EventQ.free = &chunk->entries[i];
+    }
+    chunk->next = SDL_EventQ.chunks;
+    SDL_EventQ.chunks = chunk;
+    SDL_EventQ.allocated += EVENTQ_CHUNK;
+    return 1;
+}
+
+/* Move the events producers have finished adding onto the end of the list,
+   returns how many were moved -- called with the queue locked */
+static int
+SDL_FlushEventRing(void)
+{
+    int moved = 0;
+    int depth;
+
+    while (SDL_EventQ.count < SDL_EventQ.max) {
+        SDL_EventSlot *slot =
+            &SDL_EventQ.slots[SDL_EventQ.head & (EVENTQ_SLOTS - 1)];
+        SDL_EventEntry *entry;
+
+        if (slot->ticket != SDL_EventQ.head + 1) {
+            /* Empty, or a producer is still filling it in */
+            break;
+        }
+        if (!SDL_EventQ.free && !SDL_GrowEventQ()) {
+            break;
         }
-        for (here = spot; here != SDL_EventQ.tail; here = next) {
-            next = (here + 1) % MAXEVENTS;
-            SDL_EventQ.event[here] = SDL_EventQ.event[next];
+        SDL_EventBarrier();
+
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
+        entry->event = slot->event;
+        if (entry->event.type == SDL_SYSWMEVENT) {
+            entry->wmmsg = slot->wmmsg;
+            entry->event.syswm.msg = &entry->wmmsg;
+        }
+        entry->prev = SDL_EventQ.last;
+        entry->next = NULL;
+        if (SDL_EventQ.last) {
+            SDL_EventQ.last->next = entry;
+        } else {
+            SDL_EventQ.first = entry;
         }
-        return (spot);
+        SDL_EventQ.last = entry;
+        ++SDL_EventQ.count;
+
+        SDL_EventBarrier();
+        slot->ticket = SDL_EventQ.head + EVENTQ_SLOTS;
+        ++SDL_EventQ.head;
+        ++moved;
+    }
+    /* Count the events still in the ring too */
+    depth = SDL_EventQ.count + (int) (SDL_EventQ.tail - SDL_EventQ.head);
+    if (depth > SDL_EventQ.peak) {
+        SDL_EventQ.peak = depth;
     }
-    /* NOTREACHED */
+    return moved;
+}
+
+/* Whether the oldest slot in the ring has been claimed by a producer that
+   hasn't finished filling it in -- called with the queue locked */
+static SDL_bool
+SDL_EventRingFilling(void)
+{
+    const SDL_EventSlot *slot =
+        &SDL_EventQ.slots[SDL_EventQ.head & (EVENTQ_SLOTS - 1)];
+
+    return (SDL_EventQ.tail != SDL_EventQ.head &&
+            slot->ticket == SDL_EventQ.head) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Add an event to the event queue, returns 1 if it was added, 0 if it was
+   dropped, or -1 if the queue couldn't be locked */
+static int
+SDL_AddEvent(SDL_Event * event)
+{
+    int added;
+
+#if EVENTQ_LOCKFREE
+    if (SDL_EnqueueEvent(event)) {
+        return 1;
+    }
+    if (SDL_EventQ.count >= SDL_EventQ.max) {
+        /* Overflow, drop event without fighting the reader for the lock */
+        SDL_EventAdd(&SDL_EventQ.dropped, 1);
+        return 0;
+    }
+#endif
+    /* Make room in the ring by moving it onto the list */
+    if (SDL_mutexP(SDL_EventQ.lock) < 0) {
+        return -1;
+    }
+    while (!(added = SDL_EnqueueEvent(event))) {
+        if (!SDL_FlushEventRing()) {
+            /* Nothing could be moved, which only means the queue is full
+               if the oldest slot isn't still being filled in */
+            if (SDL_EventQ.count >= SDL_EventQ.max ||
+                !SDL_EventRingFilling()) {
+                break;
+            }
+            SDL_Delay(0);
+        }
+    }
+    if (!added) {
+        /* Overflow, drop event */
+        SDL_EventAdd(&SDL_EventQ.dropped, 1);
+    }
+    SDL_mutexV(SDL_EventQ.lock);
+    return added;
+}
+
+/* Wake up any threads sleeping until there are events */
+static void
+SDL_WakeEventWaiters(void)
+{
+    int waiting;
+
+#if EVENTQ_LOCKFREE
+    /* Pairs with the barrier in SDL_SleepUntilEvent(), so either we see
+       the waiter or it sees the new events */
+    SDL_EventBarrier();
+    waiting = SDL_EventWait.waiting;
+#else
+    /* Without a barrier only the lock makes sure of that */
+    SDL_mutexP(SDL_EventWait.lock);
+    waiting = SDL_EventWait.waiting;
+    SDL_mutexV(SDL_EventWait.lock);
+#endif
+    if (waiting) {
+        SDL_VideoDevice *_this = SDL_GetVideoDevice();
+
+        SDL_mutexP(SDL_EventWait.lock);
+        ++SDL_EventWait.wakeups;
+        SDL_CondBroadcast(SDL_EventWait.cond);
+        SDL_mutexV(SDL_EventWait.lock);
+        if (_this && _this->WakeEvents) {
+            _this->WakeEvents(_this);
+        }
+    }
+}
+
+/* Cut an entry from the list, and return the next one */
+/*                           -- called with the queue locked */
+static SDL_EventEntry *
+SDL_CutEvent(SDL_EventEntry * entry)
+{
+    SDL_EventEntry *next = entry->next;
+
+    if (entry->prev) {
+        entry->prev->next = next;
+    } else {
+        SDL_EventQ.first = next;
+    }
+    if (next) {
+        next->prev = entry->prev;
+    } else {
+        SDL_EventQ.last = entry->prev;
+    }
+    entry->next = SDL_EventQ.free;
+    SDL_EventQ.free = entry;
+    --SDL_EventQ.count;
+    return next;
 }
 
 /* Lock the event queue, take a peep at it, and unlock it */
@@ -324,42 +604,66 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                Uint32 mask)
 {
     int i, used;
+    SDL_PROFILE_BEGIN("SDL_PeepEvents queue depth");
 
     /* Don't look after we've quit */
     if (!SDL_EventQ.active) {
         return (-1);
     }
-    /* Lock the event queue */
     used = 0;
-    if (SDL_mutexP(SDL_EventQ.lock) == 0) {
-        if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+    if (action == SDL_ADDEVENT) {
+        /* Adding events doesn't lock the queue unless it's full */
+        for (i = 0; i < numevents; ++i) {
+            int added = SDL_AddEvent(&events[i]);
+            if (added < 0) {
+                SDL_SetError("Couldn't lock event queue");
+                return (used ? used : -1);
             }
-        } else {
-            SDL_Event tmpevent;
-            int spot;
-
-            /* If 'events' is NULL, just see if they exist */
-            if (events == NULL) {
-                action = SDL_PEEKEVENT;
-                numevents = 1;
-                events = &tmpevent;
-            }
-            spot = SDL_EventQ.head;
-            while ((used < numevents) && (spot != SDL_EventQ.tail)) {
-                if (mask & SDL_EVENTMASK(SDL_EventQ.event[spot].type)) {
-                    events[used++] = SDL_EventQ.event[spot];
-                    if (action == SDL_GETEVENT) {
-                        spot = SDL_CutEvent(spot);
-                    } else {
-                        spot = (spot + 1) % MAXEVENTS;
+            used += added;
+        }
+        if (used) {
+            SDL_WakeEventWaiters();
+        }
+        return (used);
+    }
+
+    /* Lock the event queue */
+    if (SDL_mutexP(SDL_EventQ.lock) == 0) {
+        SDL_Event tmpevent;
+        SDL_EventEntry *entry;
+
+        /* If 'events' is NULL, just see if they exist */
+        if (events == NULL) {
+            action = SDL_PEEKEVENT;
+            numevents = 1;
+            events = &tmpevent;
+        }
+        SDL_FlushEventRing();
+        entry = SDL_EventQ.first;
+        while ((used < numevents) && entry) {
+            if (mask & SDL_EVENTMASK(entry->event.type)) {
+                events[used++] = entry->event;
+                if (action == SDL_GETEVENT) {
+                    if (entry->event.type == SDL_SYSWMEVENT) {
+                        /* The entry is about to be reused */
+                        struct SDL_SysWMmsg *msg =
+                            &SDL_EventQ.wmmsg[SDL_EventQ.wmmsg_next];
+                        SDL_EventQ.wmmsg_next =
+                            (SDL_EventQ.wmmsg_next + 1) % MAXWMMSGS;
+                        *msg = entry->wmmsg;
+                        events[used - 1].syswm.msg = msg;
                     }
+                    entry = SDL_CutEvent(entry);
                 } else {
-                    spot = (spot + 1) % MAXEVENTS;
+                    entry = entry->next;
                 }
+            } else {
+                entry = entry->next;
             }
         }
+        /* Count how deep the queue was when we looked */
+        SDL_PROFILE_END(SDL_EventQ.count +
+                        (action == SDL_GETEVENT ? used : 0));
         SDL_mutexV(SDL_EventQ.lock);
     } else {
         SDL_SetError("Couldn't lock event queue");
@@ -368,6 +672,29 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
     return (used);
 }
 
+void
+SDL_GetEventQueueStats(int *queued, int *peak, int *dropped)
+{
+    int q = 0, p = 0, d = 0;
+
+    if (SDL_EventQ.active && SDL_mutexP(SDL_EventQ.lock) == 0) {
+        SDL_FlushEventRing();
+        q = SDL_EventQ.count + (int) (SDL_EventQ.tail - SDL_EventQ.head);
+        p = SDL_EventQ.peak;
+        d = (int) SDL_EventQ.dropped;
+        SDL_mutexV(SDL_EventQ.lock);
+    }
+    if (queued) {
+        *queued = q;
+    }
+    if (peak) {
+        *peak = p;
+    }
+    if (dropped) {
+        *dropped = d;
+    }
+}
+
 SDL_bool
 SDL_HasEvent(Uint32 mask)
 {
@@ -408,6 +735,62 @@ SDL_WaitEvent(SDL_Event * event)
     return SDL_WaitEventTimeout(event, -1);
 }
 
+/* Sleep until there might be an event, or for timeout ms (-1 is forever) */
+static void
+SDL_SleepUntilEvent(int timeout)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+    SDL_bool pump = (!SDL_EventThread && _this) ? SDL_TRUE : SDL_FALSE;
+    Uint32 wakeups;
+
+#if !SDL_JOYSTICK_DISABLED
+    /* Joysticks have to be polled */
+    if (pump && SDL_numjoysticks && (SDL_eventstate & SDL_JOYEVENTMASK) &&
+        (timeout < 0 || timeout > 10)) {
+        timeout = 10;
+    }
+#endif
+    if (!SDL_EventWait.cond) {
+        /* No other thread can add events */
+        SDL_Delay((timeout < 0 || timeout > 10) ? 10 : timeout);
+        return;
+    }
+
+    /* Check the queue after saying we're waiting, and don't hold the wait
+       lock while doing it, since an event filter may push events with the
+       queue locked.  Any event added after the check bumps wakeups. */
+    SDL_mutexP(SDL_EventWait.lock);
+    ++SDL_EventWait.waiting;
+    wakeups = SDL_EventWait.wakeups;
+    SDL_mutexV(SDL_EventWait.lock);
+    SDL_EventBarrier();
+    if (SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_ALLEVENTS) == 0) {
+        if (pump && _this->WaitEvents) {
+            /* Let the video driver sleep until it has events for us */
+            _this->WaitEvents(_this, timeout);
+        } else {
+            /* Pump the video driver every 10 ms, or wait for the event
+               thread or some other thread to add an event */
+            if (pump && (timeout < 0 || timeout > 10)) {
+                timeout = 10;
+            }
+            SDL_mutexP(SDL_EventWait.lock);
+            if (SDL_EventWait.wakeups == wakeups) {
+                if (timeout < 0) {
+                    SDL_CondWait(SDL_EventWait.cond, SDL_EventWait.lock);
+                } else {
+                    SDL_CondWaitTimeout(SDL_EventWait.cond,
+                                        SDL_EventWait.lock, timeout);
+                }
+            }
+            SDL_mutexV(SDL_EventWait.lock);
+        }
+    }
+    SDL_mutexP(SDL_EventWait.lock);
+    --SDL_EventWait.waiting;
+    SDL_mutexV(SDL_EventWait.lock);
+}
+
 int
 SDL_WaitEventTimeout(SDL_Event * event, int timeout)
 {
@@ -428,11 +811,16 @@ SDL_WaitEventTimeout(SDL_Event * event, int timeout)
                 /* Polling and no events, just return */
                 return 0;
             }
-            if (timeout > 0 && ((int) (SDL_GetTicks() - expiration) >= 0)) {
-                /* Timeout expired and no events */
-                return 0;
+            if (timeout > 0) {
+                int left = (int) (expiration - SDL_GetTicks());
+                if (left <= 0) {
+                    /* Timeout expired and no events */
+                    return 0;
+                }
+                SDL_SleepUntilEvent(left);
+            } else {
+                SDL_SleepUntilEvent(-1);
             }
-            SDL_Delay(10);
             break;
         }
     }
@@ -477,14 +865,15 @@ void
 SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (SDL_mutexP(SDL_EventQ.lock) == 0) {
-        int spot;
+        SDL_EventEntry *entry;
 
-        spot = SDL_EventQ.head;
-        while (spot != SDL_EventQ.tail) {
-            if (filter(userdata, &SDL_EventQ.event[spot])) {
-                spot = (spot + 1) % MAXEVENTS;
+        SDL_FlushEventRing();
+        entry = SDL_EventQ.first;
+        while (entry) {
+            if (filter(userdata, &entry->event)) {
+                entry = entry->next;
             } else {
-                spot = SDL_CutEvent(spot);
+                entry = SDL_CutEvent(entry);
             }
         }
     }
@@ -0,0 +1,392 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Loading images and sounds on background threads.
+
+   Loads run as tasks on a thread pool of their own, so that the number
+   of threads in it bounds how many run at once.  The shared pool isn't
+   used because a thread waiting there runs any queued task, and the
+   main loop would end up doing a load itself when it waits for a blit.
+
+   A load is held by the caller and by its task, and is freed when both
+   have let go of it, so cancelling never has to wait for the task.  The
+   completion event is pushed before the final status can be seen, so by
+   the time the caller knows the load finished its event is queued, and
+   the caller can handle it before freeing the load.
+ */
+
+#include "SDL_events.h"
+#include "SDL_thread.h"
+#include "SDL_threadpool.h"
+#include "SDL_asyncload.h"
+
+#define SDL_ASYNC_LOAD_DEFAULT_THREADS  2
+
+typedef enum
+{
+    SDL_ASYNC_LOAD_BMP,
+    SDL_ASYNC_LOAD_WAV
+} SDL_AsyncLoadType;
+
+struct SDL_AsyncLoad
+{
+    SDL_AsyncLoadType type;
+    SDL_RWops *src;
+    int freesrc;
+    Uint8 event;
+
+    SDL_mutex *lock;
+    SDL_cond *finished;
+    SDL_AsyncLoadStatus status;
+    int refcount;
+    char *error;
+
+    /* The result, until the caller takes it */
+    SDL_Surface *surface;
+    SDL_AudioSpec spec;
+    Uint8 *audio_buf;
+    Uint32 audio_len;
+};
+
+static SDL_ThreadPool *SDL_async_pool = NULL;
+static SDL_TaskGroup *SDL_async_group = NULL;
+static volatile SDL_bool SDL_async_quit = SDL_FALSE;
+
+static void
+SDL_ReleaseAsyncLoad(SDL_AsyncLoad * load)
+{
+    int refcount;
+
+    SDL_mutexP(load->lock);
+    refcount = --load->refcount;
+    SDL_mutexV(load->lock);
+
+    if (refcount == 0) {
+        SDL_FreeSurface(load->surface);
+        SDL_FreeWAV(load->audio_buf);
+        if (load->error) {
+            SDL_free(load->error);
+        }
+        SDL_DestroyCond(load->finished);
+        SDL_DestroyMutex(load->lock);
+        SDL_free(load);
+    }
+}
+
+static void SDLCALL
+SDL_RunAsyncLoad(void *data)
+{
+    SDL_AsyncLoad *load = (SDL_AsyncLoad *) data;
+    SDL_Surface *surface = NULL;
+    SDL_AudioSpec spec;
+    Uint8 *audio_buf = NULL;
+    Uint32 audio_len = 0;
+    SDL_bool loaded;
+    SDL_Event event;
+
+    SDL_mutexP(load->lock);
+    if (load->status == SDL_ASYNCLOAD_PENDING && SDL_async_quit) {
+        load->status = SDL_ASYNCLOAD_CANCELLED;
+        SDL_CondBroadcast(load->finished);
+    }
+    if (load->status == SDL_ASYNCLOAD_CANCELLED) {
+        SDL_mutexV(load->lock);
+        if (load->freesrc) {
+            SDL_RWclose(load->src);
+        }
+        SDL_ReleaseAsyncLoad(load);
+        return;
+    }
+    load->status = SDL_ASYNCLOAD_LOADING;
+    SDL_mutexV(load->lock);
+
+    /* The loaders close the source themselves */
+    if (load->type == SDL_ASYNC_LOAD_BMP) {
+        surface = SDL_LoadBMP_RW(load->src, load->freesrc);
+        loaded = (surface != NULL);
+    } else {
+        loaded = (SDL_LoadWAV_RW(load->src, load->freesrc, &spec,
+                                 &audio_buf, &audio_len) != NULL);
+    }
+
+    SDL_mutexP(load->lock);
+    if (load->status == SDL_ASYNCLOAD_CANCELLED) {
+        /* Nobody wants it any more */
+        SDL_FreeSurface(surface);
+        SDL_FreeWAV(audio_buf);
+    } else if (loaded) {
+        load->surface = surface;
+        load->spec = spec;
+        load->audio_buf = audio_buf;
+        load->audio_len = audio_len;
+        load->status = SDL_ASYNCLOAD_DONE;
+    } else {
+        /* The error belongs to this thread, so keep a copy for the caller */
+        load->error = SDL_strdup(SDL_GetError());
+        load->status = SDL_ASYNCLOAD_FAILED;
+    }
+    if (load->event && load->status != SDL_ASYNCLOAD_CANCELLED) {
+        SDL_zero(event);
+        event.type = load->event;
+        event.user.code = load->status;
+        event.user.data1 = load;
+        SDL_PushEvent(&event);
+    }
+    SDL_CondBroadcast(load->finished);
+    SDL_mutexV(load->lock);
+
+    SDL_ReleaseAsyncLoad(load);
+}
+
+static int
+SDL_StartAsyncLoadPool(void)
+{
+    const char *env = SDL_getenv("SDL_ASYNC_LOAD_THREADS");
+    int num_threads = SDL_ASYNC_LOAD_DEFAULT_THREADS;
+
+    if (env && SDL_atoi(env) > 0) {
+        num_threads = SDL_atoi(env);
+    }
+    SDL_async_pool = SDL_CreateThreadPool(num_threads);
+    if (!SDL_async_pool) {
+        return -1;
+    }
+    SDL_async_group = SDL_CreateTaskGroup(SDL_async_pool);
+    if (!SDL_async_group) {
+        SDL_DestroyThreadPool(SDL_async_pool);
+        SDL_async_pool = NULL;
+        return -1;
+    }
+    SDL_async_quit = SDL_FALSE;
+    return 0;
+}
+
+static SDL_AsyncLoad *
+SDL_StartAsyncLoad(SDL_AsyncLoadType type, SDL_RWops * src, int freesrc,
+                   Uint8 event)
+{
+    SDL_AsyncLoad *load;
+
+    /* The error is already set if the file couldn't be opened */
+    if (src == NULL) {
+        return NULL;
+    }
+    if (event && (event < SDL_USEREVENT || event >= SDL_NUMEVENTS)) {
+        SDL_SetError("Event type %d isn't a user event", event);
+        goto error;
+    }
+
+    load = (SDL_AsyncLoad *) SDL_calloc(1, sizeof(*load));
+    if (!load) {
+        SDL_OutOfMemory();
+        goto error;
+    }
+    load->lock = SDL_CreateMutex();
+    load->finished = SDL_CreateCond();
+    if (!load->lock || !load->finished) {
+        if (load->lock) {
+            SDL_DestroyMutex(load->lock);
+        }
+        if (load->finished) {
+            SDL_DestroyCond(load->finished);
+        }
+        SDL_free(load);
+        goto error;
+    }
+    load->type = type;
+    load->src = src;
+    load->freesrc = freesrc;
+    load->event = event;
+    load->status = SDL_ASYNCLOAD_PENDING;
+    load->refcount = 2;         /* one for the caller, one for the task */
+
+    /* Without background threads, load it here instead */
+    if ((!SDL_async_pool && SDL_StartAsyncLoadPool() < 0) ||
+        SDL_SubmitTask(SDL_async_group, SDL_RunAsyncLoad, load) < 0) {
+        SDL_RunAsyncLoad(load);
+    }
+    return load;
+
+  error:
+    if (freesrc) {
+        SDL_RWclose(src);
+    }
+    return NULL;
+}
+
+SDL_AsyncLoad *
+SDL_LoadBMPAsync_RW(SDL_RWops * src, int freesrc, Uint8 event)
+{
+    return SDL_StartAsyncLoad(SDL_ASYNC_LOAD_BMP, src, freesrc, event);
+}
+
+SDL_AsyncLoad *
+SDL_LoadWAVAsync_RW(SDL_RWops * src, int freesrc, Uint8 event)
+{
+    return SDL_StartAsyncLoad(SDL_ASYNC_LOAD_WAV, src, freesrc, event);
+}
+
+/* Call with the load locked */
+static SDL_AsyncLoadStatus
+SDL_CheckAsyncLoad(SDL_AsyncLoad * load)
+{
+    if (load->status == SDL_ASYNCLOAD_FAILED) {
+        SDL_SetError("%s", load->error ? load->error : "Out of memory");
+    }
+    return load->status;
+}
+
+SDL_AsyncLoadStatus
+SDL_GetAsyncLoadStatus(SDL_AsyncLoad * load)
+{
+    SDL_AsyncLoadStatus status;
+
+    if (!load) {
+        SDL_SetError("Passed a NULL load");
+        return SDL_ASYNCLOAD_FAILED;
+    }
+    SDL_mutexP(load->lock);
+    status = SDL_CheckAsyncLoad(load);
+    SDL_mutexV(load->lock);
+    return status;
+}
+
+SDL_AsyncLoadStatus
+SDL_WaitAsyncLoad(SDL_AsyncLoad * load)
+{
+    SDL_AsyncLoadStatus status;
+
+    if (!load) {
+        SDL_SetError("Passed a NULL load");
+        return SDL_ASYNCLOAD_FAILED;
+    }
+    SDL_mutexP(load->lock);
+    while (load->status == SDL_ASYNCLOAD_PENDING ||
+           load->status == SDL_ASYNCLOAD_LOADING) {
+        SDL_CondWait(load->finished, load->lock);
+    }
+    status = SDL_CheckAsyncLoad(load);
+    SDL_mutexV(load->lock);
+    return status;
+}
+
+int
+SDL_CancelAsyncLoad(SDL_AsyncLoad * load)
+{
+    int retval = -1;
+
+    if (!load) {
+        SDL_SetError("Passed a NULL load");
+        return -1;
+    }
+    SDL_mutexP(load->lock);
+    if (load->status == SDL_ASYNCLOAD_PENDING ||
+        load->status == SDL_ASYNCLOAD_LOADING) {
+        load->status = SDL_ASYNCLOAD_CANCELLED;
+        SDL_CondBroadcast(load->finished);
+        retval = 0;
+    } else {
+        SDL_SetError("The load has already finished");
+    }
+    SDL_mutexV(load->lock);
+    return retval;
+}
+
+SDL_Surface *
+SDL_GetAsyncLoadSurface(SDL_AsyncLoad * load)
+{
+    SDL_Surface *surface = NULL;
+
+    if (!load || load->type != SDL_ASYNC_LOAD_BMP) {
+        SDL_SetError("Not a BMP load");
+        return NULL;
+    }
+    SDL_mutexP(load->lock);
+    if (load->status == SDL_ASYNCLOAD_DONE) {
+        surface = load->surface;
+        load->surface = NULL;
+    }
+    SDL_mutexV(load->lock);
+    if (!surface) {
+        SDL_SetError("The load isn't done, or the surface was taken");
+    }
+    return surface;
+}
+
+SDL_AudioSpec *
+SDL_GetAsyncLoadWAV(SDL_AsyncLoad * load, SDL_AudioSpec * spec,
+                    Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    SDL_bool taken = SDL_FALSE;
+
+    if (!load || load->type != SDL_ASYNC_LOAD_WAV) {
+        SDL_SetError("Not a WAVE load");
+        return NULL;
+    }
+    SDL_mutexP(load->lock);
+    if (load->status == SDL_ASYNCLOAD_DONE && load->audio_buf) {
+        *spec = load->spec;
+        *audio_buf = load->audio_buf;
+        *audio_len = load->audio_len;
+        load->audio_buf = NULL;
+        taken = SDL_TRUE;
+    }
+    SDL_mutexV(load->lock);
+    if (!taken) {
+        SDL_SetError("The load isn't done, or the sound was taken");
+        return NULL;
+    }
+    return spec;
+}
+
+void
+SDL_FreeAsyncLoad(SDL_AsyncLoad * load)
+{
+    if (!load) {
+        return;
+    }
+    SDL_mutexP(load->lock);
+    if (load->status == SDL_ASYNCLOAD_PENDING ||
+        load->status == SDL_ASYNCLOAD_LOADING) {
+        load->status = SDL_ASYNCLOAD_CANCELLED;
+        SDL_CondBroadcast(load->finished);
+    }
+    SDL_mutexV(load->lock);
+    SDL_ReleaseAsyncLoad(load);
+}
+
+/* Called by SDL_Quit() before the subsystems shut down: loads that haven't
+   started are cancelled, and the ones running are finished. */
+void
+SDL_AsyncLoadQuit(void)
+{
+    if (SDL_async_pool) {
+        SDL_async_quit = SDL_TRUE;
+        SDL_DestroyTaskGroup(SDL_async_group);
+        SDL_DestroyThreadPool(SDL_async_pool);
+        SDL_async_group = NULL;
+        SDL_async_pool = NULL;
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -19,6 +19,8 @@
     Sam Lantinga
     slouken@libsdl.org
 */
+/* Need this so Linux systems define fopen64, fseeko64, lseek64 and off64_t */
+#define _LARGEFILE64_SOURCE
 #include "SDL_config.h"
 
 /* This file provides a general interface for SDL to read and write
@@ -28,11 +30,63 @@
 #include "SDL_endian.h"
 #include "SDL_rwops.h"
 
+#ifdef HAVE_UNISTD_H
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 #ifdef __NDS__
 /* include libfat headers for fatInitDefault(). */
 #include <fat.h>
 #endif /* __NDS__ */
 
+/* Find the size by seeking to the end and back, for data sources that
+   have no better way */
+static Sint64 SDLCALL
+generic_size(SDL_RWops * context)
+{
+    Sint64 pos, size;
+
+    pos = SDL_RWseek(context, 0, RW_SEEK_CUR);
+    if (pos < 0) {
+        return (-1);
+    }
+    size = SDL_RWseek(context, 0, RW_SEEK_END);
+    SDL_RWseek(context, pos, RW_SEEK_SET);
+    return size;
+}
+
+#ifdef HAVE_UNISTD_H
+/* Ask the file system for the size of a file descriptor, which only
+   knows it for regular files.  Returns -1 if it doesn't know.
+ */
+static Sint64
+fd_file_size(int fd)
+{
+#ifdef HAVE_FSTAT64
+    struct stat64 st;
+
+    if (fstat64(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        return ((Sint64) st.st_size);
+    }
+#else
+    struct stat st;
+
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+        (Sint64) st.st_size == st.st_size) {
+        return ((Sint64) st.st_size);
+    }
+#endif
+    return (-1);
+}
+#endif /* HAVE_UNISTD_H */
+
 #ifdef __WIN32__
 
 /* Functions to read/write Win32 API file pointers */
@@ -46,6 +100,9 @@
 #ifndef INVALID_SET_FILE_POINTER
 #define INVALID_SET_FILE_POINTER 0xFFFFFFFF
 #endif
+#ifndef INVALID_FILE_SIZE
+#define INVALID_FILE_SIZE 0xFFFFFFFF
+#endif
 
 #define READAHEAD_BUFFER_SIZE	1024
 
@@ -137,11 +194,30 @@ win32_file_open(SDL_RWops * context, const char *filename, const char *mode)
     return 0;                   /* ok */
 }
 
-static long SDLCALL
-win32_file_seek(SDL_RWops * context, long offset, int whence)
+static Sint64 SDLCALL
+win32_file_size(SDL_RWops * context)
+{
+    DWORD low, high;
+
+    if (!context || context->hidden.win32io.h == INVALID_HANDLE_VALUE) {
+        SDL_SetError("win32_file_size: invalid context/file not opened");
+        return -1;
+    }
+
+    low = GetFileSize(context->hidden.win32io.h, &high);
+    if (low == INVALID_FILE_SIZE && GetLastError() != NO_ERROR) {
+        SDL_Error(SDL_EFSEEK);
+        return -1;
+    }
+    return ((Sint64) high << 32) | low;
+}
+
+static Sint64 SDLCALL
+win32_file_seek(SDL_RWops * context, Sint64 offset, int whence)
 {
     DWORD win32whence;
-    long file_pos;
+    LONG high;
+    DWORD low;
 
     if (!context || context->hidden.win32io.h == INVALID_HANDLE_VALUE) {
         SDL_SetError("win32_file_seek: invalid context/file not opened");
@@ -169,11 +245,13 @@ win32_file_seek(SDL_RWops * context, long offset, int whence)
         return -1;
     }
 
-    file_pos =
-        SetFilePointer(context->hidden.win32io.h, offset, NULL, win32whence);
+    /* The high part is only checked for errors if the low part fails */
+    high = (LONG) (offset >> 32);
+    low = SetFilePointer(context->hidden.win32io.h, (LONG) offset, &high,
+                         win32whence);
 
-    if (file_pos != INVALID_SET_FILE_POINTER)
-        return file_pos;        /* success */
+    if (low != INVALID_SET_FILE_POINTER || GetLastError() == NO_ERROR)
+        return ((Sint64) high << 32) | low;     /* success */
 
     SDL_Error(SDL_EFSEEK);
     return -1;                  /* error */
@@ -296,11 +374,51 @@ win32_file_close(SDL_RWops * context)
 
 /* Functions to read/write stdio file pointers */
 
-static long SDLCALL
-stdio_seek(SDL_RWops * context, long offset, int whence)
+/* Use the 64-bit versions of the file functions where there are any */
+#ifdef HAVE_FOPEN64
+#define fopen   fopen64
+#endif
+#if defined(HAVE_FSEEKO64)
+typedef off64_t fseek_off_t;
+#define fseek   fseeko64
+#define ftell   ftello64
+#elif defined(HAVE_FSEEKO)
+typedef off_t fseek_off_t;
+#define fseek   fseeko
+#define ftell   ftello
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+typedef __int64 fseek_off_t;
+#define fseek   _fseeki64
+#define ftell   _ftelli64
+#else
+typedef long fseek_off_t;
+#endif
+
+static Sint64 SDLCALL
+stdio_size(SDL_RWops * context)
 {
-    if (fseek(context->hidden.stdio.fp, offset, whence) == 0) {
-        return (ftell(context->hidden.stdio.fp));
+#ifdef HAVE_UNISTD_H
+    Sint64 size, pos;
+
+    /* Writes still in the stdio buffer end where the file is positioned */
+    size = fd_file_size(fileno(context->hidden.stdio.fp));
+    if (size >= 0) {
+        pos = (Sint64) ftell(context->hidden.stdio.fp);
+        return SDL_max(size, pos);
+    }
+#endif
+    return generic_size(context);
+}
+
+static Sint64 SDLCALL
+stdio_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    if ((fseek_off_t) offset != offset) {
+        SDL_SetError("Seek offset out of range");
+        return (-1);
+    }
+    if (fseek(context->hidden.stdio.fp, (fseek_off_t) offset, whence) == 0) {
+        return ((Sint64) ftell(context->hidden.stdio.fp));
     } else {
         SDL_Error(SDL_EFSEEK);
         return (-1);
@@ -349,35 +467,160 @@ stdio_close(SDL_RWops * context)
 }
 #endif /* !HAVE_STDIO_H */
 
+#ifdef HAVE_UNISTD_H
+
+/* Functions to read/write POSIX file descriptors */
+
+static Sint64 SDLCALL
+fd_size(SDL_RWops * context)
+{
+    Sint64 size;
+
+    size = fd_file_size(context->hidden.fd.fd);
+    if (size < 0) {
+        /* Devices can often still seek */
+        size = generic_size(context);
+    }
+    return size;
+}
+
+static Sint64 SDLCALL
+fd_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    Sint64 pos;
+
+#ifdef HAVE_LSEEK64
+    pos = (Sint64) lseek64(context->hidden.fd.fd, (off64_t) offset, whence);
+#else
+    if ((off_t) offset != offset) {
+        SDL_SetError("Seek offset out of range");
+        return (-1);
+    }
+    pos = (Sint64) lseek(context->hidden.fd.fd, (off_t) offset, whence);
+#endif
+    if (pos < 0) {
+        SDL_Error(SDL_EFSEEK);
+        return (-1);
+    }
+    return pos;
+}
+
+static size_t SDLCALL
+fd_read(SDL_RWops * context, void *ptr, size_t size, size_t maxnum)
+{
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t total_bytes, left;
+    ssize_t nread;
+
+    total_bytes = (maxnum * size);
+    if ((maxnum <= 0) || (size <= 0)
+        || ((total_bytes / maxnum) != (size_t) size)) {
+        return 0;
+    }
+
+    /* Pipes and signals can cut a read short, so keep going until the
+       end of the data */
+    left = total_bytes;
+    while (left > 0) {
+        nread = read(context->hidden.fd.fd, dst, left);
+        if (nread < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SDL_Error(SDL_EFREAD);
+            break;
+        }
+        if (nread == 0) {
+            break;
+        }
+        dst += nread;
+        left -= nread;
+    }
+    return ((total_bytes - left) / size);
+}
+
+static size_t SDLCALL
+fd_write(SDL_RWops * context, const void *ptr, size_t size, size_t num)
+{
+    const Uint8 *src = (const Uint8 *) ptr;
+    size_t total_bytes, left;
+    ssize_t nwrote;
+
+    total_bytes = (num * size);
+    if ((num <= 0) || (size <= 0) || ((total_bytes / num) != (size_t) size)) {
+        return 0;
+    }
+
+    left = total_bytes;
+    while (left > 0) {
+        nwrote = write(context->hidden.fd.fd, src, left);
+        if (nwrote < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SDL_Error(SDL_EFWRITE);
+            break;
+        }
+        src += nwrote;
+        left -= nwrote;
+    }
+    return ((total_bytes - left) / size);
+}
+
+static int SDLCALL
+fd_close(SDL_RWops * context)
+{
+    int status = 0;
+    if (context) {
+        if (context->hidden.fd.autoclose) {
+            if (close(context->hidden.fd.fd) < 0) {
+                SDL_Error(SDL_EFWRITE);
+                status = -1;
+            }
+        }
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+#endif /* HAVE_UNISTD_H */
+
 /* Functions to read/write memory pointers */
 
-static long SDLCALL
-mem_seek(SDL_RWops * context, long offset, int whence)
+static Sint64 SDLCALL
+mem_size(SDL_RWops * context)
 {
-    Uint8 *newpos;
+    return (Sint64) (context->hidden.mem.stop - context->hidden.mem.base);
+}
+
+static Sint64 SDLCALL
+mem_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    Sint64 newpos;
 
     switch (whence) {
     case RW_SEEK_SET:
-        newpos = context->hidden.mem.base + offset;
+        newpos = offset;
         break;
     case RW_SEEK_CUR:
-        newpos = context->hidden.mem.here + offset;
+        newpos = (context->hidden.mem.here - context->hidden.mem.base) +
+            offset;
         break;
     case RW_SEEK_END:
-        newpos = context->hidden.mem.stop + offset;
+        newpos = (context->hidden.mem.stop - context->hidden.mem.base) +
+            offset;
         break;
     default:
         SDL_SetError("Unknown value for 'whence'");
         return (-1);
     }
-    if (newpos < context->hidden.mem.base) {
-        newpos = context->hidden.mem.base;
+    if (newpos < 0) {
+        newpos = 0;
     }
-    if (newpos > context->hidden.mem.stop) {
-        newpos = context->hidden.mem.stop;
+    if (newpos > mem_size(context)) {
+        newpos = mem_size(context);
     }
-    context->hidden.mem.here = newpos;
-    return (context->hidden.mem.here - context->hidden.mem.base);
+    context->hidden.mem.here = context->hidden.mem.base + (size_t) newpos;
+    return newpos;
 }
 
 static size_t SDLCALL
@@ -430,6 +673,179 @@ mem_close(SDL_RWops * context)
     return (0);
 }
 
+#ifdef HAVE_MMAP
+/* Memory mapped files are read with the memory functions */
+
+static int SDLCALL
+mmap_close(SDL_RWops * context)
+{
+    if (context) {
+        munmap(context->hidden.mem.base,
+               context->hidden.mem.stop - context->hidden.mem.base);
+        SDL_FreeRW(context);
+    }
+    return (0);
+}
+#endif /* HAVE_MMAP */
+
+/* Functions to read another SDL_RWops through a buffer
+
+   The buffer holds the data from 'offset' in the source, between 'base'
+   and 'stop', and the source is always positioned at 'stop'.
+ */
+
+#define BUFFERED_DEFAULT_SIZE   (64 * 1024)
+
+/* Where reading has got to in the source */
+#define buffered_tell(context) \
+    ((context)->hidden.buffered.offset + \
+     ((context)->hidden.buffered.here - (context)->hidden.buffered.base))
+
+static void
+buffered_empty(SDL_RWops * context, Sint64 offset)
+{
+    context->hidden.buffered.here = context->hidden.buffered.base;
+    context->hidden.buffered.stop = context->hidden.buffered.base;
+    context->hidden.buffered.offset = offset;
+}
+
+static Sint64 SDLCALL
+buffered_size(SDL_RWops * context)
+{
+    return SDL_RWsize(context->hidden.buffered.source);
+}
+
+static Sint64 SDLCALL
+buffered_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    SDL_RWops *source = context->hidden.buffered.source;
+    Sint64 newpos;
+
+    switch (whence) {
+    case RW_SEEK_SET:
+        newpos = offset;
+        break;
+    case RW_SEEK_CUR:
+        newpos = buffered_tell(context) + offset;
+        break;
+    case RW_SEEK_END:
+        newpos = SDL_RWseek(source, offset, RW_SEEK_END);
+        if (newpos >= 0) {
+            buffered_empty(context, newpos);
+        }
+        return newpos;
+    default:
+        SDL_SetError("Unknown value for 'whence'");
+        return (-1);
+    }
+
+    /* Seeking within the buffer doesn't need the source */
+    if (newpos >= context->hidden.buffered.offset &&
+        newpos <= context->hidden.buffered.offset +
+        (context->hidden.buffered.stop - context->hidden.buffered.base)) {
+        context->hidden.buffered.here = context->hidden.buffered.base +
+            (newpos - context->hidden.buffered.offset);
+        return newpos;
+    }
+
+    newpos = SDL_RWseek(source, newpos, RW_SEEK_SET);
+    if (newpos >= 0) {
+        buffered_empty(context, newpos);
+    }
+    return newpos;
+}
+
+static size_t SDLCALL
+buffered_read(SDL_RWops * context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_RWops *source = context->hidden.buffered.source;
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t total_bytes, left, available, nread;
+
+    total_bytes = (maxnum * size);
+    if ((maxnum <= 0) || (size <= 0)
+        || ((total_bytes / maxnum) != (size_t) size)) {
+        return 0;
+    }
+
+    left = total_bytes;
+    while (left > 0) {
+        available =
+            (context->hidden.buffered.stop - context->hidden.buffered.here);
+        if (available > 0) {
+            if (available > left) {
+                available = left;
+            }
+            SDL_memcpy(dst, context->hidden.buffered.here, available);
+            context->hidden.buffered.here += available;
+            dst += available;
+            left -= available;
+            continue;
+        }
+
+        /* The buffer is used up, start it again where the source is */
+        buffered_empty(context, buffered_tell(context));
+        if (left >= context->hidden.buffered.size) {
+            nread = SDL_RWread(source, dst, 1, left);
+            context->hidden.buffered.offset += nread;
+            dst += nread;
+            left -= nread;
+            break;
+        }
+        nread = SDL_RWread(source, context->hidden.buffered.base, 1,
+                           context->hidden.buffered.size);
+        if (nread == 0) {
+            break;
+        }
+        context->hidden.buffered.stop += nread;
+    }
+    return ((total_bytes - left) / size);
+}
+
+static size_t SDLCALL
+buffered_write(SDL_RWops * context, const void *ptr, size_t size,
+               size_t num)
+{
+    SDL_RWops *source = context->hidden.buffered.source;
+    Sint64 offset;
+    size_t nwrote;
+
+    /* Put the source back where reading got to and forget the buffer */
+    offset = buffered_tell(context);
+    if (context->hidden.buffered.stop != context->hidden.buffered.base) {
+        if (SDL_RWseek(source, offset, RW_SEEK_SET) < 0) {
+            return (0);
+        }
+    }
+    nwrote = SDL_RWwrite(source, ptr, size, num);
+    if (nwrote != (size_t) - 1) {
+        offset += (Sint64) (nwrote * size);
+    }
+    buffered_empty(context, offset);
+    return (nwrote);
+}
+
+static int SDLCALL
+buffered_close(SDL_RWops * context)
+{
+    SDL_RWops *source;
+    int status = 0;
+
+    if (context) {
+        source = context->hidden.buffered.source;
+        if (context->hidden.buffered.autoclose) {
+            status = SDL_RWclose(source);
+        } else if (context->hidden.buffered.here !=
+                   context->hidden.buffered.stop) {
+            /* Give back what was read ahead, if the source can seek */
+            SDL_RWseek(source, buffered_tell(context), RW_SEEK_SET);
+        }
+        SDL_free(context->hidden.buffered.base);
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
 
 /* Functions to create SDL_RWops structures from various data sources */
 
@@ -452,6 +868,7 @@ SDL_RWFromFile(const char *file, const char *mode)
         SDL_FreeRW(rwops);
         return NULL;
     }
+    rwops->size = win32_file_size;
     rwops->seek = win32_file_seek;
     rwops->read = win32_file_read;
     rwops->write = win32_file_write;
@@ -487,6 +904,7 @@ SDL_RWFromFP(FILE * fp, SDL_bool autoclose)
 
     rwops = SDL_AllocRW();
     if (rwops != NULL) {
+        rwops->size = stdio_size;
         rwops->seek = stdio_seek;
         rwops->read = stdio_read;
         rwops->write = stdio_write;
@@ -498,6 +916,29 @@ SDL_RWFromFP(FILE * fp, SDL_bool autoclose)
 }
 #endif /* HAVE_STDIO_H */
 
+SDL_RWops *
+SDL_RWFromFD(int fd, SDL_bool autoclose)
+{
+#ifdef HAVE_UNISTD_H
+    SDL_RWops *rwops;
+
+    rwops = SDL_AllocRW();
+    if (rwops != NULL) {
+        rwops->size = fd_size;
+        rwops->seek = fd_seek;
+        rwops->read = fd_read;
+        rwops->write = fd_write;
+        rwops->close = fd_close;
+        rwops->hidden.fd.fd = fd;
+        rwops->hidden.fd.autoclose = autoclose;
+    }
+    return (rwops);
+#else
+    SDL_SetError("SDL not compiled with file descriptor support");
+    return NULL;
+#endif /* HAVE_UNISTD_H */
+}
+
 SDL_RWops *
 SDL_RWFromMem(void *mem, int size)
 {
@@ -505,6 +946,7 @@ SDL_RWFromMem(void *mem, int size)
 
     rwops = SDL_AllocRW();
     if (rwops != NULL) {
+        rwops->size = mem_size;
         rwops->seek = mem_seek;
         rwops->read = mem_read;
         rwops->write = mem_write;
@@ -523,6 +965,7 @@ SDL_RWFromConstMem(const void *mem, int size)
 
     rwops = SDL_AllocRW();
     if (rwops != NULL) {
+        rwops->size = mem_size;
         rwops->seek = mem_seek;
         rwops->read = mem_read;
         rwops->write = mem_writeconst;
@@ -534,6 +977,119 @@ SDL_RWFromConstMem(const void *mem, int size)
     return (rwops);
 }
 
+SDL_RWops *
+SDL_RWFromMappedFile(const char *file)
+{
+#if defined(HAVE_MMAP) && defined(HAVE_UNISTD_H)
+    SDL_RWops *rwops;
+    struct stat st;
+    size_t size;
+    void *base;
+    int fd;
+
+    if (!file || !*file) {
+        SDL_SetError("SDL_RWFromMappedFile(): No file specified");
+        return NULL;
+    }
+    fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        SDL_SetError("Couldn't open %s", file);
+        return NULL;
+    }
+
+    /* Pipes, devices and empty files can't be mapped */
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        (off_t) (size_t) st.st_size != st.st_size) {
+        close(fd);
+        return SDL_RWFromFile(file, "rb");
+    }
+    size = (size_t) st.st_size;
+    base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return SDL_RWFromFile(file, "rb");
+    }
+#ifdef HAVE_MADVISE
+    /* Files are mostly read from start to end, so read ahead */
+    madvise(base, size, MADV_SEQUENTIAL);
+    madvise(base, size, MADV_WILLNEED);
+#endif
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        munmap(base, size);
+        return NULL;
+    }
+    rwops->size = mem_size;
+    rwops->seek = mem_seek;
+    rwops->read = mem_read;
+    rwops->write = mem_writeconst;
+    rwops->close = mmap_close;
+    rwops->hidden.mem.base = (Uint8 *) base;
+    rwops->hidden.mem.here = rwops->hidden.mem.base;
+    rwops->hidden.mem.stop = rwops->hidden.mem.base + size;
+    return (rwops);
+#else
+    return SDL_RWFromFile(file, "rb");
+#endif /* HAVE_MMAP && HAVE_UNISTD_H */
+}
+
+const void *
+SDL_RWGetMemory(SDL_RWops * context, size_t * size)
+{
+    if (!context || context->read != mem_read) {
+        if (size) {
+            *size = 0;
+        }
+        return NULL;
+    }
+    if (size) {
+        *size = (context->hidden.mem.stop - context->hidden.mem.base);
+    }
+    return context->hidden.mem.base;
+}
+
+SDL_RWops *
+SDL_RWFromBufferedRW(SDL_RWops * source, size_t size, SDL_bool autoclose)
+{
+    SDL_RWops *rwops;
+    Sint64 offset;
+
+    if (!source) {
+        SDL_SetError("SDL_RWFromBufferedRW(): No source specified");
+        return NULL;
+    }
+    if (size == 0) {
+        size = BUFFERED_DEFAULT_SIZE;
+    }
+
+    /* Sources that can't tell where they are count from here */
+    offset = SDL_RWtell(source);
+    if (offset < 0) {
+        offset = 0;
+    }
+
+    rwops = SDL_AllocRW();
+    if (rwops != NULL) {
+        rwops->hidden.buffered.base = (Uint8 *) SDL_malloc(size);
+        if (!rwops->hidden.buffered.base) {
+            SDL_FreeRW(rwops);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        rwops->size = buffered_size;
+        rwops->seek = buffered_seek;
+        rwops->read = buffered_read;
+        rwops->write = buffered_write;
+        rwops->close = buffered_close;
+        rwops->hidden.buffered.source = source;
+        rwops->hidden.buffered.autoclose = autoclose;
+        rwops->hidden.buffered.size = size;
+        buffered_empty(rwops, offset);
+    }
+    return (rwops);
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
@@ -542,6 +1098,8 @@ SDL_AllocRW(void)
     area = (SDL_RWops *) SDL_malloc(sizeof *area);
     if (area == NULL) {
         SDL_OutOfMemory();
+    } else {
+        area->size = generic_size;
     }
     return (area);
 }
@@ -554,12 +1112,28 @@ SDL_FreeRW(SDL_RWops * area)
 
 /* Functions for dynamically reading and writing endian-specific values */
 
+/* Memory and buffered data sources have what's left of their data between
+   'here' and 'stop', so small values can be taken straight from there
+   instead of calling 'read'.
+ */
+static __inline__ void
+read_value(SDL_RWops * src, void *value, size_t size)
+{
+    if ((src->read == mem_read || src->read == buffered_read) &&
+        (size_t) (src->hidden.mem.stop - src->hidden.mem.here) >= size) {
+        SDL_memcpy(value, src->hidden.mem.here, size);
+        src->hidden.mem.here += size;
+    } else {
+        SDL_RWread(src, value, size, 1);
+    }
+}
+
 Uint16
 SDL_ReadLE16(SDL_RWops * src)
 {
     Uint16 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapLE16(value));
 }
 
@@ -568,7 +1142,7 @@ SDL_ReadBE16(SDL_RWops * src)
 {
     Uint16 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapBE16(value));
 }
 
@@ -577,7 +1151,7 @@ SDL_ReadLE32(SDL_RWops * src)
 {
     Uint32 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapLE32(value));
 }
 
@@ -586,7 +1160,7 @@ SDL_ReadBE32(SDL_RWops * src)
 {
     Uint32 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapBE32(value));
 }
 
@@ -595,7 +1169,7 @@ SDL_ReadLE64(SDL_RWops * src)
 {
     Uint64 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapLE64(value));
 }
 
@@ -604,7 +1178,7 @@ SDL_ReadBE64(SDL_RWops * src)
 {
     Uint64 value;
 
-    SDL_RWread(src, &value, (sizeof value), 1);
+    read_value(src, &value, (sizeof value));
     return (SDL_SwapBE64(value));
 }
 
@@ -0,0 +1,621 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* A work stealing thread pool, built on the system independent thread,
+   mutex, semaphore and condition variable routines.
+
+   Each worker has its own queue.  Tasks submitted by a worker go on the
+   end of its queue, and it takes the newest task from there first, so a
+   task's subtasks usually run on the thread whose cache they're in.
+   Tasks submitted by any other thread go on a shared queue.  A worker
+   whose queue is empty takes the oldest task from the shared queue, and
+   then from the other workers.
+
+   The 'queued' semaphore counts the tasks that nobody has claimed yet.
+   A thread only looks for a task after taking a count from it, so there
+   is always a task waiting somewhere for every thread that is looking.
+ */
+
+#include "SDL_thread.h"
+#include "SDL_threadpool.h"
+#include "SDL_cpuinfo.h"
+
+#define SDL_POOL_MAX_THREADS        64
+#define SDL_POOL_INITIAL_QUEUE      64
+/* How many pieces SDL_ParallelFor() makes for each thread, so a thread
+   that finishes early can take work from one that's running behind */
+#define SDL_POOL_PIECES_PER_THREAD  4
+
+typedef struct SDL_Task
+{
+    SDL_TaskFunction func;
+    SDL_ParallelForFunction range_func;
+    void *data;
+    int start;
+    int end;
+    SDL_TaskGroup *group;
+} SDL_Task;
+
+/* A ring buffer of tasks, with a size that is a power of two */
+typedef struct SDL_TaskQueue
+{
+    SDL_mutex *lock;
+    SDL_Task *tasks;
+    int head;
+    volatile int count;
+    int size;
+} SDL_TaskQueue;
+
+typedef struct SDL_PoolWorker
+{
+    SDL_ThreadPool *pool;
+    SDL_Thread *thread;
+    volatile Uint32 threadid;
+    SDL_TaskQueue queue;
+} SDL_PoolWorker;
+
+struct SDL_ThreadPool
+{
+    int num_threads;
+    volatile SDL_bool quit;
+    SDL_sem *queued;
+    SDL_TaskQueue shared;
+    SDL_PoolWorker *workers;
+
+    /* Groups are reused, so SDL_ParallelFor() doesn't create a mutex and
+       a condition variable every time */
+    SDL_mutex *lock;
+    SDL_TaskGroup *free_groups;
+};
+
+struct SDL_TaskGroup
+{
+    SDL_ThreadPool *pool;
+    SDL_mutex *lock;
+    SDL_cond *done;
+    int pending;
+    SDL_TaskGroup *next;
+};
+
+static SDL_ThreadPool *SDL_shared_pool = NULL;
+
+static int
+SDL_InitTaskQueue(SDL_TaskQueue * queue)
+{
+    queue->lock = SDL_CreateMutex();
+    queue->tasks =
+        (SDL_Task *) SDL_malloc(SDL_POOL_INITIAL_QUEUE * sizeof(SDL_Task));
+    if (!queue->lock || !queue->tasks) {
+        if (queue->lock) {
+            SDL_DestroyMutex(queue->lock);
+            queue->lock = NULL;
+        } else {
+            SDL_free(queue->tasks);
+        }
+        queue->tasks = NULL;
+        SDL_OutOfMemory();
+        return -1;
+    }
+    queue->head = 0;
+    queue->count = 0;
+    queue->size = SDL_POOL_INITIAL_QUEUE;
+    return 0;
+}
+
+static void
+SDL_FreeTaskQueue(SDL_TaskQueue * queue)
+{
+    if (queue->lock) {
+        SDL_DestroyMutex(queue->lock);
+        queue->lock = NULL;
+    }
+    if (queue->tasks) {
+        SDL_free(queue->tasks);
+        queue->tasks = NULL;
+    }
+}
+
+static int
+SDL_PushTask(SDL_TaskQueue * queue, const SDL_Task * task)
+{
+    SDL_mutexP(queue->lock);
+    if (queue->count == queue->size) {
+        SDL_Task *tasks;
+        int i;
+
+        tasks = (SDL_Task *) SDL_malloc(2 * queue->size * sizeof(SDL_Task));
+        if (!tasks) {
+            SDL_mutexV(queue->lock);
+            SDL_OutOfMemory();
+            return -1;
+        }
+        for (i = 0; i < queue->count; ++i) {
+            tasks[i] = queue->tasks[(queue->head + i) & (queue->size - 1)];
+        }
+        SDL_free(queue->tasks);
+        queue->tasks = tasks;
+        queue->head = 0;
+        queue->size *= 2;
+    }
+    queue->tasks[(queue->head + queue->count) & (queue->size - 1)] = *task;
+    ++queue->count;
+    SDL_mutexV(queue->lock);
+    return 0;
+}
+
+/* Take the newest task if 'newest' is set, otherwise the oldest one */
+static SDL_bool
+SDL_PopTask(SDL_TaskQueue * queue, SDL_bool newest, SDL_Task * task)
+{
+    SDL_bool found = SDL_FALSE;
+
+    /* Don't bother locking queues that look empty */
+    if (!queue->count) {
+        return SDL_FALSE;
+    }
+    SDL_mutexP(queue->lock);
+    if (queue->count) {
+        if (newest) {
+            *task = queue->tasks[(queue->head + queue->count - 1) &
+                                 (queue->size - 1)];
+        } else {
+            *task = queue->tasks[queue->head];
+            queue->head = (queue->head + 1) & (queue->size - 1);
+        }
+        --queue->count;
+        found = SDL_TRUE;
+    }
+    SDL_mutexV(queue->lock);
+    return found;
+}
+
+static SDL_PoolWorker *
+SDL_GetPoolWorker(SDL_ThreadPool * pool)
+{
+    Uint32 threadid = SDL_ThreadID();
+    int i;
+
+    for (i = 0; i < pool->num_threads; ++i) {
+        if (pool->workers[i].threadid == threadid) {
+            return &pool->workers[i];
+        }
+    }
+    return NULL;
+}
+
+/* Find a task, after claiming one from the 'queued' semaphore */
+static void
+SDL_TakeTask(SDL_ThreadPool * pool, SDL_PoolWorker * self, SDL_Task * task)
+{
+    int first, i;
+
+    first = self ? (int) (self - pool->workers) : 0;
+    for (;;) {
+        if (self && SDL_PopTask(&self->queue, SDL_TRUE, task)) {
+            return;
+        }
+        if (SDL_PopTask(&pool->shared, SDL_FALSE, task)) {
+            return;
+        }
+        for (i = 0; i < pool->num_threads; ++i) {
+            SDL_PoolWorker *victim =
+                &pool->workers[(first + i) % pool->num_threads];
+
+            if (victim != self && SDL_PopTask(&victim->queue, SDL_FALSE, task)) {
+                return;
+            }
+        }
+        /* Another thread took the task we claimed, and the one it claimed
+           went into a queue we had already looked at, so look again. */
+    }
+}
+
+static void
+SDL_RunTask(SDL_Task * task)
+{
+    SDL_TaskGroup *group = task->group;
+
+    if (task->range_func) {
+        task->range_func(task->data, task->start, task->end);
+    } else {
+        task->func(task->data);
+    }
+
+    SDL_mutexP(group->lock);
+    if (--group->pending == 0) {
+        SDL_CondBroadcast(group->done);
+    }
+    SDL_mutexV(group->lock);
+}
+
+#if !SDL_THREADS_DISABLED
+static int SDLCALL
+SDL_PoolWorkerThread(void *data)
+{
+    SDL_PoolWorker *worker = (SDL_PoolWorker *) data;
+    SDL_ThreadPool *pool = worker->pool;
+    SDL_Task task;
+
+    worker->threadid = SDL_ThreadID();
+    for (;;) {
+        SDL_SemWait(pool->queued);
+        if (pool->quit) {
+            break;
+        }
+        SDL_TakeTask(pool, worker, &task);
+        SDL_RunTask(&task);
+    }
+    return 0;
+}
+#endif
+
+static SDL_ThreadPool *
+SDL_CreatePool(int num_threads)
+{
+    SDL_ThreadPool *pool;
+
+    pool = (SDL_ThreadPool *) SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+#if !SDL_THREADS_DISABLED
+    if (num_threads > SDL_POOL_MAX_THREADS) {
+        num_threads = SDL_POOL_MAX_THREADS;
+    }
+    if (num_threads <= 0) {
+        return pool;
+    }
+
+    pool->lock = SDL_CreateMutex();
+    pool->queued = SDL_CreateSemaphore(0);
+    pool->workers =
+        (SDL_PoolWorker *) SDL_calloc(num_threads, sizeof(SDL_PoolWorker));
+    if (!pool->lock || !pool->queued || !pool->workers ||
+        SDL_InitTaskQueue(&pool->shared) < 0) {
+        SDL_DestroyThreadPool(pool);
+        return NULL;
+    }
+
+    /* Keep whatever threads could be started */
+    while (pool->num_threads < num_threads) {
+        SDL_PoolWorker *worker = &pool->workers[pool->num_threads];
+
+        worker->pool = pool;
+        if (SDL_InitTaskQueue(&worker->queue) < 0) {
+            break;
+        }
+        worker->thread = SDL_CreateThread(SDL_PoolWorkerThread, worker);
+        if (!worker->thread) {
+            SDL_FreeTaskQueue(&worker->queue);
+            break;
+        }
+        ++pool->num_threads;
+    }
+#endif
+    return pool;
+}
+
+SDL_ThreadPool *
+SDL_CreateThreadPool(int num_threads)
+{
+    if (num_threads <= 0) {
+        num_threads = SDL_GetCPUCount() - 1;
+    }
+    return SDL_CreatePool(num_threads);
+}
+
+SDL_ThreadPool *
+SDL_GetSharedThreadPool(void)
+{
+    /* WARNING:
+       If this is first called from several threads at once, more than one
+       pool may be created.  SDL calls it from SDL_VideoInit() if it's
+       going to blit on several threads, before it starts any of its own.
+     */
+    if (!SDL_shared_pool) {
+        const char *env = SDL_getenv("SDL_THREAD_POOL_SIZE");
+        int num_threads;
+
+        if (env) {
+            num_threads = SDL_atoi(env) - 1;
+        } else {
+            num_threads = SDL_GetCPUCount() - 1;
+        }
+        SDL_shared_pool = SDL_CreatePool(num_threads);
+    }
+    return SDL_shared_pool;
+}
+
+int
+SDL_GetThreadPoolSize(SDL_ThreadPool * pool)
+{
+    if (!pool) {
+        pool = SDL_GetSharedThreadPool();
+        if (!pool) {
+            return 0;
+        }
+    }
+    return pool->num_threads;
+}
+
+void
+SDL_DestroyThreadPool(SDL_ThreadPool * pool)
+{
+    SDL_TaskGroup *group;
+    SDL_Task task;
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    /* Run anything that's left here, so that every count taken from the
+       semaphore after this is one of the posts that stop the workers. */
+    if (pool->num_threads > 0) {
+        while (SDL_SemTryWait(pool->queued) == 0) {
+            SDL_TakeTask(pool, NULL, &task);
+            SDL_RunTask(&task);
+        }
+    }
+
+    pool->quit = SDL_TRUE;
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_SemPost(pool->queued);
+    }
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->workers[i].thread, NULL);
+        SDL_FreeTaskQueue(&pool->workers[i].queue);
+    }
+
+    while (pool->free_groups) {
+        group = pool->free_groups;
+        pool->free_groups = group->next;
+        SDL_DestroyCond(group->done);
+        SDL_DestroyMutex(group->lock);
+        SDL_free(group);
+    }
+
+    SDL_FreeTaskQueue(&pool->shared);
+    if (pool->workers) {
+        SDL_free(pool->workers);
+    }
+    if (pool->queued) {
+        SDL_DestroySemaphore(pool->queued);
+    }
+    if (pool->lock) {
+        SDL_DestroyMutex(pool->lock);
+    }
+    if (pool == SDL_shared_pool) {
+        SDL_shared_pool = NULL;
+    }
+    SDL_free(pool);
+}
+
+/* Called by SDL_Quit() */
+void
+SDL_ThreadPoolQuit(void)
+{
+    SDL_DestroyThreadPool(SDL_shared_pool);
+}
+
+SDL_TaskGroup *
+SDL_CreateTaskGroup(SDL_ThreadPool * pool)
+{
+    SDL_TaskGroup *group = NULL;
+
+    if (!pool) {
+        pool = SDL_GetSharedThreadPool();
+        if (!pool) {
+            return NULL;
+        }
+    }
+
+    if (pool->lock) {
+        SDL_mutexP(pool->lock);
+        group = pool->free_groups;
+        if (group) {
+            pool->free_groups = group->next;
+        }
+        SDL_mutexV(pool->lock);
+    }
+    if (!group) {
+        group = (SDL_TaskGroup *) SDL_calloc(1, sizeof(*group));
+        if (!group) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        /* Without worker threads, tasks run as they are submitted */
+        if (pool->num_threads > 0) {
+            group->lock = SDL_CreateMutex();
+            group->done = SDL_CreateCond();
+            if (!group->lock || !group->done) {
+                if (group->lock) {
+                    SDL_DestroyMutex(group->lock);
+                }
+                if (group->done) {
+                    SDL_DestroyCond(group->done);
+                }
+                SDL_free(group);
+                return NULL;
+            }
+        }
+    }
+    group->pool = pool;
+    group->pending = 0;
+    group->next = NULL;
+    return group;
+}
+
+static int
+SDL_QueueTask(SDL_TaskGroup * group, SDL_Task * task)
+{
+    SDL_ThreadPool *pool = group->pool;
+    SDL_PoolWorker *self;
+
+    task->group = group;
+    if (pool->num_threads == 0) {
+        if (task->range_func) {
+            task->range_func(task->data, task->start, task->end);
+        } else {
+            task->func(task->data);
+        }
+        return 0;
+    }
+
+    SDL_mutexP(group->lock);
+    ++group->pending;
+    SDL_mutexV(group->lock);
+
+    self = SDL_GetPoolWorker(pool);
+    if (SDL_PushTask(self ? &self->queue : &pool->shared, task) < 0) {
+        SDL_mutexP(group->lock);
+        if (--group->pending == 0) {
+            SDL_CondBroadcast(group->done);
+        }
+        SDL_mutexV(group->lock);
+        return -1;
+    }
+    SDL_SemPost(pool->queued);
+    return 0;
+}
+
+int
+SDL_SubmitTask(SDL_TaskGroup * group, SDL_TaskFunction func, void *data)
+{
+    SDL_Task task;
+
+    if (!group || !func) {
+        SDL_SetError("Passed a NULL task group or function");
+        return -1;
+    }
+    task.func = func;
+    task.range_func = NULL;
+    task.data = data;
+    task.start = task.end = 0;
+    return SDL_QueueTask(group, &task);
+}
+
+void
+SDL_WaitTaskGroup(SDL_TaskGroup * group)
+{
+    SDL_ThreadPool *pool;
+    SDL_Task task;
+
+    if (!group || !group->lock) {
+        return;
+    }
+    pool = group->pool;
+
+    SDL_mutexP(group->lock);
+    while (group->pending > 0) {
+        /* Help with whatever is queued, which may not be ours, rather than
+           sleeping while there's work to do */
+        if (SDL_SemTryWait(pool->queued) == 0) {
+            SDL_mutexV(group->lock);
+            SDL_TakeTask(pool, SDL_GetPoolWorker(pool), &task);
+            SDL_RunTask(&task);
+            SDL_mutexP(group->lock);
+        } else {
+            SDL_CondWait(group->done, group->lock);
+        }
+    }
+    SDL_mutexV(group->lock);
+}
+
+void
+SDL_DestroyTaskGroup(SDL_TaskGroup * group)
+{
+    SDL_ThreadPool *pool;
+
+    if (!group) {
+        return;
+    }
+    SDL_WaitTaskGroup(group);
+
+    pool = group->pool;
+    if (pool->lock) {
+        SDL_mutexP(pool->lock);
+        group->next = pool->free_groups;
+        pool->free_groups = group;
+        SDL_mutexV(pool->lock);
+    } else {
+        SDL_free(group);
+    }
+}
+
+int
+SDL_ParallelFor(SDL_ThreadPool * pool, int start, int end, int grain,
+                SDL_ParallelForFunction func, void *data)
+{
+    SDL_TaskGroup *group = NULL;
+    SDL_Task task;
+    Sint64 count;
+    int pieces, i, retval = 0;
+
+    if (!func) {
+        SDL_SetError("Passed a NULL function");
+        return -1;
+    }
+    if (end <= start) {
+        return 0;
+    }
+    if (grain < 1) {
+        grain = 1;
+    }
+    if (!pool) {
+        pool = SDL_GetSharedThreadPool();
+    }
+
+    count = (Sint64) end - start;
+    pieces = (int) ((count + grain - 1) / grain);
+    if (pool && pieces > (pool->num_threads + 1) * SDL_POOL_PIECES_PER_THREAD) {
+        pieces = (pool->num_threads + 1) * SDL_POOL_PIECES_PER_THREAD;
+    }
+    if (pool && pool->num_threads > 0 && pieces > 1) {
+        group = SDL_CreateTaskGroup(pool);
+    }
+    if (!group) {
+        func(data, start, end);
+        return 0;
+    }
+
+    /* Queue all but the first piece, which this thread runs right away */
+    task.func = NULL;
+    task.range_func = func;
+    task.data = data;
+    for (i = 1; i < pieces; ++i) {
+        task.start = start + (int) ((count * i) / pieces);
+        task.end = start + (int) ((count * (i + 1)) / pieces);
+        if (SDL_QueueTask(group, &task) < 0) {
+            func(data, task.start, task.end);
+            retval = -1;
+        }
+    }
+    func(data, start, start + (int) (count / pieces));
+
+    SDL_DestroyTaskGroup(group);
+    return retval;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -38,18 +38,43 @@ SDL_TimerCallback SDL_alarm_callback;
 /* Data used for a thread-based timer */
 static int SDL_timer_threaded = 0;
 
+/* Pending timers are kept in a binary min-heap ordered by deadline, and
+   each timer remembers its position in the heap, so adding and removing
+   one is O(log n) and finding the next one due is O(1).  The timers
+   themselves come from chunks that are only freed by SDL_TimerQuit(), so
+   removing a timer that has already finished is still safe.
+ */
+#define TIMER_CHUNK	64
+
 struct _SDL_TimerID
 {
     Uint32 interval;
     SDL_NewTimerCallback cb;
     void *param;
-    Uint32 last_alarm;
-    struct _SDL_TimerID *next;
+    Uint32 deadline;
+    int index;                  /* Position in the heap, or -1 */
+    struct _SDL_TimerID *next;  /* Next free timer */
 };
 
-static SDL_TimerID SDL_timers = NULL;
+typedef struct SDL_TimerChunk
+{
+    struct SDL_TimerChunk *next;
+    struct _SDL_TimerID timers[TIMER_CHUNK];
+} SDL_TimerChunk;
+
+static SDL_TimerID *SDL_timer_heap = NULL;
+static int SDL_timer_count = 0;
+static int SDL_timer_size = 0;
+static SDL_TimerID SDL_timer_free = NULL;
+static SDL_TimerChunk *SDL_timer_chunks = NULL;
+
+/* The timer whose callback is running, and whether it was removed */
+static SDL_TimerID SDL_timer_current = NULL;
+static SDL_bool SDL_timer_current_removed = SDL_FALSE;
+
 static SDL_mutex *SDL_timer_mutex;
-static volatile SDL_bool list_changed = SDL_FALSE;
+static SDL_cond *SDL_timer_cond;
+static SDL_bool SDL_timer_wakeup = SDL_FALSE;
 
 /* Set whether or not the timer should use a thread.
    This should not be called while the timer subsystem is running.
@@ -83,6 +108,7 @@ SDL_TimerInit(void)
     }
     if (SDL_timer_threaded) {
         SDL_timer_mutex = SDL_CreateMutex();
+        SDL_timer_cond = SDL_CreateCond();
     }
     if (retval == 0) {
         SDL_timer_started = 1;
@@ -98,89 +124,240 @@ SDL_TimerQuit(void)
         SDL_SYS_TimerQuit();
     }
     if (SDL_timer_threaded) {
+        SDL_DestroyCond(SDL_timer_cond);
+        SDL_timer_cond = NULL;
         SDL_DestroyMutex(SDL_timer_mutex);
         SDL_timer_mutex = NULL;
     }
+    while (SDL_timer_chunks) {
+        SDL_TimerChunk *chunk = SDL_timer_chunks;
+        SDL_timer_chunks = chunk->next;
+        SDL_free(chunk);
+    }
+    SDL_timer_free = NULL;
+    if (SDL_timer_heap) {
+        SDL_free(SDL_timer_heap);
+        SDL_timer_heap = NULL;
+    }
+    SDL_timer_size = 0;
     SDL_timer_started = 0;
     SDL_timer_threaded = 0;
 }
 
+/* Heap maintenance -- called with the timer mutex held */
+#define TIMER_BEFORE(A, B)	((Sint32) ((A)->deadline - (B)->deadline) < 0)
+
+static void
+SDL_TimerHeapSet(int index, SDL_TimerID t)
+{
+    SDL_timer_heap[index] = t;
+    t->index = index;
+}
+
+static void
+SDL_TimerHeapUp(int index)
+{
+    SDL_TimerID t = SDL_timer_heap[index];
+
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!TIMER_BEFORE(t, SDL_timer_heap[parent])) {
+            break;
+        }
+        SDL_TimerHeapSet(index, SDL_timer_heap[parent]);
+        index = parent;
+    }
+    SDL_TimerHeapSet(index, t);
+}
+
+static void
+SDL_TimerHeapDown(int index)
+{
+    SDL_TimerID t = SDL_timer_heap[index];
+
+    for (;;) {
+        int child = index * 2 + 1;
+        if (child >= SDL_timer_count) {
+            break;
+        }
+        if (child + 1 < SDL_timer_count &&
+            TIMER_BEFORE(SDL_timer_heap[child + 1], SDL_timer_heap[child])) {
+            ++child;
+        }
+        if (!TIMER_BEFORE(SDL_timer_heap[child], t)) {
+            break;
+        }
+        SDL_TimerHeapSet(index, SDL_timer_heap[child]);
+        index = child;
+    }
+    SDL_TimerHeapSet(index, t);
+}
+
+static int
+SDL_TimerHeapInsert(SDL_TimerID t)
+{
+    if (SDL_timer_count == SDL_timer_size) {
+        int size = SDL_timer_size ? SDL_timer_size * 2 : TIMER_CHUNK;
+        SDL_TimerID *heap = (SDL_TimerID *) SDL_realloc(SDL_timer_heap,
+                                                        size *
+                                                        sizeof(*heap));
+        if (!heap) {
+            SDL_OutOfMemory();
+            return -1;
+        }
+        SDL_timer_heap = heap;
+        SDL_timer_size = size;
+    }
+    SDL_timer_heap[SDL_timer_count] = t;
+    SDL_TimerHeapUp(SDL_timer_count++);
+    return 0;
+}
+
+static void
+SDL_TimerHeapRemove(SDL_TimerID t)
+{
+    const int index = t->index;
+    SDL_TimerID last = SDL_timer_heap[--SDL_timer_count];
+
+    t->index = -1;
+    if (last != t) {
+        SDL_TimerHeapSet(index, last);
+        if (index > 0 && TIMER_BEFORE(last, SDL_timer_heap[(index - 1) / 2])) {
+            SDL_TimerHeapUp(index);
+        } else {
+            SDL_TimerHeapDown(index);
+        }
+    }
+}
+
+static void
+SDL_FreeTimer(SDL_TimerID t)
+{
+    t->cb = NULL;
+    t->next = SDL_timer_free;
+    SDL_timer_free = t;
+    --SDL_timer_running;
+}
+
 void
 SDL_ThreadedTimerCheck(void)
 {
     Uint32 now, ms;
-    SDL_TimerID t, prev, next;
-    SDL_bool removed;
+    SDL_TimerID t;
 
     SDL_mutexP(SDL_timer_mutex);
-    list_changed = SDL_FALSE;
     now = SDL_GetTicks();
-    for (prev = NULL, t = SDL_timers; t; t = next) {
-        removed = SDL_FALSE;
-        ms = t->interval - SDL_TIMESLICE;
-        next = t->next;
-        if ((int) (now - t->last_alarm) > (int) ms) {
-            struct _SDL_TimerID timer;
-
-            if ((now - t->last_alarm) < t->interval) {
-                t->last_alarm += t->interval;
-            } else {
-                t->last_alarm = now;
-            }
+    while (SDL_timer_count > 0 &&
+           (Sint32) (now - SDL_timer_heap[0]->deadline) >= 0) {
+        t = SDL_timer_heap[0];
+        SDL_TimerHeapRemove(t);
 #ifdef DEBUG_TIMERS
-            printf("Executing timer %p (thread = %d)\n", t, SDL_ThreadID());
+        printf("Executing timer %p (thread = %d)\n", t, SDL_ThreadID());
 #endif
-            timer = *t;
-            SDL_mutexV(SDL_timer_mutex);
-            ms = timer.cb(timer.interval, timer.param);
-            SDL_mutexP(SDL_timer_mutex);
-            if (list_changed) {
-                /* Abort, list of timers modified */
-                /* FIXME: what if ms was changed? */
-                break;
-            }
-            if (ms != t->interval) {
-                if (ms) {
-                    t->interval = ROUND_RESOLUTION(ms);
-                } else {
-                    /* Remove timer from the list */
+        SDL_timer_current = t;
+        SDL_timer_current_removed = SDL_FALSE;
+        SDL_mutexV(SDL_timer_mutex);
+        ms = t->cb(t->interval, t->param);
+        SDL_mutexP(SDL_timer_mutex);
+        SDL_timer_current = NULL;
+
+        if (SDL_timer_current_removed || !ms) {
+            /* Removed while running, or the callback cancelled it */
 #ifdef DEBUG_TIMERS
-                    printf("SDL: Removing timer %p\n", t);
+            printf("SDL: Removing timer %p\n", t);
 #endif
-                    if (prev) {
-                        prev->next = next;
-                    } else {
-                        SDL_timers = next;
-                    }
-                    SDL_free(t);
-                    --SDL_timer_running;
-                    removed = SDL_TRUE;
-                }
-            }
+            SDL_FreeTimer(t);
+            continue;
+        }
+
+        /* Keep to the original schedule, catching up if we're a little
+           behind, unless we've fallen more than a whole interval and a
+           timeslice behind it */
+        t->interval = ms;
+        t->deadline += ms;
+        if ((Sint32) (now - t->deadline) >= (Sint32) SDL_max(ms, SDL_TIMESLICE)) {
+            t->deadline = now + ms;
         }
-        /* Don't update prev if the timer has disappeared */
-        if (!removed) {
-            prev = t;
+        if (SDL_TimerHeapInsert(t) < 0) {
+            SDL_FreeTimer(t);
         }
     }
     SDL_mutexV(SDL_timer_mutex);
 }
 
+void
+SDL_ThreadedTimerWait(void)
+{
+    if (!SDL_timer_cond) {
+        SDL_Delay(1);
+        return;
+    }
+    SDL_mutexP(SDL_timer_mutex);
+    if (!SDL_timer_wakeup) {
+        if (SDL_timer_count == 0) {
+            SDL_CondWait(SDL_timer_cond, SDL_timer_mutex);
+        } else {
+            Sint32 left = (Sint32) (SDL_timer_heap[0]->deadline -
+                                    SDL_GetTicks());
+            if (left > 0) {
+                SDL_CondWaitTimeout(SDL_timer_cond, SDL_timer_mutex, left);
+            }
+        }
+    }
+    SDL_timer_wakeup = SDL_FALSE;
+    SDL_mutexV(SDL_timer_mutex);
+}
+
+void
+SDL_ThreadedTimerWake(void)
+{
+    if (SDL_timer_cond) {
+        SDL_mutexP(SDL_timer_mutex);
+        SDL_timer_wakeup = SDL_TRUE;
+        SDL_CondSignal(SDL_timer_cond);
+        SDL_mutexV(SDL_timer_mutex);
+    }
+}
+
 static SDL_TimerID
 SDL_AddTimerInternal(Uint32 interval, SDL_NewTimerCallback callback,
                      void *param)
 {
     SDL_TimerID t;
-    t = (SDL_TimerID) SDL_malloc(sizeof(struct _SDL_TimerID));
-    if (t) {
-        t->interval = ROUND_RESOLUTION(interval);
-        t->cb = callback;
-        t->param = param;
-        t->last_alarm = SDL_GetTicks();
-        t->next = SDL_timers;
-        SDL_timers = t;
-        ++SDL_timer_running;
-        list_changed = SDL_TRUE;
+
+    if (!SDL_timer_free) {
+        SDL_TimerChunk *chunk;
+        int i;
+
+        chunk = (SDL_TimerChunk *) SDL_malloc(sizeof(*chunk));
+        if (!chunk) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        for (i = 0; i < TIMER_CHUNK; ++i) {
+            chunk->timers[i].index = -1;
+            chunk->timers[i].cb = NULL;
+            chunk->timers[i].next = SDL_timer_free;
+            SDL_timer_free = &chunk->timers[i];
+        }
+        chunk->next = SDL_timer_chunks;
+        SDL_timer_chunks = chunk;
+    }
+    t = SDL_timer_free;
+    t->interval = interval;
+    t->cb = callback;
+    t->param = param;
+    t->deadline = SDL_GetTicks() + interval;
+    if (SDL_TimerHeapInsert(t) < 0) {
+        return NULL;
+    }
+    SDL_timer_free = t->next;
+    ++SDL_timer_running;
+
+    /* Wake the timer thread if this is now the first timer due */
+    if (t->index == 0 && SDL_timer_cond) {
+        SDL_timer_wakeup = SDL_TRUE;
+        SDL_CondSignal(SDL_timer_cond);
     }
 #ifdef DEBUG_TIMERS
     printf("SDL_AddTimer(%d) = %08x num_timers = %d\n", interval, (Uint32) t,
@@ -214,25 +391,24 @@ SDL_AddTimer(Uint32 interval, SDL_NewTimerCallback callback, void *param)
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
-    SDL_TimerID t, prev = NULL;
     SDL_bool removed;
 
     removed = SDL_FALSE;
+    if (!id || !SDL_timer_mutex) {
+        return removed;
+    }
     SDL_mutexP(SDL_timer_mutex);
-    /* Look for id in the linked list of timers */
-    for (t = SDL_timers; t; prev = t, t = t->next) {
-        if (t == id) {
-            if (prev) {
-                prev->next = t->next;
-            } else {
-                SDL_timers = t->next;
-            }
-            SDL_free(t);
-            --SDL_timer_running;
+    if (id == SDL_timer_current) {
+        /* Its callback is running, free it when it returns */
+        if (!SDL_timer_current_removed) {
+            SDL_timer_current_removed = SDL_TRUE;
             removed = SDL_TRUE;
-            list_changed = SDL_TRUE;
-            break;
         }
+    } else if (id->index >= 0 && id->index < SDL_timer_count &&
+               SDL_timer_heap[id->index] == id) {
+        SDL_TimerHeapRemove(id);
+        SDL_FreeTimer(id);
+        removed = SDL_TRUE;
     }
 #ifdef DEBUG_TIMERS
     printf("SDL_RemoveTimer(%08x) = %d num_timers = %d thread = %d\n",
@@ -265,13 +441,14 @@ SDL_SetTimer(Uint32 ms, SDL_TimerCallback callback)
     }
     if (SDL_timer_running) {    /* Stop any currently running timer */
         if (SDL_timer_threaded) {
-            while (SDL_timers) {
-                SDL_TimerID freeme = SDL_timers;
-                SDL_timers = SDL_timers->next;
-                SDL_free(freeme);
+            while (SDL_timer_count > 0) {
+                SDL_TimerID freeme = SDL_timer_heap[SDL_timer_count - 1];
+                SDL_TimerHeapRemove(freeme);
+                SDL_FreeTimer(freeme);
+            }
+            if (SDL_timer_current) {
+                SDL_timer_current_removed = SDL_TRUE;
             }
-            SDL_timer_running = 0;
-            list_changed = SDL_TRUE;
         } else {
             SDL_SYS_StopTimer();
             SDL_timer_running = 0;
@@ -297,4 +474,65 @@ SDL_SetTimer(Uint32 ms, SDL_TimerCallback callback)
     return retval;
 }
 
+/* SDL_DelayPrecise() sleeps until this many nanoseconds are left and then
+   spins.  The margin follows how late SDL_Delay() has been waking up.
+ */
+#define DELAY_SPIN_MIN	200000
+#define DELAY_SPIN_MAX	4000000
+#define NS_PER_SECOND	1000000000
+
+static Uint32 SDL_delay_spin = 1000000;
+
+static Uint64
+SDL_CounterToNS(Uint64 counter, Uint64 frequency)
+{
+    return ((counter / frequency) * NS_PER_SECOND +
+            (counter % frequency) * NS_PER_SECOND / frequency);
+}
+
+void
+SDL_DelayPrecise(Uint64 ns)
+{
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 now, then, end, left, late;
+    Uint32 spin, ms;
+
+    /* If the counter is no finer than SDL_Delay(), that's the best we have */
+    if (frequency <= 1000) {
+        SDL_Delay((Uint32) (ns / 1000000));
+        return;
+    }
+
+    now = SDL_GetPerformanceCounter();
+    end = now + (ns / NS_PER_SECOND) * frequency +
+        (ns % NS_PER_SECOND) * frequency / NS_PER_SECOND;
+    while (now < end) {
+        spin = SDL_delay_spin;
+        left = SDL_CounterToNS(end - now, frequency);
+        if (left <= spin + 1000000) {
+            break;
+        }
+        ms = (Uint32) ((left - spin) / 1000000);
+        SDL_Delay(ms);
+
+        then = now;
+        now = SDL_GetPerformanceCounter();
+        late = SDL_CounterToNS(now - then, frequency);
+        if (late > (Uint64) ms * 1000000) {
+            late -= (Uint64) ms * 1000000;
+        } else {
+            late = 0;
+        }
+        if (late > spin) {
+            spin = (Uint32) SDL_min(late, DELAY_SPIN_MAX);
+        } else {
+            spin -= (spin - (Uint32) late) / 8;
+        }
+        SDL_delay_spin = SDL_max(spin, DELAY_SPIN_MIN);
+    }
+    while (SDL_GetPerformanceCounter() < end) {
+        /* Spin for the last fraction of a millisecond */ ;
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -44,4 +44,11 @@ extern void SDL_TimerQuit(void);
 
 /* This function is called from the SDL event thread if it is available */
 extern void SDL_ThreadedTimerCheck(void);
+
+/* A timer thread can call this between checks to sleep until the next
+   timer is due, a new timer is due sooner, or SDL_ThreadedTimerWake() is
+   called.
+*/
+extern void SDL_ThreadedTimerWait(void);
+extern void SDL_ThreadedTimerWake(void);
 /* vi: set ts=4 sw=4 expandtab: */
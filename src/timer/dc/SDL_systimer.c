@@ -49,6 +49,19 @@ SDL_GetTicks(void)
     return ((jiffies - start) * 1000 / HZ);
 }
 
+/* There's no finer clock here, so the counter counts milliseconds */
+Uint64
+SDL_GetPerformanceCounter(void)
+{
+    return SDL_GetTicks();
+}
+
+Uint64
+SDL_GetPerformanceFrequency(void)
+{
+    return 1000;
+}
+
 void
 SDL_Delay(Uint32 ms)
 {
@@ -44,6 +44,20 @@ SDL_Delay(Uint32 ms)
     SDL_Unsupported();
 }
 
+Uint64
+SDL_GetPerformanceCounter(void)
+{
+    SDL_Unsupported();
+    return 0;
+}
+
+Uint64
+SDL_GetPerformanceFrequency(void)
+{
+    SDL_Unsupported();
+    return 1;
+}
+
 #include "SDL_thread.h"
 
 /* Data to handle a single periodic alarm */
@@ -94,6 +94,21 @@ SDL_GetTicks(void)
 
 }
 
+DECLSPEC Uint64 SDLCALL
+SDL_GetPerformanceCounter(void)
+{
+    long long hires_now;
+
+    DosTmrQueryTime((PQWORD) & hires_now);
+    return (Uint64) (hires_now - hires_start_ticks);
+}
+
+DECLSPEC Uint64 SDLCALL
+SDL_GetPerformanceFrequency(void)
+{
+    return hires_ticks_per_second;
+}
+
 /* High resolution sleep, originally made by Ilya Zakharevich */
 DECLSPEC void SDLCALL
 SDL_Delay(Uint32 ms)
@@ -50,6 +50,11 @@
 #define USE_ITIMER
 #endif
 
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define USE_RDTSC
+#include "SDL_cpuinfo.h"
+#endif
+
 /* The first ticks value of the application */
 #ifdef HAVE_CLOCK_GETTIME
 static struct timespec start;
@@ -57,16 +62,75 @@ static struct timespec start;
 static struct timeval start;
 #endif /* HAVE_CLOCK_GETTIME */
 
+#ifdef USE_RDTSC
+/* Reading the CPU cycle counter is much cheaper than asking the kernel for
+   the time, but it only measures time if the counter runs at a constant
+   rate whatever the power state, so it has to be asked for.  Its rate is
+   measured against the system clock the first time it's needed.
+ */
+#define RDTSC_CALIBRATE_MS	20
+
+static SDL_bool rdtsc_enabled = SDL_FALSE;
+static Uint64 rdtsc_start;
+static volatile Uint64 rdtsc_frequency = 0;
+
+static __inline__ Uint64
+ReadTSC(void)
+{
+    Uint32 lo, hi;
+    __asm__ __volatile__("rdtsc":"=a"(lo), "=d"(hi));
+    return (((Uint64) hi) << 32) | lo;
+}
+
+static SDL_bool
+HasInvariantTSC(void)
+{
+    int a, b, c, d;
+
+    if (!SDL_HasRDTSC()) {
+        return SDL_FALSE;
+    }
+/* *INDENT-OFF* */
+#ifdef __x86_64__
+#define CPU_cpuid(func, a, b, c, d) \
+        __asm__ ("movq %%rbx,%%rsi; cpuid; xchgq %%rbx,%%rsi" \
+                 : "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func))
+#else
+#define CPU_cpuid(func, a, b, c, d) \
+        __asm__ ("movl %%ebx,%%esi; cpuid; xchgl %%ebx,%%esi" \
+                 : "=a" (a), "=S" (b), "=c" (c), "=d" (d) : "a" (func))
+#endif
+/* *INDENT-ON* */
+    CPU_cpuid(0x80000000, a, b, c, d);
+    if ((Uint32) a < 0x80000007) {
+        return SDL_FALSE;
+    }
+    CPU_cpuid(0x80000007, a, b, c, d);
+#undef CPU_cpuid
+    return (d & 0x00000100) ? SDL_TRUE : SDL_FALSE;
+}
+#endif /* USE_RDTSC */
+
 
 void
 SDL_StartTicks(void)
 {
+#ifdef USE_RDTSC
+    const char *rdtsc = SDL_getenv("SDL_TIMER_RDTSC");
+#endif
+
     /* Set first ticks value */
 #if HAVE_CLOCK_GETTIME
     clock_gettime(CLOCK_MONOTONIC, &start);
 #else
     gettimeofday(&start, NULL);
 #endif
+#ifdef USE_RDTSC
+    if (rdtsc && SDL_atoi(rdtsc) && HasInvariantTSC()) {
+        rdtsc_start = ReadTSC();
+        rdtsc_enabled = SDL_TRUE;
+    }
+#endif
 }
 
 Uint32
@@ -91,6 +155,69 @@ SDL_GetTicks(void)
 #endif
 }
 
+/* The system clock in nanoseconds or microseconds since SDL_StartTicks() */
+static Uint64
+SystemCounter(void)
+{
+#if HAVE_CLOCK_GETTIME
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((Uint64) (now.tv_sec - start.tv_sec) * 1000000000 +
+            now.tv_nsec - start.tv_nsec);
+#else
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return ((Uint64) (now.tv_sec - start.tv_sec) * 1000000 +
+            now.tv_usec - start.tv_usec);
+#endif
+}
+
+static Uint64
+SystemFrequency(void)
+{
+#if HAVE_CLOCK_GETTIME
+    return 1000000000;
+#else
+    return 1000000;
+#endif
+}
+
+Uint64
+SDL_GetPerformanceCounter(void)
+{
+#ifdef USE_RDTSC
+    if (rdtsc_enabled) {
+        return (ReadTSC() - rdtsc_start);
+    }
+#endif
+    return SystemCounter();
+}
+
+Uint64
+SDL_GetPerformanceFrequency(void)
+{
+#ifdef USE_RDTSC
+    if (rdtsc_enabled) {
+        if (!rdtsc_frequency) {
+            Uint64 elapsed = SystemCounter();
+            Uint64 cycles;
+
+            /* Measure over a long enough time for a good estimate */
+            if (elapsed < SystemFrequency() * RDTSC_CALIBRATE_MS / 1000) {
+                SDL_Delay(RDTSC_CALIBRATE_MS -
+                          (Uint32) (elapsed * 1000 / SystemFrequency()));
+            }
+            cycles = ReadTSC() - rdtsc_start;
+            elapsed = SystemCounter();
+            rdtsc_frequency =
+                (Uint64) ((double) cycles * SystemFrequency() / elapsed);
+        }
+        return rdtsc_frequency;
+    }
+#endif
+    return SystemFrequency();
+}
+
 void
 SDL_Delay(Uint32 ms)
 {
@@ -213,7 +340,7 @@ RunTimer(void *unused)
         if (SDL_timer_running) {
             SDL_ThreadedTimerCheck();
         }
-        SDL_Delay(1);
+        SDL_ThreadedTimerWait();
     }
     return (0);
 }
@@ -234,6 +361,7 @@ SDL_SYS_TimerQuit(void)
 {
     timer_alive = 0;
     if (timer) {
+        SDL_ThreadedTimerWake();
         SDL_WaitThread(timer, NULL);
         timer = NULL;
     }
@@ -191,11 +191,52 @@ SDL_BlendPoint_RGBA(SDL_Surface * dst, int x, int y, int blendMode, Uint8 r,
     }
 }
 
+typedef int (*BlendPointFunc) (SDL_Surface * dst, int x, int y,
+                               int blendMode, Uint8 r, Uint8 g, Uint8 b,
+                               Uint8 a);
+
+static BlendPointFunc
+SDL_CalculateBlendPointFunc(SDL_PixelFormat * fmt)
+{
+    switch (fmt->BitsPerPixel) {
+    case 15:
+        switch (fmt->Rmask) {
+        case 0x7C00:
+            return SDL_BlendPoint_RGB555;
+        }
+        break;
+    case 16:
+        switch (fmt->Rmask) {
+        case 0xF800:
+            return SDL_BlendPoint_RGB565;
+        }
+        break;
+    case 32:
+        switch (fmt->Rmask) {
+        case 0x00FF0000:
+            if (!fmt->Amask) {
+                return SDL_BlendPoint_RGB888;
+            } else {
+                return SDL_BlendPoint_ARGB8888;
+            }
+            break;
+        }
+    default:
+        break;
+    }
+
+    if (!fmt->Amask) {
+        return SDL_BlendPoint_RGB;
+    } else {
+        return SDL_BlendPoint_RGBA;
+    }
+}
+
 int
 SDL_BlendPoint(SDL_Surface * dst, int x, int y, int blendMode, Uint8 r,
                Uint8 g, Uint8 b, Uint8 a)
 {
-    SDL_PixelFormat *fmt = dst->format;
+    BlendPointFunc func;
 
     /* This function doesn't work on surfaces < 8 bpp */
     if (dst->format->BitsPerPixel < 8) {
@@ -217,40 +258,55 @@ SDL_BlendPoint(SDL_Surface * dst, int x, int y, int blendMode, Uint8 r,
         b = DRAW_MUL(b, a);
     }
 
-    switch (fmt->BitsPerPixel) {
-    case 15:
-        switch (fmt->Rmask) {
-        case 0x7C00:
-            return SDL_BlendPoint_RGB555(dst, x, y, blendMode, r, g, b, a);
-        }
-        break;
-    case 16:
-        switch (fmt->Rmask) {
-        case 0xF800:
-            return SDL_BlendPoint_RGB565(dst, x, y, blendMode, r, g, b, a);
+    func = SDL_CalculateBlendPointFunc(dst->format);
+    return func(dst, x, y, blendMode, r, g, b, a);
+}
+
+int
+SDL_BlendPoints(SDL_Surface * dst, const SDL_Point * points, int count,
+                int blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    int minx, miny;
+    int maxx, maxy;
+    int i;
+    int x, y;
+    BlendPointFunc func;
+    int status = 0;
+
+    /* This function doesn't work on surfaces < 8 bpp */
+    if (dst->format->BitsPerPixel < 8) {
+        SDL_SetError("SDL_BlendPoints(): Unsupported surface format");
+        return (-1);
+    }
+
+    if ((blendMode == SDL_BLENDMODE_BLEND)
+        || (blendMode == SDL_BLENDMODE_ADD)) {
+        r = DRAW_MUL(r, a);
+        g = DRAW_MUL(g, a);
+        b = DRAW_MUL(b, a);
+    }
+
+    /* Look up the format specific function once for the whole batch */
+    func = SDL_CalculateBlendPointFunc(dst->format);
+
+    minx = dst->clip_rect.x;
+    maxx = dst->clip_rect.x + dst->clip_rect.w - 1;
+    miny = dst->clip_rect.y;
+    maxy = dst->clip_rect.y + dst->clip_rect.h - 1;
+
+    for (i = 0; i < count; ++i) {
+        x = points[i].x;
+        y = points[i].y;
+
+        if (x < minx || x > maxx || y < miny || y > maxy) {
+            continue;
         }
-        break;
-    case 32:
-        switch (fmt->Rmask) {
-        case 0x00FF0000:
-            if (!fmt->Amask) {
-                return SDL_BlendPoint_RGB888(dst, x, y, blendMode, r, g, b,
-                                             a);
-            } else {
-                return SDL_BlendPoint_ARGB8888(dst, x, y, blendMode, r, g, b,
-                                               a);
-            }
+        status = func(dst, x, y, blendMode, r, g, b, a);
+        if (status < 0) {
             break;
         }
-    default:
-        break;
-    }
-
-    if (!fmt->Amask) {
-        return SDL_BlendPoint_RGB(dst, x, y, blendMode, r, g, b, a);
-    } else {
-        return SDL_BlendPoint_RGBA(dst, x, y, blendMode, r, g, b, a);
     }
+    return status;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
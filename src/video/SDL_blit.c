@@ -22,13 +22,17 @@
 #include "SDL_config.h"
 
 #include "SDL_video.h"
+#include "SDL_mutex.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 #include "SDL_blit_copy.h"
+#include "SDL_blit_linear.h"
 #include "SDL_blit_slow.h"
+#include "SDL_blit_threads.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../SDL_profile_c.h"
 
 /* The general purpose software blit routine */
 static int
@@ -65,6 +69,9 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     if (okay && srcrect->w && srcrect->h) {
         SDL_BlitFunc RunBlit;
         SDL_BlitInfo *info = &src->map->info;
+#if SDL_PROFILING
+        const Uint64 start = SDL_GetPerformanceCounter();
+#endif
 
         /* Set up the blit information */
         info->src = (Uint8 *) src->pixels +
@@ -85,8 +92,14 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
         RunBlit = (SDL_BlitFunc) src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, split across threads if it's big */
+        if (src == dst || !SDL_ThreadedBlit(RunBlit, info)) {
+            RunBlit(info);
+        }
+#if SDL_PROFILING
+        SDL_ProfileRecord(src->map->profile, start,
+                          (Uint64) dstrect->w * dstrect->h, 0);
+#endif
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -125,14 +138,12 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+/* Get the CPU features the blit tables are chosen by */
+Uint32
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck;
     static Uint32 features = 0xffffffff;
 
-    /* Get the available CPU features */
     if (features == 0xffffffff) {
         const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
 
@@ -163,6 +174,15 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             }
         }
     }
+    return features;
+}
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -212,32 +232,14 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
     return NULL;
 }
 
-/* Figure out which of many blit routines to set up on a surface */
-int
-SDL_CalculateBlit(SDL_Surface * surface)
+/* Choose the blit function for the surface's current map flags */
+static SDL_BlitFunc
+SDL_ChooseSurfaceBlitUncached(SDL_Surface * surface)
 {
     SDL_BlitFunc blit = NULL;
     SDL_BlitMap *map = surface->map;
     SDL_Surface *dst = map->dst;
 
-    /* Clean everything out to start */
-    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
-    }
-    map->blit = SDL_SoftBlit;
-    map->info.src_fmt = surface->format;
-    map->info.src_pitch = surface->pitch;
-    map->info.dst_fmt = dst->format;
-    map->info.dst_pitch = dst->pitch;
-
-    /* See if we can do RLE acceleration */
-    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
-        if (SDL_RLESurface(surface) == 0) {
-            return 0;
-        }
-    }
-
-    /* Choose a standard blit function */
     if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
         /* Handle overlapping blits on the same surface */
         if (surface == dst) {
@@ -272,6 +274,177 @@ SDL_CalculateBlit(SDL_Surface * surface)
             SDL_ChooseBlitFunc(src_format, dst_format, map->info.flags,
                                SDL_GeneratedBlitFuncTable);
     }
+    return blit;
+}
+
+/* The blit chosen for a surface only depends on the two pixel formats,
+   the copy flags and the CPU, so remember the last few choices.  Maps are
+   invalidated whenever a blend mode or modulation changes, and scanning
+   the blit tables again each time adds up for sprites that change their
+   alpha on every draw.
+
+   The cache is a direct mapped table: a new choice replaces whatever was
+   in its slot.  It's locked once SDL_InitBlitCache() has run; before
+   that, blits are assumed to come from one thread.
+ */
+#define SDL_BLIT_CACHE_SIZE 256
+
+typedef struct
+{
+    Uint32 src_masks[4];
+    Uint32 dst_masks[4];
+    Uint32 features;
+    int flags;
+    Uint8 src_bits, src_bytes;
+    Uint8 dst_bits, dst_bytes;
+    Uint8 identity;
+    Uint8 has_table;            /* N->8 blits use a dither map if there is one */
+    Uint8 overlap;              /* Blitting a surface onto itself */
+    Uint8 unused;               /* Keeps the key free of padding */
+} SDL_BlitCacheKey;
+
+typedef struct
+{
+    SDL_bool used;
+    SDL_BlitCacheKey key;
+    SDL_BlitFunc func;
+} SDL_BlitCacheEntry;
+
+static SDL_BlitCacheEntry SDL_blit_cache[SDL_BLIT_CACHE_SIZE];
+static SDL_mutex *SDL_blit_cache_lock = NULL;
+
+int
+SDL_InitBlitCache(void)
+{
+    if (!SDL_blit_cache_lock) {
+        SDL_blit_cache_lock = SDL_CreateMutex();
+        if (!SDL_blit_cache_lock) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void
+SDL_QuitBlitCache(void)
+{
+    if (SDL_blit_cache_lock) {
+        SDL_DestroyMutex(SDL_blit_cache_lock);
+        SDL_blit_cache_lock = NULL;
+    }
+}
+
+static Uint32
+SDL_HashBlitCacheKey(const SDL_BlitCacheKey * key)
+{
+    const Uint32 *data = (const Uint32 *) key;
+    Uint32 hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < sizeof(*key) / sizeof(*data); ++i) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return (hash ^ (hash >> 16));
+}
+
+static SDL_BlitFunc
+SDL_ChooseSurfaceBlit(SDL_Surface * surface)
+{
+    SDL_BlitMap *map = surface->map;
+    SDL_PixelFormat *src_fmt = surface->format;
+    SDL_PixelFormat *dst_fmt = map->dst->format;
+    SDL_BlitCacheKey key;
+    SDL_BlitCacheEntry *entry;
+    SDL_BlitFunc blit;
+
+    /* The lock only exists while video is initialized, and without it
+       threads blitting surfaces could race on the entries */
+    if (!SDL_blit_cache_lock) {
+        return SDL_ChooseSurfaceBlitUncached(surface);
+    }
+
+    /* Zero everything, padding included, so the keys can be compared */
+    SDL_zero(key);
+    key.src_masks[0] = src_fmt->Rmask;
+    key.src_masks[1] = src_fmt->Gmask;
+    key.src_masks[2] = src_fmt->Bmask;
+    key.src_masks[3] = src_fmt->Amask;
+    key.dst_masks[0] = dst_fmt->Rmask;
+    key.dst_masks[1] = dst_fmt->Gmask;
+    key.dst_masks[2] = dst_fmt->Bmask;
+    key.dst_masks[3] = dst_fmt->Amask;
+    key.features = SDL_GetBlitCPUFeatures();
+    key.flags = map->info.flags & ~SDL_COPY_RLE_MASK;
+    key.src_bits = src_fmt->BitsPerPixel;
+    key.src_bytes = src_fmt->BytesPerPixel;
+    key.dst_bits = dst_fmt->BitsPerPixel;
+    key.dst_bytes = dst_fmt->BytesPerPixel;
+    key.identity = (map->identity != 0);
+    key.has_table = (map->info.table != NULL);
+    key.overlap = (surface == map->dst);
+
+    entry = &SDL_blit_cache[SDL_HashBlitCacheKey(&key) % SDL_BLIT_CACHE_SIZE];
+    SDL_mutexP(SDL_blit_cache_lock);
+    if (entry->used && SDL_memcmp(&entry->key, &key, sizeof(key)) == 0) {
+        blit = entry->func;
+    } else {
+        blit = SDL_ChooseSurfaceBlitUncached(surface);
+        entry->used = SDL_TRUE;
+        SDL_memcpy(&entry->key, &key, sizeof(key));
+        entry->func = blit;
+    }
+    SDL_mutexV(SDL_blit_cache_lock);
+    return blit;
+}
+
+/* Figure out which of many blit routines to set up on a surface */
+int
+SDL_CalculateBlit(SDL_Surface * surface)
+{
+    SDL_BlitFunc blit = NULL;
+    SDL_BlitMap *map = surface->map;
+    SDL_Surface *dst = map->dst;
+
+    /* Clean everything out to start */
+    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
+        SDL_UnRLESurface(surface, 1);
+    }
+    map->blit = SDL_SoftBlit;
+    map->info.src_fmt = surface->format;
+    map->info.src_pitch = surface->pitch;
+    map->info.dst_fmt = dst->format;
+    map->info.dst_pitch = dst->pitch;
+    map->info.row_blit = NULL;
+
+    /* See if we can do RLE acceleration */
+    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
+        if (SDL_RLESurface(surface) == 0) {
+            return 0;
+        }
+    }
+
+    /* Choose a standard blit function.  Filtered scaling runs the
+       unscaled blit over each filtered row, otherwise it falls back to
+       the nearest neighbour scaling that comes with SDL_COPY_LINEAR.
+     */
+    if ((map->info.flags & SDL_COPY_LINEAR) &&
+        !(map->info.flags & SDL_COPY_COLORKEY) &&
+        SDL_CanScaleLinear(surface->format)) {
+        const int flags = map->info.flags;
+
+        map->info.flags &= ~(SDL_COPY_NEAREST | SDL_COPY_LINEAR);
+        map->info.row_blit = SDL_ChooseSurfaceBlit(surface);
+        map->info.flags = flags;
+        if (!map->info.row_blit && dst->format->BytesPerPixel > 1) {
+            map->info.row_blit = SDL_Blit_Slow;
+        }
+        if (map->info.row_blit) {
+            blit = SDL_Blit_Linear;
+        }
+    }
+    if (blit == NULL) {
+        blit = SDL_ChooseSurfaceBlit(surface);
+    }
 #ifndef TEST_SLOW_BLIT
     if (blit == NULL)
 #endif
@@ -290,7 +463,42 @@ SDL_CalculateBlit(SDL_Surface * surface)
         return (-1);
     }
 
+#if SDL_PROFILING
+    {
+        /* Count each blit function separately */
+        char name[64];
+        SDL_snprintf(name, sizeof(name), "SDL_SoftBlit %p %d->%d bpp",
+                     (void *) blit, surface->format->BitsPerPixel,
+                     dst->format->BitsPerPixel);
+        map->profile = SDL_ProfileFind((void *) blit, name);
+    }
+#endif
+
     return (0);
 }
 
+/* The blend mode or modulation flags of a surface changed from 'flags'.
+   Unless the modulation is baked into the palette map or the surface is
+   RLE encoded, the rest of the mapping still holds and only the blit has
+   to be picked again.
+ */
+void
+SDL_UpdateBlitFlags(SDL_Surface * surface, int flags)
+{
+    SDL_BlitMap *map = surface->map;
+
+    if (map->info.flags == flags || !map->dst) {
+        /* Nothing to do, or it'll be mapped again at the next blit */
+        return;
+    }
+    if ((surface->format->BytesPerPixel == 1 &&
+         map->dst->format->BytesPerPixel > 1) ||
+        (surface->flags & SDL_RLEACCEL) ||
+        ((map->info.flags | flags) & SDL_COPY_RLE_DESIRED)) {
+        SDL_InvalidateMap(map);
+        return;
+    }
+    SDL_CalculateBlit(surface);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
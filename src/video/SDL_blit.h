@@ -50,6 +50,7 @@
 #define SDL_COPY_MOD                0x00000080
 #define SDL_COPY_COLORKEY           0x00000100
 #define SDL_COPY_NEAREST            0x00000200
+#define SDL_COPY_LINEAR             0x00000400
 #define SDL_COPY_RLE_DESIRED        0x00001000
 #define SDL_COPY_RLE_COLORKEY       0x00002000
 #define SDL_COPY_RLE_ALPHAKEY       0x00004000
@@ -80,6 +81,7 @@ typedef struct
     int flags;
     Uint32 colorkey;
     Uint8 r, g, b, a;
+    void *row_blit;             /* Unscaled blit used by SDL_Blit_Linear() */
 } SDL_BlitInfo;
 
 typedef void (SDLCALL * SDL_BlitFunc) (SDL_BlitInfo * info);
@@ -105,10 +107,18 @@ typedef struct SDL_BlitMap
     /* the version count matches the destination; mismatch indicates
        an invalid mapping */
     unsigned int format_version;
+
+#if SDL_PROFILING
+    struct SDL_ProfileSlot *profile;    /* counts SDL_SoftBlit() calls */
+#endif
 } SDL_BlitMap;
 
 /* Functions found in SDL_blit.c */
+extern Uint32 SDL_GetBlitCPUFeatures(void);
+extern int SDL_InitBlitCache(void);
+extern void SDL_QuitBlitCache(void);
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern void SDL_UpdateBlitFlags(SDL_Surface * surface, int flags);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
@@ -7879,7 +7879,3557 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef __SSE2__
+
+/* Exact (x / 255) for each unsigned 16-bit lane */
+#define SDL_DIV255_SSE2(x) \
+    _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7)
+
+/* Lanes holding the color channels and the alpha channel of two pixels */
+#define SDL_RGBMASK_SSE2 _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1)
+#define SDL_ALPHA_SSE2 _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0)
+
+static __inline__ __m128i SDL_Blit_Modulate_SSE2(const SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    short r = 255, g = 255, b = 255, a = 255;
+
+    /* Modulating by 255 leaves a channel unchanged */
+    if (flags & SDL_COPY_MODULATE_COLOR) {
+        r = info->r;
+        g = info->g;
+        b = info->b;
+    }
+    if (flags & SDL_COPY_MODULATE_ALPHA) {
+        a = info->a;
+    }
+    return _mm_set_epi16(a, r, g, b, a, r, g, b);
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_RGB888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGB888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_RGB888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGB888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_RGB888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_RGB888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_RGB888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_RGB888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_BGR888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGB888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_BGR888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGB888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_BGR888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_RGB888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_BGR888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_RGB888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_ARGB8888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGB888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_ARGB8888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGB888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_ARGB8888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    return src;
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_RGB888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_RGB888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_RGB888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGR888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_RGB888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGR888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_RGB888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_BGR888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_RGB888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_BGR888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_BGR888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGR888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_BGR888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGR888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_BGR888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_BGR888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_BGR888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_BGR888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_ARGB8888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGR888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_ARGB8888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGR888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_ARGB8888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    return src;
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_BGR888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_BGR888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_RGB888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ARGB8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_RGB888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ARGB8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_RGB888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_ARGB8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_RGB888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_ARGB8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_BGR888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ARGB8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_BGR888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ARGB8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_BGR888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_ARGB8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_BGR888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_ARGB8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_RGB888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGBA8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_RGB888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGBA8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_RGB888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_RGBA8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_RGB888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_RGBA8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_BGR888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGBA8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_BGR888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGBA8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_BGR888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_RGBA8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_BGR888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_RGBA8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 3, 2, 1));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_RGB888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ABGR8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_RGB888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ABGR8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_RGB888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_ABGR8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_RGB888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_ABGR8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_BGR888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ABGR8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_BGR888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ABGR8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_BGR888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_ABGR8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_BGR888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_ABGR8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_RGB888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGRA8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_RGB888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGRA8888_RGB888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_RGB888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_BGRA8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_RGB888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_BGRA8888_RGB888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_BGR888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGRA8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_BGR888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGRA8888_BGR888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_BGR888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_BGRA8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_BGR888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_BGRA8888_BGR888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    dst = _mm_shufflelo_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    dst = _mm_shufflehi_epi16(dst, _MM_SHUFFLE(3, 0, 1, 2));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(3, 0, 1, 2));
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = zero;
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2_Pixels(__m128i src, const int flags, const __m128i modulate)
+{
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            lo = SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            lo = SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static __inline__ __m128i SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(__m128i src, __m128i dst, const int flags, const __m128i modulate)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+    src = _mm_shufflelo_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    src = _mm_shufflehi_epi16(src, _MM_SHUFFLE(0, 1, 2, 3));
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+    return src;
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+    __m128i srcpixels, lo, hi;
+    __m128i dstpixels;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+            lo = SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            hi = SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpackhi_epi8(srcpixels, zero), _mm_unpackhi_epi8(dstpixels, zero), flags, modulate);
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+            dstpixels = _mm_cvtsi32_si128(*dst);
+            lo = SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2_Pixels(_mm_unpacklo_epi8(srcpixels, zero), _mm_unpacklo_epi8(dstpixels, zero), flags, modulate);
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* __SSE2__ */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
@@ -7887,6 +11437,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
@@ -7894,6 +11449,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
@@ -7901,6 +11461,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
@@ -7908,6 +11473,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
@@ -7915,6 +11485,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
@@ -7922,6 +11497,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
@@ -7929,6 +11509,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
@@ -7936,6 +11521,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
@@ -7943,6 +11533,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
@@ -7950,6 +11545,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
@@ -7957,6 +11557,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
@@ -7964,6 +11569,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
@@ -7971,6 +11581,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
@@ -7978,6 +11593,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
@@ -7985,6 +11605,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
@@ -7992,6 +11617,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
@@ -7999,6 +11629,11 @@ SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
+#ifdef __SSE2__
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
@@ -0,0 +1,317 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+#include "SDL_video.h"
+#include "SDL_blit.h"
+#include "SDL_blit_linear.h"
+
+/* Bilinear filtered scaling
+
+   The weights are 7-bit fixed point.  Each source row that's needed is
+   filtered horizontally once into 16-bit channels, and the last two are
+   kept around, so upscaling only does the vertical pass for most rows.
+   The SSE2 versions of both passes give exactly the same results.
+ */
+
+#define LINEAR_BITS     7
+#define LINEAR_ONE      (1 << LINEAR_BITS)
+
+SDL_bool
+SDL_CanScaleLinear(const SDL_PixelFormat * format)
+{
+    const Uint32 masks[] =
+        { format->Rmask, format->Gmask, format->Bmask, format->Amask };
+    int i;
+
+    if (format->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < SDL_arraysize(masks); ++i) {
+        switch (masks[i]) {
+        case 0x00000000:
+        case 0x000000FF:
+        case 0x0000FF00:
+        case 0x00FF0000:
+        case 0xFF000000:
+            break;
+        default:
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+int
+SDL_InitLinearScale(SDL_LinearScale * scale, int src_w, int src_h,
+                    int dst_w, int dst_h)
+{
+    Uint8 *data;
+    int x, pos, inc;
+
+    data = (Uint8 *) SDL_malloc(dst_w * (2 * 4 * sizeof(Sint16) +
+                                         2 * sizeof(int) +
+                                         2 * sizeof(Sint16)));
+    if (!data) {
+        SDL_OutOfMemory();
+        return -1;
+    }
+    scale->rows[0] = (Sint16 *) data;
+    scale->rows[1] = scale->rows[0] + 4 * dst_w;
+    scale->xofs = (int *) (scale->rows[1] + 4 * dst_w);
+    scale->xweight = (Sint16 *) (scale->xofs + 2 * dst_w);
+    scale->row_y[0] = scale->row_y[1] = -1;
+    scale->src_w = src_w;
+    scale->src_h = src_h;
+    scale->dst_w = dst_w;
+    scale->dst_h = dst_h;
+
+    /* Sample at the center of each destination pixel */
+    inc = (src_w << 16) / dst_w;
+    pos = (inc >> 1) - 0x8000;
+    for (x = 0; x < dst_w; ++x) {
+        int x0 = 0, weight = 0;
+
+        if (pos > 0) {
+            x0 = pos >> 16;
+            weight = (pos >> (16 - LINEAR_BITS)) & (LINEAR_ONE - 1);
+        }
+        if (x0 >= src_w - 1) {
+            x0 = src_w - 1;
+            weight = 0;
+        }
+        scale->xofs[2 * x] = x0 * 4;
+        scale->xofs[2 * x + 1] = (weight ? x0 + 1 : x0) * 4;
+        scale->xweight[2 * x] = LINEAR_ONE - weight;
+        scale->xweight[2 * x + 1] = weight;
+        pos += inc;
+    }
+
+    scale->inc = (src_h << 16) / dst_h;
+    scale->pos = (scale->inc >> 1) - 0x8000;
+    return 0;
+}
+
+static void
+SDL_LinearScaleH(const SDL_LinearScale * scale, const Uint8 * src,
+                 Sint16 * dst)
+{
+    const int *xofs = scale->xofs;
+    const Sint16 *xweight = scale->xweight;
+    int n = scale->dst_w;
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i a, b;
+
+        while (n >= 2) {
+            a = _mm_unpacklo_epi32(_mm_cvtsi32_si128
+                                   (*(const Uint32 *) (src + xofs[0])),
+                                   _mm_cvtsi32_si128(*(const Uint32 *)
+                                                     (src + xofs[1])));
+            b = _mm_unpacklo_epi32(_mm_cvtsi32_si128
+                                   (*(const Uint32 *) (src + xofs[2])),
+                                   _mm_cvtsi32_si128(*(const Uint32 *)
+                                                     (src + xofs[3])));
+            a = _mm_mullo_epi16(_mm_unpacklo_epi8(a, zero),
+                                _mm_set_epi16(xweight[1], xweight[1],
+                                              xweight[1], xweight[1],
+                                              xweight[0], xweight[0],
+                                              xweight[0], xweight[0]));
+            b = _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero),
+                                _mm_set_epi16(xweight[3], xweight[3],
+                                              xweight[3], xweight[3],
+                                              xweight[2], xweight[2],
+                                              xweight[2], xweight[2]));
+            /* Add the left and right pixel of each pair */
+            _mm_storeu_si128((__m128i *) dst,
+                             _mm_add_epi16(_mm_unpacklo_epi64(a, b),
+                                           _mm_unpackhi_epi64(a, b)));
+            xofs += 4;
+            xweight += 4;
+            dst += 8;
+            n -= 2;
+        }
+    }
+#endif
+    while (n--) {
+        const Uint8 *p0 = src + xofs[0];
+        const Uint8 *p1 = src + xofs[1];
+        const int w0 = xweight[0];
+        const int w1 = xweight[1];
+
+        dst[0] = p0[0] * w0 + p1[0] * w1;
+        dst[1] = p0[1] * w0 + p1[1] * w1;
+        dst[2] = p0[2] * w0 + p1[2] * w1;
+        dst[3] = p0[3] * w0 + p1[3] * w1;
+        xofs += 2;
+        xweight += 2;
+        dst += 4;
+    }
+}
+
+static void
+SDL_LinearScaleV(const Sint16 * row0, const Sint16 * row1, int weight,
+                 int n, Uint8 * dst)
+{
+    const int w0 = LINEAR_ONE - weight;
+    const int w1 = weight;
+    const int round = 1 << (2 * LINEAR_BITS - 1);
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        const __m128i w = _mm_set1_epi32((w1 << 16) | w0);
+        const __m128i r = _mm_set1_epi32(round);
+        __m128i a0, a1, b0, b1, v0, v1, v2, v3;
+
+        while (n >= 16) {
+            a0 = _mm_loadu_si128((const __m128i *) row0);
+            a1 = _mm_loadu_si128((const __m128i *) (row0 + 8));
+            b0 = _mm_loadu_si128((const __m128i *) row1);
+            b1 = _mm_loadu_si128((const __m128i *) (row1 + 8));
+            v0 = _mm_madd_epi16(_mm_unpacklo_epi16(a0, b0), w);
+            v1 = _mm_madd_epi16(_mm_unpackhi_epi16(a0, b0), w);
+            v2 = _mm_madd_epi16(_mm_unpacklo_epi16(a1, b1), w);
+            v3 = _mm_madd_epi16(_mm_unpackhi_epi16(a1, b1), w);
+            v0 = _mm_srai_epi32(_mm_add_epi32(v0, r), 2 * LINEAR_BITS);
+            v1 = _mm_srai_epi32(_mm_add_epi32(v1, r), 2 * LINEAR_BITS);
+            v2 = _mm_srai_epi32(_mm_add_epi32(v2, r), 2 * LINEAR_BITS);
+            v3 = _mm_srai_epi32(_mm_add_epi32(v3, r), 2 * LINEAR_BITS);
+            _mm_storeu_si128((__m128i *) dst,
+                             _mm_packus_epi16(_mm_packs_epi32(v0, v1),
+                                              _mm_packs_epi32(v2, v3)));
+            row0 += 16;
+            row1 += 16;
+            dst += 16;
+            n -= 16;
+        }
+    }
+#endif
+    while (n--) {
+        *dst++ = (Uint8) ((*row0++ * w0 + *row1++ * w1 + round) >>
+                          (2 * LINEAR_BITS));
+    }
+}
+
+/* Return source row 'y' filtered horizontally, reusing a cached copy if
+   there is one.  The rows are always requested top to bottom, so the
+   one with the lower row number is replaced. */
+static const Sint16 *
+SDL_GetLinearRow(SDL_LinearScale * scale, const Uint8 * src, int src_pitch,
+                 int y)
+{
+    int i;
+
+    if (scale->row_y[0] == y) {
+        return scale->rows[0];
+    }
+    if (scale->row_y[1] == y) {
+        return scale->rows[1];
+    }
+    i = (scale->row_y[0] < scale->row_y[1]) ? 0 : 1;
+    SDL_LinearScaleH(scale, src + y * src_pitch, scale->rows[i]);
+    scale->row_y[i] = y;
+    return scale->rows[i];
+}
+
+/* Filter the next destination row */
+void
+SDL_LinearScaleRow(SDL_LinearScale * scale, const Uint8 * src,
+                   int src_pitch, Uint32 * dst)
+{
+    const Sint16 *row0, *row1;
+    int y0 = 0, weight = 0;
+
+    if (scale->pos > 0) {
+        y0 = scale->pos >> 16;
+        weight = (scale->pos >> (16 - LINEAR_BITS)) & (LINEAR_ONE - 1);
+    }
+    if (y0 >= scale->src_h - 1) {
+        y0 = scale->src_h - 1;
+        weight = 0;
+    }
+    scale->pos += scale->inc;
+
+    row0 = SDL_GetLinearRow(scale, src, src_pitch, y0);
+    if (weight) {
+        row1 = SDL_GetLinearRow(scale, src, src_pitch, y0 + 1);
+    } else {
+        row1 = row0;
+    }
+    SDL_LinearScaleV(row0, row1, weight, 4 * scale->dst_w, (Uint8 *) dst);
+}
+
+void
+SDL_QuitLinearScale(SDL_LinearScale * scale)
+{
+    SDL_free(scale->rows[0]);
+    scale->rows[0] = NULL;
+}
+
+/* Filter each destination row into a buffer in the source format, then
+   run the unscaled blit on it to do the conversion, modulation and
+   blending. */
+void
+SDL_Blit_Linear(SDL_BlitInfo * info)
+{
+    SDL_BlitFunc RunBlit = (SDL_BlitFunc) info->row_blit;
+    SDL_LinearScale scale;
+    SDL_BlitInfo row;
+    Uint32 *buffer;
+    int y;
+
+    if (info->src_w == info->dst_w && info->src_h == info->dst_h) {
+        RunBlit(info);
+        return;
+    }
+
+    if (SDL_InitLinearScale(&scale, info->src_w, info->src_h,
+                            info->dst_w, info->dst_h) < 0) {
+        return;
+    }
+    buffer = (Uint32 *) SDL_malloc(info->dst_w * sizeof(Uint32));
+    if (!buffer) {
+        SDL_QuitLinearScale(&scale);
+        SDL_OutOfMemory();
+        return;
+    }
+
+    for (y = 0; y < info->dst_h; ++y) {
+        SDL_LinearScaleRow(&scale, info->src, info->src_pitch, buffer);
+
+        row = *info;
+        row.src = (Uint8 *) buffer;
+        row.src_w = info->dst_w;
+        row.src_h = 1;
+        row.src_pitch = info->dst_w * sizeof(Uint32);
+        row.src_skip = 0;
+        row.dst = info->dst + y * info->dst_pitch;
+        row.dst_h = 1;
+        RunBlit(&row);
+    }
+
+    SDL_free(buffer);
+    SDL_QuitLinearScale(&scale);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
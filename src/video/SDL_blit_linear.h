@@ -0,0 +1,46 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+/* Bilinear filtering of 32-bit pixels with 8-bit channels.  Each byte is
+   filtered on its own, so the channel order doesn't matter. */
+typedef struct
+{
+    int src_w, src_h;
+    int dst_w, dst_h;
+    int *xofs;                  /* Offsets of the left and right pixels */
+    Sint16 *xweight;            /* Weights of the left and right pixels */
+    Sint16 *rows[2];            /* Horizontally filtered source rows */
+    int row_y[2];               /* The source row held in each, or -1 */
+    int pos, inc;               /* Vertical position in 16.16 fixed point */
+} SDL_LinearScale;
+
+extern SDL_bool SDL_CanScaleLinear(const SDL_PixelFormat * format);
+extern int SDL_InitLinearScale(SDL_LinearScale * scale, int src_w, int src_h,
+                               int dst_w, int dst_h);
+extern void SDL_LinearScaleRow(SDL_LinearScale * scale, const Uint8 * src,
+                               int src_pitch, Uint32 * dst);
+extern void SDL_QuitLinearScale(SDL_LinearScale * scale);
+
+extern void SDL_Blit_Linear(SDL_BlitInfo * info);
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,158 @@
+/*
+    SDL - Simple DirectMedia Layer
+    Copyright (C) 1997-2009 Sam Lantinga
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+
+    Sam Lantinga
+    slouken@libsdl.org
+*/
+#include "SDL_config.h"
+
+#include "SDL_video.h"
+#include "SDL_threadpool.h"
+#include "SDL_blit.h"
+#include "SDL_blit_threads.h"
+
+/* Multithreaded software blitting
+
+   Large blits can be split into horizontal bands which are run in
+   parallel on SDL's shared thread pool.  This is off by default, set the
+   environment variable SDL_BLIT_THREADS to the number of bands (at most
+   one for each thread in the pool, counting the calling thread) to split
+   blits into.  Blits smaller than SDL_BLIT_THREAD_THRESHOLD pixels stay
+   on the calling thread, since waking the workers costs more than they
+   save.
+ */
+
+#define SDL_BLIT_MAX_THREADS        16
+#define SDL_BLIT_DEFAULT_THRESHOLD  (256 * 256)
+#define SDL_BLIT_MIN_BAND_HEIGHT    16
+
+static struct
+{
+    int num_threads;
+    int threshold;
+    SDL_ThreadPool *pool;
+} SDL_blit_pool;
+
+typedef struct
+{
+    SDL_BlitFunc blit;
+    SDL_BlitInfo *info;
+    int bands;
+} SDL_BlitBands;
+
+int
+SDL_BlitThreadsInit(void)
+{
+#if !SDL_THREADS_DISABLED
+    const char *env;
+    int num_threads;
+
+    env = SDL_getenv("SDL_BLIT_THREADS");
+    if (!env) {
+        return 0;
+    }
+    num_threads = SDL_atoi(env);
+    if (num_threads > SDL_BLIT_MAX_THREADS) {
+        num_threads = SDL_BLIT_MAX_THREADS;
+    }
+    if (num_threads < 2) {
+        return 0;
+    }
+
+    SDL_blit_pool.threshold = SDL_BLIT_DEFAULT_THRESHOLD;
+    env = SDL_getenv("SDL_BLIT_THREAD_THRESHOLD");
+    if (env) {
+        SDL_blit_pool.threshold = SDL_atoi(env);
+    }
+
+    SDL_blit_pool.pool = SDL_GetSharedThreadPool();
+    if (!SDL_blit_pool.pool) {
+        return -1;
+    }
+    if (num_threads > SDL_GetThreadPoolSize(SDL_blit_pool.pool) + 1) {
+        num_threads = SDL_GetThreadPoolSize(SDL_blit_pool.pool) + 1;
+    }
+    SDL_blit_pool.num_threads = num_threads;
+#endif
+    return 0;
+}
+
+void
+SDL_BlitThreadsQuit(void)
+{
+    /* The pool itself belongs to SDL_Quit() */
+    SDL_blit_pool.pool = NULL;
+    SDL_blit_pool.num_threads = 0;
+}
+
+static void SDLCALL
+SDL_BlitBand(void *data, int start, int end)
+{
+    SDL_BlitBands *bands = (SDL_BlitBands *) data;
+    SDL_BlitInfo band;
+    int i, y, h;
+
+    for (i = start; i < end; ++i) {
+        y = (bands->info->dst_h * i) / bands->bands;
+        h = (bands->info->dst_h * (i + 1)) / bands->bands - y;
+        band = *bands->info;
+        band.src += y * band.src_pitch;
+        band.src_h = h;
+        band.dst += y * band.dst_pitch;
+        band.dst_h = h;
+        bands->blit(&band);
+    }
+}
+
+/* Run a blit split into horizontal bands on the worker threads.
+   This returns SDL_FALSE if the blit should be run on the calling thread.
+ */
+SDL_bool
+SDL_ThreadedBlit(SDL_BlitFunc blit, SDL_BlitInfo * info)
+{
+    SDL_BlitBands bands;
+
+    if (SDL_blit_pool.num_threads < 2) {
+        return SDL_FALSE;
+    }
+
+    /* Scaled blits step through the source in fixed point across the
+       whole destination height, so they can't be cut into bands. */
+    if (info->src_h != info->dst_h) {
+        return SDL_FALSE;
+    }
+    if ((info->dst_w * info->dst_h) < SDL_blit_pool.threshold) {
+        return SDL_FALSE;
+    }
+
+    bands.bands = info->dst_h / SDL_BLIT_MIN_BAND_HEIGHT;
+    if (bands.bands > SDL_blit_pool.num_threads) {
+        bands.bands = SDL_blit_pool.num_threads;
+    }
+    if (bands.bands < 2) {
+        return SDL_FALSE;
+    }
+    bands.blit = blit;
+    bands.info = info;
+
+    SDL_ParallelFor(SDL_blit_pool.pool, 0, bands.bands, 1, SDL_BlitBand,
+                    &bands);
+    return SDL_TRUE;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
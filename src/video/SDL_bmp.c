@@ -50,7 +50,7 @@ SDL_Surface *
 SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
 {
     int was_error;
-    long fp_offset;
+    Sint64 fp_offset;
     int bmpPitch;
     int i, pad;
     SDL_Surface *surface;
@@ -60,6 +60,7 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     SDL_Palette *palette;
     Uint8 *bits;
     int ExpandBMP;
+    SDL_RWops *buffered = NULL;
 
     /* The Win32 BMP file header (14 bytes) */
     char magic[2];
@@ -92,6 +93,18 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     /* Read in the BMP file header */
     fp_offset = SDL_RWtell(src);
     SDL_ClearError();
+
+    /* The header, palette and small pixels are read a few bytes at a time,
+       so read them through a buffer unless they're already in memory.
+       Without 'freesrc', the source has to seek back to the end of the
+       image afterwards. */
+    if (!SDL_RWGetMemory(src, NULL) && (freesrc || fp_offset >= 0)) {
+        buffered = SDL_RWFromBufferedRW(src, 0, freesrc);
+        if (buffered) {
+            src = buffered;
+        }
+    }
+
     if (SDL_RWread(src, magic, 1, 2) != 2) {
         SDL_Error(SDL_EFREAD);
         was_error = 1;
@@ -342,6 +355,8 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     }
     if (freesrc && src) {
         SDL_RWclose(src);
+    } else if (buffered) {
+        SDL_RWclose(buffered);
     }
     return (surface);
 }
@@ -349,7 +364,7 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
 int
 SDL_SaveBMP_RW(SDL_Surface * saveme, SDL_RWops * dst, int freedst)
 {
-    long fp_offset;
+    Sint64 fp_offset;
     int i, pad;
     SDL_Surface *surface;
     Uint8 *bits;
@@ -495,7 +510,7 @@ SDL_SaveBMP_RW(SDL_Surface * saveme, SDL_RWops * dst, int freedst)
         }
 
         /* Write the bitmap offset */
-        bfOffBits = SDL_RWtell(dst) - fp_offset;
+        bfOffBits = (Uint32) (SDL_RWtell(dst) - fp_offset);
         if (SDL_RWseek(dst, fp_offset + 10, RW_SEEK_SET) < 0) {
             SDL_Error(SDL_EFSEEK);
         }
@@ -522,7 +537,7 @@ SDL_SaveBMP_RW(SDL_Surface * saveme, SDL_RWops * dst, int freedst)
         }
 
         /* Write the BMP file size */
-        bfSize = SDL_RWtell(dst) - fp_offset;
+        bfSize = (Uint32) (SDL_RWtell(dst) - fp_offset);
         if (SDL_RWseek(dst, fp_offset + 2, RW_SEEK_SET) < 0) {
             SDL_Error(SDL_EFSEEK);
         }
@@ -57,4 +57,51 @@ SDL_DrawPoint(SDL_Surface * dst, int x, int y, Uint32 color)
     return 0;
 }
 
+int
+SDL_DrawPoints(SDL_Surface * dst, const SDL_Point * points, int count,
+               Uint32 color)
+{
+    int minx, miny;
+    int maxx, maxy;
+    int i;
+    int x, y;
+
+    /* This function doesn't work on surfaces < 8 bpp */
+    if (dst->format->BitsPerPixel < 8) {
+        SDL_SetError("SDL_DrawPoints(): Unsupported surface format");
+        return (-1);
+    }
+    if (dst->format->BytesPerPixel == 3) {
+        SDL_Unsupported();
+        return -1;
+    }
+
+    minx = dst->clip_rect.x;
+    maxx = dst->clip_rect.x + dst->clip_rect.w - 1;
+    miny = dst->clip_rect.y;
+    maxy = dst->clip_rect.y + dst->clip_rect.h - 1;
+
+    for (i = 0; i < count; ++i) {
+        x = points[i].x;
+        y = points[i].y;
+
+        if (x < minx || x > maxx || y < miny || y > maxy) {
+            continue;
+        }
+
+        switch (dst->format->BytesPerPixel) {
+        case 1:
+            DRAW_FASTSETPIXEL1(x, y);
+            break;
+        case 2:
+            DRAW_FASTSETPIXEL2(x, y);
+            break;
+        case 4:
+            DRAW_FASTSETPIXEL4(x, y);
+            break;
+        }
+    }
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -118,6 +118,57 @@ SDL_UnionRect(const SDL_Rect * A, const SDL_Rect * B, SDL_Rect * result)
     result->h = Amax - Amin;
 }
 
+SDL_bool
+SDL_EnclosePoints(const SDL_Point * points, int count, const SDL_Rect * clip,
+                  SDL_Rect * result)
+{
+    int minx = 0;
+    int miny = 0;
+    int maxx = 0;
+    int maxy = 0;
+    int x, y, i;
+    SDL_bool added = SDL_FALSE;
+
+    for (i = 0; i < count; ++i) {
+        x = points[i].x;
+        y = points[i].y;
+
+        if (clip) {
+            if (x < clip->x || x >= (clip->x + clip->w) ||
+                y < clip->y || y >= (clip->y + clip->h)) {
+                continue;
+            }
+        }
+        if (!added) {
+            minx = maxx = x;
+            miny = maxy = y;
+            added = SDL_TRUE;
+            continue;
+        }
+        if (x < minx) {
+            minx = x;
+        } else if (x > maxx) {
+            maxx = x;
+        }
+        if (y < miny) {
+            miny = y;
+        } else if (y > maxy) {
+            maxy = y;
+        }
+    }
+    if (!added) {
+        return SDL_FALSE;
+    }
+
+    if (result) {
+        result->x = minx;
+        result->y = miny;
+        result->w = (maxx - minx) + 1;
+        result->h = (maxy - miny) + 1;
+    }
+    return SDL_TRUE;
+}
+
 SDL_bool
 SDL_IntersectRectAndLine(const SDL_Rect * rect, int *X1, int *Y1, int *X2,
                          int *Y2)
@@ -275,11 +326,139 @@ SDL_IntersectRectAndLine(const SDL_Rect * rect, int *X1, int *Y1, int *X2,
     return SDL_FALSE;
 }
 
+/* The grid is kept to at most this many tiles across and down */
+#define MAX_DIRTY_TILES     128
+#define MIN_DIRTY_SHIFT     4
+
+/* Percentage of dirty tiles past which the whole area is updated.  By then
+   the clean pixels saved are worth less than the many small copies.
+ */
+#define FULL_DIRTY_COVERAGE 50
+
+static SDL_DirtyRect *
+SDL_NewDirtyRect(SDL_DirtyRectList * list)
+{
+    SDL_DirtyRect *dirty;
+
+    if (list->free) {
+        dirty = list->free;
+        list->free = dirty->next;
+    } else {
+        dirty = (SDL_DirtyRect *) SDL_malloc(sizeof(*dirty));
+    }
+    return dirty;
+}
+
+/* Move the rectangles handed out to the free list */
+static void
+SDL_RecycleDirtyRects(SDL_DirtyRectList * list)
+{
+    while (list->list) {
+        SDL_DirtyRect *dirty = list->list;
+        list->list = dirty->next;
+        dirty->next = list->free;
+        list->free = dirty;
+    }
+}
+
+void
+SDL_SetDirtyRectBounds(SDL_DirtyRectList * list, int w, int h)
+{
+    int shift;
+
+    if (list->tiles && list->w == w && list->h == h) {
+        return;
+    }
+    SDL_ClearDirtyRects(list);
+    if (list->tiles) {
+        SDL_free(list->tiles);
+        list->tiles = NULL;
+    }
+    if (list->spans) {
+        SDL_free(list->spans);
+        list->spans = NULL;
+    }
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    shift = MIN_DIRTY_SHIFT;
+    while ((w >> shift) >= MAX_DIRTY_TILES ||
+           (h >> shift) >= MAX_DIRTY_TILES) {
+        ++shift;
+    }
+    list->w = w;
+    list->h = h;
+    list->tile_shift = shift;
+    list->tiles_w = (w + (1 << shift) - 1) >> shift;
+    list->tiles_h = (h + (1 << shift) - 1) >> shift;
+    list->tiles = (Uint8 *) SDL_calloc(list->tiles_w * list->tiles_h, 1);
+    list->spans = (SDL_DirtyRect **)
+        SDL_malloc(list->tiles_w * sizeof(*list->spans));
+    if (!list->tiles || !list->spans) {
+        /* Fall back to keeping the rectangles as they come */
+        if (list->tiles) {
+            SDL_free(list->tiles);
+            list->tiles = NULL;
+        }
+        if (list->spans) {
+            SDL_free(list->spans);
+            list->spans = NULL;
+        }
+    }
+    list->dirty_tiles = 0;
+    list->miny = list->tiles_h;
+    list->maxy = -1;
+    list->full = SDL_FALSE;
+    list->built = SDL_FALSE;
+}
+
 void
 SDL_AddDirtyRect(SDL_DirtyRectList * list, const SDL_Rect * rect)
 {
     SDL_DirtyRect *dirty;
 
+    if (list->tiles) {
+        SDL_Rect area, clipped;
+        int x, y, x1, x2, y1, y2;
+
+        if (list->full) {
+            return;
+        }
+        area.x = 0;
+        area.y = 0;
+        area.w = list->w;
+        area.h = list->h;
+        if (!SDL_IntersectRect(rect, &area, &clipped)) {
+            return;
+        }
+        x1 = clipped.x >> list->tile_shift;
+        x2 = (clipped.x + clipped.w - 1) >> list->tile_shift;
+        y1 = clipped.y >> list->tile_shift;
+        y2 = (clipped.y + clipped.h - 1) >> list->tile_shift;
+        for (y = y1; y <= y2; ++y) {
+            Uint8 *row = list->tiles + y * list->tiles_w;
+            for (x = x1; x <= x2; ++x) {
+                if (!row[x]) {
+                    row[x] = 1;
+                    ++list->dirty_tiles;
+                }
+            }
+        }
+        if (y1 < list->miny) {
+            list->miny = y1;
+        }
+        if (y2 > list->maxy) {
+            list->maxy = y2;
+        }
+        if (list->dirty_tiles * 100 >=
+            list->tiles_w * list->tiles_h * FULL_DIRTY_COVERAGE) {
+            list->full = SDL_TRUE;
+        }
+        list->built = SDL_FALSE;
+        return;
+    }
+
     /* FIXME: At what point is this optimization too expensive? */
     for (dirty = list->list; dirty; dirty = dirty->next) {
         if (SDL_HasIntersection(&dirty->rect, rect)) {
@@ -288,25 +467,122 @@ SDL_AddDirtyRect(SDL_DirtyRectList * list, const SDL_Rect * rect)
         }
     }
 
-    if (list->free) {
-        dirty = list->free;
-        list->free = dirty->next;
-    } else {
-        dirty = (SDL_DirtyRect *) SDL_malloc(sizeof(*dirty));
-        if (!dirty) {
-            return;
-        }
+    dirty = SDL_NewDirtyRect(list);
+    if (!dirty) {
+        return;
     }
     dirty->rect = *rect;
     dirty->next = list->list;
     list->list = dirty;
 }
 
+SDL_DirtyRect *
+SDL_GetDirtyRects(SDL_DirtyRectList * list)
+{
+    SDL_DirtyRect *dirty, **tail;
+    const int size = (1 << list->tile_shift);
+    int x, y;
+
+    if (!list->tiles || list->built) {
+        return list->list;
+    }
+    SDL_RecycleDirtyRects(list);
+    list->built = SDL_TRUE;
+    if (list->maxy < 0) {
+        return NULL;
+    }
+
+    tail = &list->list;
+    if (!list->full) {
+        SDL_memset(list->spans, 0, list->tiles_w * sizeof(*list->spans));
+        for (y = list->miny; y <= list->maxy; ++y) {
+            const Uint8 *row = list->tiles + y * list->tiles_w;
+
+            x = 0;
+            while (x < list->tiles_w) {
+                int start;
+
+                if (!row[x]) {
+                    ++x;
+                    continue;
+                }
+                start = x;
+                while (x < list->tiles_w && row[x]) {
+                    ++x;
+                }
+
+                /* Grow the rectangle above if it's the same width */
+                dirty = list->spans[start];
+                if (dirty && dirty->rect.w == (x - start) * size &&
+                    dirty->rect.y + dirty->rect.h == y * size) {
+                    dirty->rect.h += size;
+                    continue;
+                }
+                dirty = SDL_NewDirtyRect(list);
+                if (!dirty) {
+                    /* Out of memory, just update everything */
+                    *tail = NULL;
+                    SDL_RecycleDirtyRects(list);
+                    tail = &list->list;
+                    list->full = SDL_TRUE;
+                    break;
+                }
+                dirty->rect.x = start * size;
+                dirty->rect.y = y * size;
+                dirty->rect.w = (x - start) * size;
+                dirty->rect.h = size;
+                list->spans[start] = dirty;
+                *tail = dirty;
+                tail = &dirty->next;
+            }
+            if (list->full) {
+                break;
+            }
+        }
+    }
+    if (list->full) {
+        dirty = SDL_NewDirtyRect(list);
+        if (!dirty) {
+            return NULL;
+        }
+        dirty->rect.x = 0;
+        dirty->rect.y = 0;
+        dirty->rect.w = list->w;
+        dirty->rect.h = list->h;
+        *tail = dirty;
+        tail = &dirty->next;
+    }
+    *tail = NULL;
+
+    /* The last row and column of tiles can hang over the edge */
+    for (dirty = list->list; dirty; dirty = dirty->next) {
+        if (dirty->rect.x + dirty->rect.w > list->w) {
+            dirty->rect.w = list->w - dirty->rect.x;
+        }
+        if (dirty->rect.y + dirty->rect.h > list->h) {
+            dirty->rect.h = list->h - dirty->rect.y;
+        }
+    }
+    return list->list;
+}
+
 void
 SDL_ClearDirtyRects(SDL_DirtyRectList * list)
 {
     SDL_DirtyRect *prev, *curr;
 
+    if (list->tiles) {
+        if (list->maxy >= 0) {
+            SDL_memset(list->tiles + list->miny * list->tiles_w, 0,
+                       (list->maxy - list->miny + 1) * list->tiles_w);
+        }
+        list->dirty_tiles = 0;
+        list->miny = list->tiles_h;
+        list->maxy = -1;
+        list->full = SDL_FALSE;
+        list->built = SDL_FALSE;
+    }
+
     /* Skip to the end of the free list */
     prev = NULL;
     for (curr = list->free; curr; curr = curr->next) {
@@ -335,6 +611,14 @@ SDL_FreeDirtyRects(SDL_DirtyRectList * list)
         list->free = elem->next;
         SDL_free(elem);
     }
+    if (list->tiles) {
+        SDL_free(list->tiles);
+        list->tiles = NULL;
+    }
+    if (list->spans) {
+        SDL_free(list->spans);
+        list->spans = NULL;
+    }
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -27,13 +27,34 @@ typedef struct SDL_DirtyRect
     struct SDL_DirtyRect *next;
 } SDL_DirtyRect;
 
+/* Once a list knows the size of the area it covers, dirty rectangles are
+   marked on a grid of tiles and turned into rectangles when they're asked
+   for: runs of tiles on a row make a span, and spans that line up on the
+   following rows are merged into one rectangle.  When most of the area is
+   dirty, the whole area is returned instead.
+
+   Lists without bounds keep the rectangles as they were added, merging
+   only the ones that overlap.
+ */
 typedef struct SDL_DirtyRectList
 {
     SDL_DirtyRect *list;
     SDL_DirtyRect *free;
+
+    int w, h;                   /* The area covered by the tiles */
+    int tile_shift;             /* log2 of the tile size in pixels */
+    int tiles_w, tiles_h;
+    Uint8 *tiles;               /* Nonzero for each dirty tile */
+    SDL_DirtyRect **spans;      /* Rectangles being built, by first tile */
+    int dirty_tiles;
+    int miny, maxy;             /* The rows with dirty tiles */
+    SDL_bool full;
+    SDL_bool built;             /* 'list' is up to date with the tiles */
 } SDL_DirtyRectList;
 
+extern void SDL_SetDirtyRectBounds(SDL_DirtyRectList * list, int w, int h);
 extern void SDL_AddDirtyRect(SDL_DirtyRectList * list, const SDL_Rect * rect);
+extern SDL_DirtyRect *SDL_GetDirtyRects(SDL_DirtyRectList * list);
 extern void SDL_ClearDirtyRects(SDL_DirtyRectList * list);
 extern void SDL_FreeDirtyRects(SDL_DirtyRectList * list);
 
@@ -102,6 +102,15 @@ static int GL_RenderLine(SDL_Renderer * renderer, int x1, int y1, int x2,
 static int GL_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect);
 static int GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_Rect * dstrect);
+static int GL_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points,
+                           int count);
+static int GL_RenderLines(SDL_Renderer * renderer, const SDL_Point * points,
+                          int count);
+static int GL_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects,
+                          int count);
+static int GL_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                           const SDL_Rect * srcrects,
+                           const SDL_Rect * dstrects, int count);
 
 static void GL_RenderPresent(SDL_Renderer * renderer);
 static void GL_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture);
@@ -314,6 +323,10 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderLine = GL_RenderLine;
     renderer->RenderFill = GL_RenderFill;
     renderer->RenderCopy = GL_RenderCopy;
+    renderer->RenderPoints = GL_RenderPoints;
+    renderer->RenderLines = GL_RenderLines;
+    renderer->RenderFills = GL_RenderFills;
+    renderer->RenderCopies = GL_RenderCopies;
     renderer->RenderPresent = GL_RenderPresent;
     renderer->DestroyTexture = GL_DestroyTexture;
     renderer->DestroyRenderer = GL_DestroyRenderer;
@@ -768,6 +781,7 @@ GL_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
             SDL_free(data);
             return -1;
         }
+        SDL_SetDirtyRectBounds(&data->dirty, texture->w, texture->h);
     }
 
     texture->driverdata = data;
@@ -1124,17 +1138,94 @@ GL_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect)
     return 0;
 }
 
+static int
+GL_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points, int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    int i;
+
+    GL_SetBlendMode(data, renderer->blendMode);
+
+    data->glColor4f((GLfloat) renderer->r * inv255f,
+                    (GLfloat) renderer->g * inv255f,
+                    (GLfloat) renderer->b * inv255f,
+                    (GLfloat) renderer->a * inv255f);
+
+    data->glBegin(GL_POINTS);
+    for (i = 0; i < count; ++i) {
+        data->glVertex2i(points[i].x, points[i].y);
+    }
+    data->glEnd();
+
+    return 0;
+}
+
+static int
+GL_RenderLines(SDL_Renderer * renderer, const SDL_Point * points, int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    int i;
+
+    GL_SetBlendMode(data, renderer->blendMode);
+
+    data->glColor4f((GLfloat) renderer->r * inv255f,
+                    (GLfloat) renderer->g * inv255f,
+                    (GLfloat) renderer->b * inv255f,
+                    (GLfloat) renderer->a * inv255f);
+
+    data->glBegin(GL_LINES);
+    for (i = 0; i < 2 * count; ++i) {
+        data->glVertex2i(points[i].x, points[i].y);
+    }
+    data->glEnd();
+
+    return 0;
+}
+
+static int
+GL_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects, int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    int i;
+
+    GL_SetBlendMode(data, renderer->blendMode);
+
+    data->glColor4f((GLfloat) renderer->r * inv255f,
+                    (GLfloat) renderer->g * inv255f,
+                    (GLfloat) renderer->b * inv255f,
+                    (GLfloat) renderer->a * inv255f);
+
+    for (i = 0; i < count; ++i) {
+        const SDL_Rect *rect = &rects[i];
+
+        data->glRecti(rect->x, rect->y, rect->x + rect->w,
+                      rect->y + rect->h);
+    }
+
+    return 0;
+}
+
 static int
 GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
               const SDL_Rect * srcrect, const SDL_Rect * dstrect)
+{
+    return GL_RenderCopies(renderer, texture, srcrect, dstrect, 1);
+}
+
+static int
+GL_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                int count)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
     GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+    SDL_DirtyRect *dirty;
     int minx, miny, maxx, maxy;
     GLfloat minu, maxu, minv, maxv;
+    int i;
 
-    if (texturedata->dirty.list) {
-        SDL_DirtyRect *dirty;
+    dirty = SDL_GetDirtyRects(&texturedata->dirty);
+    if (dirty) {
         void *pixels;
         int bpp = bytes_per_pixel(texture->format);
         int pitch = texturedata->pitch;
@@ -1142,7 +1233,7 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         SetupTextureUpdate(data, texture, pitch);
         data->glEnable(texturedata->type);
         data->glBindTexture(texturedata->type, texturedata->texture);
-        for (dirty = texturedata->dirty.list; dirty; dirty = dirty->next) {
+        for (; dirty; dirty = dirty->next) {
             SDL_Rect *rect = &dirty->rect;
             pixels =
                 (void *) ((Uint8 *) texturedata->pixels + rect->y * pitch +
@@ -1155,20 +1246,6 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         SDL_ClearDirtyRects(&texturedata->dirty);
     }
 
-    minx = dstrect->x;
-    miny = dstrect->y;
-    maxx = dstrect->x + dstrect->w;
-    maxy = dstrect->y + dstrect->h;
-
-    minu = (GLfloat) srcrect->x / texture->w;
-    minu *= texturedata->texw;
-    maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
-    maxu *= texturedata->texw;
-    minv = (GLfloat) srcrect->y / texture->h;
-    minv *= texturedata->texh;
-    maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
-    maxv *= texturedata->texh;
-
     data->glEnable(texturedata->type);
     data->glBindTexture(texturedata->type, texturedata->texture);
 
@@ -1208,15 +1285,35 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         data->glBindProgramARB(GL_FRAGMENT_PROGRAM_ARB, texturedata->shader);
     }
 
-    data->glBegin(GL_TRIANGLE_STRIP);
-    data->glTexCoord2f(minu, minv);
-    data->glVertex2i(minx, miny);
-    data->glTexCoord2f(maxu, minv);
-    data->glVertex2i(maxx, miny);
-    data->glTexCoord2f(minu, maxv);
-    data->glVertex2i(minx, maxy);
-    data->glTexCoord2f(maxu, maxv);
-    data->glVertex2i(maxx, maxy);
+    /* Submit all the copies as a single batch of quads */
+    data->glBegin(GL_QUADS);
+    for (i = 0; i < count; ++i) {
+        const SDL_Rect *srcrect = &srcrects[i];
+        const SDL_Rect *dstrect = &dstrects[i];
+
+        minx = dstrect->x;
+        miny = dstrect->y;
+        maxx = dstrect->x + dstrect->w;
+        maxy = dstrect->y + dstrect->h;
+
+        minu = (GLfloat) srcrect->x / texture->w;
+        minu *= texturedata->texw;
+        maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+        maxu *= texturedata->texw;
+        minv = (GLfloat) srcrect->y / texture->h;
+        minv *= texturedata->texh;
+        maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+        maxv *= texturedata->texh;
+
+        data->glTexCoord2f(minu, minv);
+        data->glVertex2i(minx, miny);
+        data->glTexCoord2f(maxu, minv);
+        data->glVertex2i(maxx, miny);
+        data->glTexCoord2f(maxu, maxv);
+        data->glVertex2i(maxx, maxy);
+        data->glTexCoord2f(minu, maxv);
+        data->glVertex2i(minx, maxy);
+    }
     data->glEnd();
 
     if (texturedata->shader != 0) {
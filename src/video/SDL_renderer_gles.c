@@ -93,6 +93,15 @@ static int GLES_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect);
 static int GLES_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                            const SDL_Rect * srcrect,
                            const SDL_Rect * dstrect);
+static int GLES_RenderPoints(SDL_Renderer * renderer,
+                             const SDL_Point * points, int count);
+static int GLES_RenderLines(SDL_Renderer * renderer,
+                            const SDL_Point * points, int count);
+static int GLES_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects,
+                            int count);
+static int GLES_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                             const SDL_Rect * srcrects,
+                             const SDL_Rect * dstrects, int count);
 static void GLES_RenderPresent(SDL_Renderer * renderer);
 static void GLES_DestroyTexture(SDL_Renderer * renderer,
                                 SDL_Texture * texture);
@@ -252,6 +261,10 @@ GLES_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderLine = GLES_RenderLine;
     renderer->RenderFill = GLES_RenderFill;
     renderer->RenderCopy = GLES_RenderCopy;
+    renderer->RenderPoints = GLES_RenderPoints;
+    renderer->RenderLines = GLES_RenderLines;
+    renderer->RenderFills = GLES_RenderFills;
+    renderer->RenderCopies = GLES_RenderCopies;
     renderer->RenderPresent = GLES_RenderPresent;
     renderer->DestroyTexture = GLES_DestroyTexture;
     renderer->DestroyRenderer = GLES_DestroyRenderer;
@@ -422,6 +435,7 @@ GLES_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
             SDL_free(data);
             return -1;
         }
+        SDL_SetDirtyRectBounds(&data->dirty, texture->w, texture->h);
     }
 
     texture->driverdata = data;
@@ -724,23 +738,160 @@ GLES_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect)
     return 0;
 }
 
+static int
+GLES_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points,
+                  int count)
+{
+    GLES_RenderData *data = (GLES_RenderData *) renderer->driverdata;
+    GLshort *vertices;
+    int i;
+
+    vertices = (GLshort *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * 2 * sizeof(GLshort));
+    if (!vertices) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        vertices[2 * i] = points[i].x;
+        vertices[2 * i + 1] = points[i].y;
+    }
+
+    GLES_SetBlendMode(data, renderer->blendMode);
+
+    data->glColor4f((GLfloat) renderer->r * inv255f,
+                    (GLfloat) renderer->g * inv255f,
+                    (GLfloat) renderer->b * inv255f,
+                    (GLfloat) renderer->a * inv255f);
+
+    data->glVertexPointer(2, GL_SHORT, 0, vertices);
+    data->glEnableClientState(GL_VERTEX_ARRAY);
+    data->glDrawArrays(GL_POINTS, 0, count);
+    data->glDisableClientState(GL_VERTEX_ARRAY);
+
+    data->glDisable(GL_BLEND);
+
+    return 0;
+}
+
+static int
+GLES_RenderLines(SDL_Renderer * renderer, const SDL_Point * points,
+                 int count)
+{
+    GLES_RenderData *data = (GLES_RenderData *) renderer->driverdata;
+    GLshort *vertices;
+    int i;
+
+    vertices = (GLshort *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * 4 * sizeof(GLshort));
+    if (!vertices) {
+        return -1;
+    }
+    for (i = 0; i < 2 * count; ++i) {
+        vertices[2 * i] = points[i].x;
+        vertices[2 * i + 1] = points[i].y;
+    }
+
+    GLES_SetBlendMode(data, renderer->blendMode);
+
+    data->glColor4f((GLfloat) renderer->r * inv255f,
+                    (GLfloat) renderer->g * inv255f,
+                    (GLfloat) renderer->b * inv255f,
+                    (GLfloat) renderer->a * inv255f);
+
+    data->glVertexPointer(2, GL_SHORT, 0, vertices);
+    data->glEnableClientState(GL_VERTEX_ARRAY);
+    data->glDrawArrays(GL_LINES, 0, 2 * count);
+    data->glDisableClientState(GL_VERTEX_ARRAY);
+
+    data->glDisable(GL_BLEND);
+
+    return 0;
+}
+
+static int
+GLES_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects, int count)
+{
+    GLES_RenderData *data = (GLES_RenderData *) renderer->driverdata;
+    GLshort *vertices;
+    GLshort minx, maxx, miny, maxy;
+    int i;
+
+    vertices = (GLshort *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * 12 * sizeof(GLshort));
+    if (!vertices) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        GLshort *v = &vertices[i * 12];
+
+        minx = rects[i].x;
+        maxx = rects[i].x + rects[i].w;
+        miny = rects[i].y;
+        maxy = rects[i].y + rects[i].h;
+
+        v[0] = minx;
+        v[1] = miny;
+        v[2] = maxx;
+        v[3] = miny;
+        v[4] = minx;
+        v[5] = maxy;
+        v[6] = maxx;
+        v[7] = miny;
+        v[8] = minx;
+        v[9] = maxy;
+        v[10] = maxx;
+        v[11] = maxy;
+    }
+
+    GLES_SetBlendMode(data, renderer->blendMode);
+
+    data->glColor4f((GLfloat) renderer->r * inv255f,
+                    (GLfloat) renderer->g * inv255f,
+                    (GLfloat) renderer->b * inv255f,
+                    (GLfloat) renderer->a * inv255f);
+
+    data->glVertexPointer(2, GL_SHORT, 0, vertices);
+    data->glEnableClientState(GL_VERTEX_ARRAY);
+    data->glDrawArrays(GL_TRIANGLES, 0, count * 6);
+    data->glDisableClientState(GL_VERTEX_ARRAY);
+
+    data->glDisable(GL_BLEND);
+
+    return 0;
+}
+
 static int
 GLES_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                 const SDL_Rect * srcrect, const SDL_Rect * dstrect)
 {
+    return GLES_RenderCopies(renderer, texture, srcrect, dstrect, 1);
+}
+
+static int
+GLES_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                  int count)
+{
 
     GLES_RenderData *data = (GLES_RenderData *) renderer->driverdata;
     GLES_TextureData *texturedata = (GLES_TextureData *) texture->driverdata;
+    SDL_DirtyRect *dirty;
     int minx, miny, maxx, maxy;
     GLfloat minu, maxu, minv, maxv;
-    int i;
+    int i, n;
     void *temp_buffer;          /* used for reformatting dirty rect pixels */
     void *temp_ptr;
 
     data->glEnable(GL_TEXTURE_2D);
 
-    if (texturedata->dirty.list) {
-        SDL_DirtyRect *dirty;
+    dirty = SDL_GetDirtyRects(&texturedata->dirty);
+    if (dirty) {
         void *pixels;
         int bpp = SDL_BYTESPERPIXEL(texture->format);
         int pitch = texturedata->pitch;
@@ -748,7 +899,7 @@ GLES_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         SetupTextureUpdate(data, texture, pitch);
 
         data->glBindTexture(texturedata->type, texturedata->texture);
-        for (dirty = texturedata->dirty.list; dirty; dirty = dirty->next) {
+        for (; dirty; dirty = dirty->next) {
             SDL_Rect *rect = &dirty->rect;
             pixels =
                 (void *) ((Uint8 *) texturedata->pixels + rect->y * pitch +
@@ -811,56 +962,93 @@ GLES_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         /* this code is a little funny because the viewport is upside down vs SDL's coordinate system */
         SDL_Window *window = SDL_GetWindowFromID(renderer->window);
         GLint cropRect[4];
-        cropRect[0] = srcrect->x;
-        cropRect[1] = srcrect->y + srcrect->h;
-        cropRect[2] = srcrect->w;
-        cropRect[3] = -srcrect->h;
-        data->glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_CROP_RECT_OES,
-                               cropRect);
-        data->glDrawTexiOES(dstrect->x, window->h - dstrect->y - dstrect->h,
-                            0, dstrect->w, dstrect->h);
+
+        for (n = 0; n < count; ++n) {
+            const SDL_Rect *srcrect = &srcrects[n];
+            const SDL_Rect *dstrect = &dstrects[n];
+
+            cropRect[0] = srcrect->x;
+            cropRect[1] = srcrect->y + srcrect->h;
+            cropRect[2] = srcrect->w;
+            cropRect[3] = -srcrect->h;
+            data->glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_CROP_RECT_OES,
+                                   cropRect);
+            data->glDrawTexiOES(dstrect->x,
+                                window->h - dstrect->y - dstrect->h, 0,
+                                dstrect->w, dstrect->h);
+        }
     } else {
+        GLshort stack_vertices[12];
+        GLfloat stack_texCoords[12];
+        GLshort *vertices = stack_vertices;
+        GLfloat *texCoords = stack_texCoords;
+
+        /* Draw the whole batch as independent triangles in one call */
+        if (count > 1) {
+            texCoords = (GLfloat *)
+                SDL_GetBatchBuffer(&renderer->batch_scratch,
+                                   &renderer->batch_scratch_size,
+                                   count * 12 * (sizeof(GLfloat) +
+                                                 sizeof(GLshort)));
+            if (!texCoords) {
+                data->glDisable(GL_TEXTURE_2D);
+                return -1;
+            }
+            vertices = (GLshort *) (texCoords + count * 12);
+        }
 
-        minx = dstrect->x;
-        miny = dstrect->y;
-        maxx = dstrect->x + dstrect->w;
-        maxy = dstrect->y + dstrect->h;
-
-        minu = (GLfloat) srcrect->x / texture->w;
-        minu *= texturedata->texw;
-        maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
-        maxu *= texturedata->texw;
-        minv = (GLfloat) srcrect->y / texture->h;
-        minv *= texturedata->texh;
-        maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
-        maxv *= texturedata->texh;
-
-        GLshort vertices[8];
-        GLfloat texCoords[8];
-
-        vertices[0] = minx;
-        vertices[1] = miny;
-        vertices[2] = maxx;
-        vertices[3] = miny;
-        vertices[4] = minx;
-        vertices[5] = maxy;
-        vertices[6] = maxx;
-        vertices[7] = maxy;
-
-        texCoords[0] = minu;
-        texCoords[1] = minv;
-        texCoords[2] = maxu;
-        texCoords[3] = minv;
-        texCoords[4] = minu;
-        texCoords[5] = maxv;
-        texCoords[6] = maxu;
-        texCoords[7] = maxv;
+        for (n = 0; n < count; ++n) {
+            const SDL_Rect *srcrect = &srcrects[n];
+            const SDL_Rect *dstrect = &dstrects[n];
+            GLshort *v = &vertices[n * 12];
+            GLfloat *t = &texCoords[n * 12];
+
+            minx = dstrect->x;
+            miny = dstrect->y;
+            maxx = dstrect->x + dstrect->w;
+            maxy = dstrect->y + dstrect->h;
+
+            minu = (GLfloat) srcrect->x / texture->w;
+            minu *= texturedata->texw;
+            maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+            maxu *= texturedata->texw;
+            minv = (GLfloat) srcrect->y / texture->h;
+            minv *= texturedata->texh;
+            maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+            maxv *= texturedata->texh;
+
+            v[0] = minx;
+            v[1] = miny;
+            v[2] = maxx;
+            v[3] = miny;
+            v[4] = minx;
+            v[5] = maxy;
+            v[6] = maxx;
+            v[7] = miny;
+            v[8] = minx;
+            v[9] = maxy;
+            v[10] = maxx;
+            v[11] = maxy;
+
+            t[0] = minu;
+            t[1] = minv;
+            t[2] = maxu;
+            t[3] = minv;
+            t[4] = minu;
+            t[5] = maxv;
+            t[6] = maxu;
+            t[7] = minv;
+            t[8] = minu;
+            t[9] = maxv;
+            t[10] = maxu;
+            t[11] = maxv;
+        }
 
         data->glVertexPointer(2, GL_SHORT, 0, vertices);
         data->glEnableClientState(GL_VERTEX_ARRAY);
         data->glTexCoordPointer(2, GL_FLOAT, 0, texCoords);
         data->glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        data->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        data->glDrawArrays(GL_TRIANGLES, 0, count * 6);
         data->glDisableClientState(GL_TEXTURE_COORD_ARRAY);
         data->glDisableClientState(GL_VERTEX_ARRAY);
     }
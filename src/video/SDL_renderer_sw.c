@@ -59,12 +59,22 @@ static int SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * rect, int markDirty, void **pixels,
                           int *pitch);
 static void SW_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture);
+static int SW_BeginDrawing(SDL_Renderer * renderer);
 static int SW_RenderPoint(SDL_Renderer * renderer, int x, int y);
 static int SW_RenderLine(SDL_Renderer * renderer, int x1, int y1, int x2,
                          int y2);
 static int SW_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect);
 static int SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_Rect * dstrect);
+static int SW_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points,
+                           int count);
+static int SW_RenderLines(SDL_Renderer * renderer, const SDL_Point * points,
+                          int count);
+static int SW_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects,
+                          int count);
+static int SW_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                           const SDL_Rect * srcrects,
+                           const SDL_Rect * dstrects, int count);
 static void SW_RenderPresent(SDL_Renderer * renderer);
 static void SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture);
 static void SW_DestroyRenderer(SDL_Renderer * renderer);
@@ -81,8 +91,9 @@ SDL_RenderDriver SW_RenderDriver = {
       SDL_TEXTUREMODULATE_ALPHA),
      (SDL_BLENDMODE_NONE | SDL_BLENDMODE_MASK |
       SDL_BLENDMODE_BLEND | SDL_BLENDMODE_ADD | SDL_BLENDMODE_MOD),
-     (SDL_TEXTURESCALEMODE_NONE | SDL_TEXTURESCALEMODE_FAST),
-     14,
+     (SDL_TEXTURESCALEMODE_NONE | SDL_TEXTURESCALEMODE_FAST |
+      SDL_TEXTURESCALEMODE_SLOW),
+     16,
      {
       SDL_PIXELFORMAT_INDEX8,
       SDL_PIXELFORMAT_RGB555,
@@ -97,7 +108,9 @@ SDL_RenderDriver SW_RenderDriver = {
       SDL_PIXELFORMAT_IYUV,
       SDL_PIXELFORMAT_YUY2,
       SDL_PIXELFORMAT_UYVY,
-      SDL_PIXELFORMAT_YVYU},
+      SDL_PIXELFORMAT_YVYU,
+      SDL_PIXELFORMAT_NV12,
+      SDL_PIXELFORMAT_NV21},
      0,
      0}
 };
@@ -111,6 +124,13 @@ typedef struct
     SDL_Surface surface;
     SDL_Renderer *renderer;
     SDL_DirtyRectList dirty;
+    SDL_bool drawn;             /* The back buffer changed this frame */
+
+    /* A texture copied 1:1 and nothing else, shown without the back buffer */
+    SDL_Texture *shown;
+    SDL_Rect *shown_rects;
+    int shown_count;
+    int shown_max;
 } SW_RenderData;
 
 static SDL_Texture *
@@ -128,6 +148,10 @@ CreateTexture(SDL_Renderer * renderer, Uint32 format, int w, int h)
     texture->access = SDL_TEXTUREACCESS_STREAMING;
     texture->w = w;
     texture->h = h;
+    texture->r = 255;
+    texture->g = 255;
+    texture->b = 255;
+    texture->a = 255;
     texture->renderer = renderer;
 
     if (renderer->CreateTexture(renderer, texture) < 0) {
@@ -228,6 +252,10 @@ SW_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderLine = SW_RenderLine;
     renderer->RenderFill = SW_RenderFill;
     renderer->RenderCopy = SW_RenderCopy;
+    renderer->RenderPoints = SW_RenderPoints;
+    renderer->RenderLines = SW_RenderLines;
+    renderer->RenderFills = SW_RenderFills;
+    renderer->RenderCopies = SW_RenderCopies;
     renderer->RenderPresent = SW_RenderPresent;
     renderer->DestroyRenderer = SW_DestroyRenderer;
     renderer->info.name = SW_RenderDriver.info.name;
@@ -246,6 +274,9 @@ SW_CreateRenderer(SDL_Window * window, Uint32 flags)
         renderer->info.flags |= SDL_RENDERER_PRESENTCOPY;
         n = 1;
     }
+    if (flags & SDL_RENDERER_PRESENTDISCARD) {
+        renderer->info.flags |= SDL_RENDERER_PRESENTDISCARD;
+    }
     data->format = displayMode->format;
 
     /* Find a render driver that we can use to display data */
@@ -288,6 +319,7 @@ SW_CreateRenderer(SDL_Window * window, Uint32 flags)
         }
     }
     data->current_texture = 0;
+    SDL_SetDirtyRectBounds(&data->dirty, window->w, window->h);
 
     /* Create a surface we'll use for rendering */
     data->surface.flags = SDL_PREALLOC;
@@ -341,6 +373,7 @@ SW_ActivateRenderer(SDL_Renderer * renderer)
                 return -1;
             }
         }
+        SDL_SetDirtyRectBounds(&data->dirty, window->w, window->h);
         data->updateSize = SDL_FALSE;
     }
     return 0;
@@ -361,6 +394,49 @@ SW_DisplayModeChanged(SDL_Renderer * renderer)
     return SW_ActivateRenderer(renderer);
 }
 
+/* Streaming textures in the display format keep their pixels in a texture
+   of the display renderer, so that frames which are just a copy of one can
+   be presented from it directly.  The display texture is kept in the
+   surface userdata, and every write goes through its renderer's lock, so
+   renderers which upload what was locked (OpenGL) see the changes.
+ */
+static SDL_Surface *
+SW_CreateDisplaySurface(SDL_Renderer * renderer, SDL_Texture * texture,
+                        int bpp, Uint32 Rmask, Uint32 Gmask, Uint32 Bmask,
+                        Uint32 Amask)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Texture *display;
+    SDL_Surface *surface;
+    void *pixels;
+    int pitch;
+
+    if (texture->access != SDL_TEXTUREACCESS_STREAMING ||
+        texture->format != data->format ||
+        SDL_ISPIXELFORMAT_INDEXED(texture->format) ||
+        !data->renderer->QueryTexturePixels) {
+        return NULL;
+    }
+    display = CreateTexture(data->renderer, texture->format, texture->w,
+                            texture->h);
+    if (!display) {
+        return NULL;
+    }
+    if (data->renderer->QueryTexturePixels(data->renderer, display, &pixels,
+                                           &pitch) < 0) {
+        DestroyTexture(data->renderer, display);
+        return NULL;
+    }
+    surface = SDL_CreateRGBSurfaceFrom(pixels, texture->w, texture->h, bpp,
+                                       pitch, Rmask, Gmask, Bmask, Amask);
+    if (!surface) {
+        DestroyTexture(data->renderer, display);
+        return NULL;
+    }
+    surface->userdata = display;
+    return surface;
+}
+
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
@@ -377,9 +453,19 @@ SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
             return -1;
         }
 
-        texture->driverdata =
-            SDL_CreateRGBSurface(0, texture->w, texture->h, bpp, Rmask, Gmask,
-                                 Bmask, Amask);
+        if (renderer->info.name == SW_RenderDriver.info.name) {
+            texture->driverdata =
+                SW_CreateDisplaySurface(renderer, texture, bpp, Rmask, Gmask,
+                                        Bmask, Amask);
+        }
+        if (!texture->driverdata) {
+            texture->driverdata =
+                SDL_CreateRGBSurface(0, texture->w, texture->h, bpp, Rmask,
+                                     Gmask, Bmask, Amask);
+        }
+        if (!texture->driverdata) {
+            return -1;
+        }
         SDL_SetSurfaceColorMod(texture->driverdata, texture->r, texture->g,
                                texture->b);
         SDL_SetSurfaceAlphaMod(texture->driverdata, texture->a);
@@ -474,6 +560,21 @@ SW_SetTextureScaleMode(SDL_Renderer * renderer, SDL_Texture * texture)
     return SDL_SetSurfaceScaleMode(surface, texture->scaleMode);
 }
 
+/* Whether the texture is waiting to be presented directly, in which case
+   it has to reach the back buffer before its pixels change.
+ */
+static SDL_bool
+SW_IsShown(SDL_Renderer * renderer, SDL_Texture * texture)
+{
+    SW_RenderData *data;
+
+    if (renderer->info.name != SW_RenderDriver.info.name) {
+        return SDL_FALSE;
+    }
+    data = (SW_RenderData *) renderer->driverdata;
+    return (data->shown == texture);
+}
+
 static int
 SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                  const SDL_Rect * rect, const void *pixels, int pitch)
@@ -485,18 +586,30 @@ SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
     } else {
         SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
         Uint8 *src, *dst;
-        int row;
+        int row, dstpitch;
         size_t length;
 
+        if (surface->userdata) {
+            if (SW_LockTexture(renderer, texture, rect, 1, (void **) &dst,
+                               &dstpitch) < 0) {
+                return -1;
+            }
+        } else {
+            dst =
+                (Uint8 *) surface->pixels + rect->y * surface->pitch +
+                rect->x * surface->format->BytesPerPixel;
+            dstpitch = surface->pitch;
+        }
+
         src = (Uint8 *) pixels;
-        dst =
-            (Uint8 *) surface->pixels + rect->y * surface->pitch +
-            rect->x * surface->format->BytesPerPixel;
         length = rect->w * surface->format->BytesPerPixel;
         for (row = 0; row < rect->h; ++row) {
             SDL_memcpy(dst, src, length);
             src += pitch;
-            dst += surface->pitch;
+            dst += dstpitch;
+        }
+        if (surface->userdata) {
+            SW_UnlockTexture(renderer, texture);
         }
         return 0;
     }
@@ -514,6 +627,20 @@ SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
     } else {
         SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
+        if (surface->userdata) {
+            SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+
+            if (SW_IsShown(renderer, texture) &&
+                SW_BeginDrawing(renderer) < 0) {
+                return -1;
+            }
+            /* Always dirty, there's no way to mark it dirty later */
+            return data->renderer->LockTexture(data->renderer,
+                                               (SDL_Texture *)
+                                               surface->userdata, rect, 1,
+                                               pixels, pitch);
+        }
+
         *pixels =
             (void *) ((Uint8 *) surface->pixels + rect->y * surface->pitch +
                       rect->x * surface->format->BytesPerPixel);
@@ -527,9 +654,115 @@ SW_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
         SDL_SW_UnlockYUVTexture((SDL_SW_YUVTexture *) texture->driverdata);
+    } else {
+        SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+
+        if (surface->userdata) {
+            SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+
+            data->renderer->UnlockTexture(data->renderer,
+                                          (SDL_Texture *) surface->userdata);
+        }
     }
 }
 
+/* Copy a texture to the back buffer */
+static int
+SW_CopyToBackBuffer(SDL_Renderer * renderer, SDL_Texture * texture,
+                    const SDL_Rect * srcrect, const SDL_Rect * dstrect)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    int status;
+
+    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
+        SDL_AddDirtyRect(&data->dirty, dstrect);
+    }
+
+    if (data->renderer->LockTexture(data->renderer,
+                                    data->texture[data->current_texture],
+                                    dstrect, 1, &data->surface.pixels,
+                                    &data->surface.pitch) < 0) {
+        return -1;
+    }
+
+    if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
+        status =
+            SDL_SW_CopyYUVToRGB((SDL_SW_YUVTexture *) texture->driverdata,
+                                srcrect, data->format, dstrect->w, dstrect->h,
+                                data->surface.pixels, data->surface.pitch);
+    } else {
+        SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+        SDL_Rect real_srcrect = *srcrect;
+        SDL_Rect real_dstrect;
+
+        data->surface.w = dstrect->w;
+        data->surface.h = dstrect->h;
+        data->surface.clip_rect.w = dstrect->w;
+        data->surface.clip_rect.h = dstrect->h;
+        real_dstrect = data->surface.clip_rect;
+
+        status =
+            SDL_LowerBlit(surface, &real_srcrect, &data->surface,
+                          &real_dstrect);
+    }
+    data->renderer->UnlockTexture(data->renderer,
+                                  data->texture[data->current_texture]);
+    return status;
+}
+
+/* Anything drawn to the back buffer means the texture being shown has to
+   be copied there first, as it would have been without the shortcut.
+ */
+static int
+SW_BeginDrawing(SDL_Renderer * renderer)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Texture *texture = data->shown;
+    int i, status = 0;
+
+    data->shown = NULL;
+    for (i = 0; texture && i < data->shown_count && status == 0; ++i) {
+        status =
+            SW_CopyToBackBuffer(renderer, texture, &data->shown_rects[i],
+                                &data->shown_rects[i]);
+    }
+    data->shown_count = 0;
+    data->drawn = SDL_TRUE;
+    return status;
+}
+
+/* A frame can be presented straight from a texture when all it does is
+   copy parts of one with a display texture to the same place in the
+   window.  The back buffer isn't updated then, so the renderer has to
+   have been created with SDL_RENDERER_PRESENTDISCARD.
+ */
+static SDL_bool
+SW_CanShowTexture(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Rect * srcrect, const SDL_Rect * dstrect)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Surface *surface;
+
+    if (!(renderer->info.flags & SDL_RENDERER_PRESENTDISCARD) ||
+        !(data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY)) {
+        return SDL_FALSE;
+    }
+    if (data->drawn || (data->shown && data->shown != texture)) {
+        return SDL_FALSE;
+    }
+    if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
+        return SDL_FALSE;
+    }
+    surface = (SDL_Surface *) texture->driverdata;
+    if (!surface->userdata ||
+        texture->modMode != SDL_TEXTUREMODULATE_NONE ||
+        texture->blendMode != SDL_BLENDMODE_NONE) {
+        return SDL_FALSE;
+    }
+    return (srcrect->x == dstrect->x && srcrect->y == dstrect->y &&
+            srcrect->w == dstrect->w && srcrect->h == dstrect->h);
+}
+
 static int
 SW_RenderPoint(SDL_Renderer * renderer, int x, int y)
 {
@@ -542,6 +775,10 @@ SW_RenderPoint(SDL_Renderer * renderer, int x, int y)
     rect.w = 1;
     rect.h = 1;
 
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
     if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
         SDL_AddDirtyRect(&data->dirty, &rect);
     }
@@ -608,6 +845,10 @@ SW_RenderLine(SDL_Renderer * renderer, int x1, int y1, int x2, int y2)
         y2 = 0;
     }
 
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
     if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
         SDL_AddDirtyRect(&data->dirty, &rect);
     }
@@ -650,6 +891,10 @@ SW_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect)
     SDL_Rect real_rect;
     int status;
 
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
     if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
         SDL_AddDirtyRect(&data->dirty, rect);
     }
@@ -689,40 +934,270 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
               const SDL_Rect * srcrect, const SDL_Rect * dstrect)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
-    SDL_Window *window = SDL_GetWindowFromID(renderer->window);
-    int status;
 
-    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
-        SDL_AddDirtyRect(&data->dirty, dstrect);
+    if (SW_CanShowTexture(renderer, texture, srcrect, dstrect)) {
+        if (data->shown_count == data->shown_max) {
+            int max = data->shown_max ? 2 * data->shown_max : 16;
+            SDL_Rect *rects = (SDL_Rect *)
+                SDL_realloc(data->shown_rects, max * sizeof(*rects));
+            if (rects) {
+                data->shown_rects = rects;
+                data->shown_max = max;
+            }
+        }
+        if (data->shown_count < data->shown_max) {
+            data->shown = texture;
+            data->shown_rects[data->shown_count++] = *dstrect;
+            return 0;
+        }
     }
 
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+    return SW_CopyToBackBuffer(renderer, texture, srcrect, dstrect);
+}
+
+/* Lock the area of the render target covered by a batch of primitives.
+   The primitives are drawn relative to the top left corner of 'rect'.
+ */
+static int
+SW_LockBatchArea(SW_RenderData * data, const SDL_Rect * rect)
+{
     if (data->renderer->LockTexture(data->renderer,
                                     data->texture[data->current_texture],
-                                    dstrect, 1, &data->surface.pixels,
+                                    rect, 1, &data->surface.pixels,
                                     &data->surface.pitch) < 0) {
         return -1;
     }
 
-    if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
-        status =
-            SDL_SW_CopyYUVToRGB((SDL_SW_YUVTexture *) texture->driverdata,
-                                srcrect, data->format, dstrect->w, dstrect->h,
-                                data->surface.pixels, data->surface.pitch);
+    data->surface.w = rect->w;
+    data->surface.h = rect->h;
+    data->surface.clip_rect.w = rect->w;
+    data->surface.clip_rect.h = rect->h;
+    return 0;
+}
+
+static int
+SW_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points, int count)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Point *temp;
+    SDL_Rect rect;
+    int i, status;
+
+    if (!SDL_EnclosePoints(points, count, NULL, &rect)) {
+        return 0;
+    }
+
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
+    /* Individual points make poor dirty rects, use the bounding box */
+    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
+        SDL_AddDirtyRect(&data->dirty, &rect);
+    }
+
+    temp = (SDL_Point *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * sizeof(*temp));
+    if (!temp) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        temp[i].x = points[i].x - rect.x;
+        temp[i].y = points[i].y - rect.y;
+    }
+
+    if (SW_LockBatchArea(data, &rect) < 0) {
+        return -1;
+    }
+
+    if (renderer->blendMode == SDL_BLENDMODE_NONE ||
+        renderer->blendMode == SDL_BLENDMODE_MASK) {
+        Uint32 color =
+            SDL_MapRGBA(data->surface.format, renderer->r, renderer->g,
+                        renderer->b, renderer->a);
+
+        status = SDL_DrawPoints(&data->surface, temp, count, color);
     } else {
-        SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
-        SDL_Rect real_srcrect = *srcrect;
+        status =
+            SDL_BlendPoints(&data->surface, temp, count, renderer->blendMode,
+                            renderer->r, renderer->g, renderer->b,
+                            renderer->a);
+    }
+
+    data->renderer->UnlockTexture(data->renderer,
+                                  data->texture[data->current_texture]);
+    return status;
+}
+
+static int
+SW_RenderLines(SDL_Renderer * renderer, const SDL_Point * points, int count)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Rect rect;
+    Uint32 color = 0;
+    int i, x1, y1, x2, y2;
+    int status = 0;
+
+    if (!SDL_EnclosePoints(points, 2 * count, NULL, &rect)) {
+        return 0;
+    }
+
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
+    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
+        SDL_AddDirtyRect(&data->dirty, &rect);
+    }
+
+    if (SW_LockBatchArea(data, &rect) < 0) {
+        return -1;
+    }
+
+    if (renderer->blendMode == SDL_BLENDMODE_NONE ||
+        renderer->blendMode == SDL_BLENDMODE_MASK) {
+        color = SDL_MapRGBA(data->surface.format, renderer->r, renderer->g,
+                            renderer->b, renderer->a);
+    }
+    for (i = 0; i < count && status == 0; ++i) {
+        x1 = points[2 * i].x - rect.x;
+        y1 = points[2 * i].y - rect.y;
+        x2 = points[2 * i + 1].x - rect.x;
+        y2 = points[2 * i + 1].y - rect.y;
+
+        if (renderer->blendMode == SDL_BLENDMODE_NONE ||
+            renderer->blendMode == SDL_BLENDMODE_MASK) {
+            status = SDL_DrawLine(&data->surface, x1, y1, x2, y2, color);
+        } else {
+            status =
+                SDL_BlendLine(&data->surface, x1, y1, x2, y2,
+                              renderer->blendMode, renderer->r, renderer->g,
+                              renderer->b, renderer->a);
+        }
+    }
+
+    data->renderer->UnlockTexture(data->renderer,
+                                  data->texture[data->current_texture]);
+    return status;
+}
+
+static int
+SW_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects, int count)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Rect rect;
+    SDL_Rect real_rect;
+    Uint32 color = 0;
+    int i;
+    int status = 0;
+
+    rect = rects[0];
+    for (i = 1; i < count; ++i) {
+        SDL_UnionRect(&rect, &rects[i], &rect);
+    }
+
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
+    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
+        for (i = 0; i < count; ++i) {
+            SDL_AddDirtyRect(&data->dirty, &rects[i]);
+        }
+    }
+
+    if (SW_LockBatchArea(data, &rect) < 0) {
+        return -1;
+    }
+
+    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
+        color = SDL_MapRGBA(data->surface.format, renderer->r, renderer->g,
+                            renderer->b, renderer->a);
+    }
+    for (i = 0; i < count && status == 0; ++i) {
+        real_rect.x = rects[i].x - rect.x;
+        real_rect.y = rects[i].y - rect.y;
+        real_rect.w = rects[i].w;
+        real_rect.h = rects[i].h;
+
+        if (renderer->blendMode == SDL_BLENDMODE_NONE) {
+            status = SDL_FillRect(&data->surface, &real_rect, color);
+        } else {
+            status =
+                SDL_BlendRect(&data->surface, &real_rect, renderer->blendMode,
+                              renderer->r, renderer->g, renderer->b,
+                              renderer->a);
+        }
+    }
+
+    data->renderer->UnlockTexture(data->renderer,
+                                  data->texture[data->current_texture]);
+    return status;
+}
+
+static int
+SW_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                int count)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SDL_Rect rect;
+    int i;
+    int status = 0;
+
+    rect = dstrects[0];
+    for (i = 1; i < count; ++i) {
+        SDL_UnionRect(&rect, &dstrects[i], &rect);
+    }
+
+    if (SW_BeginDrawing(renderer) < 0) {
+        return -1;
+    }
+
+    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
+        for (i = 0; i < count; ++i) {
+            SDL_AddDirtyRect(&data->dirty, &dstrects[i]);
+        }
+    }
+
+    if (SW_LockBatchArea(data, &rect) < 0) {
+        return -1;
+    }
+
+    for (i = 0; i < count && status == 0; ++i) {
+        SDL_Rect real_srcrect = srcrects[i];
         SDL_Rect real_dstrect;
 
-        data->surface.w = dstrect->w;
-        data->surface.h = dstrect->h;
-        data->surface.clip_rect.w = dstrect->w;
-        data->surface.clip_rect.h = dstrect->h;
-        real_dstrect = data->surface.clip_rect;
+        real_dstrect.x = dstrects[i].x - rect.x;
+        real_dstrect.y = dstrects[i].y - rect.y;
+        real_dstrect.w = dstrects[i].w;
+        real_dstrect.h = dstrects[i].h;
+
+        if (SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
+            void *pixels =
+                (Uint8 *) data->surface.pixels +
+                real_dstrect.y * data->surface.pitch +
+                real_dstrect.x * data->surface.format->BytesPerPixel;
+
+            status =
+                SDL_SW_CopyYUVToRGB((SDL_SW_YUVTexture *) texture->driverdata,
+                                    &real_srcrect, data->format,
+                                    real_dstrect.w, real_dstrect.h, pixels,
+                                    data->surface.pitch);
+        } else {
+            SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
-        status =
-            SDL_LowerBlit(surface, &real_srcrect, &data->surface,
-                          &real_dstrect);
+            status =
+                SDL_LowerBlit(surface, &real_srcrect, &data->surface,
+                              &real_dstrect);
+        }
     }
+
     data->renderer->UnlockTexture(data->renderer,
                                   data->texture[data->current_texture]);
     return status;
@@ -735,9 +1210,22 @@ SW_RenderPresent(SDL_Renderer * renderer)
     SDL_Texture *texture = data->texture[data->current_texture];
 
     /* Send the data to the display */
-    if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
+    if (data->shown) {
+        SDL_Surface *surface = (SDL_Surface *) data->shown->driverdata;
+        int i;
+
+        for (i = 0; i < data->shown_count; ++i) {
+            data->renderer->RenderCopy(data->renderer,
+                                       (SDL_Texture *) surface->userdata,
+                                       &data->shown_rects[i],
+                                       &data->shown_rects[i]);
+        }
+        data->shown = NULL;
+        data->shown_count = 0;
+    } else if (data->renderer->info.flags & SDL_RENDERER_PRESENTCOPY) {
         SDL_DirtyRect *dirty;
-        for (dirty = data->dirty.list; dirty; dirty = dirty->next) {
+        for (dirty = SDL_GetDirtyRects(&data->dirty); dirty;
+             dirty = dirty->next) {
             data->renderer->RenderCopy(data->renderer, texture, &dirty->rect,
                                        &dirty->rect);
         }
@@ -751,6 +1239,7 @@ SW_RenderPresent(SDL_Renderer * renderer)
         data->renderer->RenderCopy(data->renderer, texture, &rect, &rect);
     }
     data->renderer->RenderPresent(data->renderer);
+    data->drawn = SDL_FALSE;
 
     /* Update the flipping chain, if any */
     if (renderer->info.flags & SDL_RENDERER_PRESENTFLIP2) {
@@ -768,6 +1257,16 @@ SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
     } else {
         SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
+        if (surface->userdata) {
+            if (SW_IsShown(renderer, texture)) {
+                SW_BeginDrawing(renderer);
+            }
+            if (renderer->info.name == SW_RenderDriver.info.name) {
+                SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+                DestroyTexture(data->renderer,
+                               (SDL_Texture *) surface->userdata);
+            }
+        }
         SDL_FreeSurface(surface);
     }
 }
@@ -798,6 +1297,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
             data->renderer->DestroyRenderer(data->renderer);
         }
         SDL_FreeDirtyRects(&data->dirty);
+        if (data->shown_rects) {
+            SDL_free(data->shown_rects);
+        }
         SDL_free(data);
     }
     SDL_free(renderer);
@@ -29,6 +29,7 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_blit_linear.h"
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -169,83 +170,97 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
     }
 }
 
-/* Perform a stretch blit between two surfaces of the same format.
-   NOTE:  This function is not safe to call from multiple threads!
-*/
-int
-SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
-                SDL_Surface * dst, const SDL_Rect * dstrect)
+/* Verify the blit rectangles, filling in the full surfaces for NULL
+   ones, and lock the surfaces if they're in hardware. */
+static int
+SDL_PrepareStretch(SDL_Surface * src, const SDL_Rect ** srcrect,
+                   SDL_Rect * full_src, SDL_Surface * dst,
+                   const SDL_Rect ** dstrect, SDL_Rect * full_dst,
+                   int *src_locked, int *dst_locked)
 {
-    int src_locked;
-    int dst_locked;
-    int pos, inc;
-    int dst_width;
-    int dst_maxrow;
-    int src_row, dst_row;
-    Uint8 *srcp = NULL;
-    Uint8 *dstp;
-    SDL_Rect full_src;
-    SDL_Rect full_dst;
-#if defined(USE_ASM_STRETCH) && defined(__GNUC__)
-    int u1, u2;
-#endif
-    const int bpp = dst->format->BytesPerPixel;
-
-    if (src->format->BitsPerPixel != dst->format->BitsPerPixel) {
-        SDL_SetError("Only works with same format surfaces");
-        return (-1);
-    }
-
-    /* Verify the blit rectangles */
-    if (srcrect) {
-        if ((srcrect->x < 0) || (srcrect->y < 0) ||
-            ((srcrect->x + srcrect->w) > src->w) ||
-            ((srcrect->y + srcrect->h) > src->h)) {
+    if (*srcrect) {
+        if (((*srcrect)->x < 0) || ((*srcrect)->y < 0) ||
+            (((*srcrect)->x + (*srcrect)->w) > src->w) ||
+            (((*srcrect)->y + (*srcrect)->h) > src->h)) {
             SDL_SetError("Invalid source blit rectangle");
             return (-1);
         }
     } else {
-        full_src.x = 0;
-        full_src.y = 0;
-        full_src.w = src->w;
-        full_src.h = src->h;
-        srcrect = &full_src;
+        full_src->x = 0;
+        full_src->y = 0;
+        full_src->w = src->w;
+        full_src->h = src->h;
+        *srcrect = full_src;
     }
-    if (dstrect) {
-        if ((dstrect->x < 0) || (dstrect->y < 0) ||
-            ((dstrect->x + dstrect->w) > dst->w) ||
-            ((dstrect->y + dstrect->h) > dst->h)) {
+    if (*dstrect) {
+        if (((*dstrect)->x < 0) || ((*dstrect)->y < 0) ||
+            (((*dstrect)->x + (*dstrect)->w) > dst->w) ||
+            (((*dstrect)->y + (*dstrect)->h) > dst->h)) {
             SDL_SetError("Invalid destination blit rectangle");
             return (-1);
         }
     } else {
-        full_dst.x = 0;
-        full_dst.y = 0;
-        full_dst.w = dst->w;
-        full_dst.h = dst->h;
-        dstrect = &full_dst;
+        full_dst->x = 0;
+        full_dst->y = 0;
+        full_dst->w = dst->w;
+        full_dst->h = dst->h;
+        *dstrect = full_dst;
     }
 
     /* Lock the destination if it's in hardware */
-    dst_locked = 0;
+    *dst_locked = 0;
     if (SDL_MUSTLOCK(dst)) {
         if (SDL_LockSurface(dst) < 0) {
             SDL_SetError("Unable to lock destination surface");
             return (-1);
         }
-        dst_locked = 1;
+        *dst_locked = 1;
     }
     /* Lock the source if it's in hardware */
-    src_locked = 0;
+    *src_locked = 0;
     if (SDL_MUSTLOCK(src)) {
         if (SDL_LockSurface(src) < 0) {
-            if (dst_locked) {
+            if (*dst_locked) {
                 SDL_UnlockSurface(dst);
             }
             SDL_SetError("Unable to lock source surface");
             return (-1);
         }
-        src_locked = 1;
+        *src_locked = 1;
+    }
+    return (0);
+}
+
+/* Perform a stretch blit between two surfaces of the same format.
+   NOTE:  This function is not safe to call from multiple threads!
+*/
+int
+SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    int src_locked;
+    int dst_locked;
+    int pos, inc;
+    int dst_width;
+    int dst_maxrow;
+    int src_row, dst_row;
+    Uint8 *srcp = NULL;
+    Uint8 *dstp;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+#if defined(USE_ASM_STRETCH) && defined(__GNUC__)
+    int u1, u2;
+#endif
+    const int bpp = dst->format->BytesPerPixel;
+
+    if (src->format->BitsPerPixel != dst->format->BitsPerPixel) {
+        SDL_SetError("Only works with same format surfaces");
+        return (-1);
+    }
+
+    if (SDL_PrepareStretch(src, &srcrect, &full_src, dst, &dstrect, &full_dst,
+                           &src_locked, &dst_locked) < 0) {
+        return (-1);
     }
 
     /* Set up the data... */
@@ -331,4 +346,59 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     return (0);
 }
 
+/* Perform a bilinear filtered stretch blit between two 32-bit surfaces
+   of the same format. */
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    int src_locked;
+    int dst_locked;
+    int dst_row;
+    int status = 0;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+    SDL_LinearScale scale;
+
+    if (src->format->BitsPerPixel != dst->format->BitsPerPixel) {
+        SDL_SetError("Only works with same format surfaces");
+        return (-1);
+    }
+    if (!SDL_CanScaleLinear(src->format)) {
+        SDL_SetError("Only works with 32-bit surfaces with 8-bit channels");
+        return (-1);
+    }
+    if (SDL_PrepareStretch(src, &srcrect, &full_src, dst, &dstrect, &full_dst,
+                           &src_locked, &dst_locked) < 0) {
+        return (-1);
+    }
+
+    if (!srcrect->w || !srcrect->h || !dstrect->w || !dstrect->h) {
+        /* Nothing to do */
+    } else if (SDL_InitLinearScale(&scale, srcrect->w, srcrect->h,
+                                   dstrect->w, dstrect->h) < 0) {
+        status = -1;
+    } else {
+        const Uint8 *srcp = (Uint8 *) src->pixels + (srcrect->y * src->pitch)
+            + (srcrect->x * 4);
+        Uint8 *dstp = (Uint8 *) dst->pixels + (dstrect->y * dst->pitch)
+            + (dstrect->x * 4);
+
+        for (dst_row = 0; dst_row < dstrect->h; ++dst_row) {
+            SDL_LinearScaleRow(&scale, srcp, src->pitch, (Uint32 *) dstp);
+            dstp += dst->pitch;
+        }
+        SDL_QuitLinearScale(&scale);
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    return (status);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
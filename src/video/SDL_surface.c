@@ -375,9 +375,7 @@ SDL_SetSurfaceColorMod(SDL_Surface * surface, Uint8 r, Uint8 g, Uint8 b)
     } else {
         surface->map->info.flags &= ~SDL_COPY_MODULATE_COLOR;
     }
-    if (surface->map->info.flags != flags) {
-        SDL_InvalidateMap(surface->map);
-    }
+    SDL_UpdateBlitFlags(surface, flags);
     return 0;
 }
 
@@ -418,9 +416,7 @@ SDL_SetSurfaceAlphaMod(SDL_Surface * surface, Uint8 alpha)
     } else {
         surface->map->info.flags &= ~SDL_COPY_MODULATE_ALPHA;
     }
-    if (surface->map->info.flags != flags) {
-        SDL_InvalidateMap(surface->map);
-    }
+    SDL_UpdateBlitFlags(surface, flags);
     return 0;
 }
 
@@ -471,9 +467,7 @@ SDL_SetSurfaceBlendMode(SDL_Surface * surface, int blendMode)
         break;
     }
 
-    if (surface->map->info.flags != flags) {
-        SDL_InvalidateMap(surface->map);
-    }
+    SDL_UpdateBlitFlags(surface, flags);
 
     /* Compatibility mode */
     if (surface->map->info.flags & SDL_COPY_BLEND) {
@@ -529,7 +523,7 @@ SDL_SetSurfaceScaleMode(SDL_Surface * surface, int scaleMode)
 
     status = 0;
     flags = surface->map->info.flags;
-    surface->map->info.flags &= ~(SDL_COPY_NEAREST);
+    surface->map->info.flags &= ~(SDL_COPY_NEAREST | SDL_COPY_LINEAR);
     switch (scaleMode) {
     case SDL_TEXTURESCALEMODE_NONE:
         break;
@@ -537,9 +531,12 @@ SDL_SetSurfaceScaleMode(SDL_Surface * surface, int scaleMode)
         surface->map->info.flags |= SDL_COPY_NEAREST;
         break;
     case SDL_TEXTURESCALEMODE_SLOW:
+        /* Formats that can't be filtered use nearest neighbour scaling */
+        surface->map->info.flags |= (SDL_COPY_NEAREST | SDL_COPY_LINEAR);
+        break;
     case SDL_TEXTURESCALEMODE_BEST:
         SDL_Unsupported();
-        surface->map->info.flags |= SDL_COPY_NEAREST;
+        surface->map->info.flags |= (SDL_COPY_NEAREST | SDL_COPY_LINEAR);
         status = -1;
         break;
     default:
@@ -565,10 +562,13 @@ SDL_GetSurfaceScaleMode(SDL_Surface * surface, int *scaleMode)
         return 0;
     }
 
-    switch (surface->map->info.flags & SDL_COPY_NEAREST) {
+    switch (surface->map->info.flags & (SDL_COPY_NEAREST | SDL_COPY_LINEAR)) {
     case SDL_COPY_NEAREST:
         *scaleMode = SDL_TEXTURESCALEMODE_FAST;
         break;
+    case SDL_COPY_NEAREST | SDL_COPY_LINEAR:
+        *scaleMode = SDL_TEXTURESCALEMODE_SLOW;
+        break;
     default:
         *scaleMode = SDL_TEXTURESCALEMODE_NONE;
         break;
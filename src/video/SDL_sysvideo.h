@@ -96,6 +96,15 @@ struct SDL_Renderer
     int (*RenderFill) (SDL_Renderer * renderer, const SDL_Rect * rect);
     int (*RenderCopy) (SDL_Renderer * renderer, SDL_Texture * texture,
                        const SDL_Rect * srcrect, const SDL_Rect * dstrect);
+    int (*RenderPoints) (SDL_Renderer * renderer, const SDL_Point * points,
+                         int count);
+    int (*RenderLines) (SDL_Renderer * renderer, const SDL_Point * points,
+                        int count);
+    int (*RenderFills) (SDL_Renderer * renderer, const SDL_Rect * rects,
+                        int count);
+    int (*RenderCopies) (SDL_Renderer * renderer, SDL_Texture * texture,
+                         const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                         int count);
     void (*RenderPresent) (SDL_Renderer * renderer);
     void (*DestroyTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
 
@@ -110,6 +119,12 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     int blendMode;                      /**< The drawing blend mode */
 
+    /* Scratch space for batches, kept between calls and grown as needed */
+    void *batch_clipped;                /**< Clipped primitives, SDL_video.c */
+    size_t batch_clipped_size;
+    void *batch_scratch;                /**< For the driver's own use */
+    size_t batch_scratch_size;
+
     void *driverdata;
 };
 
@@ -274,6 +289,15 @@ struct SDL_VideoDevice
      */
     void (*PumpEvents) (_THIS);
 
+    /* Sleep until there may be events to pump, WakeEvents() is called, or
+       timeout milliseconds pass (-1 waits forever).  WakeEvents() must be
+       safe to call from any thread, and a wakeup sent before the wait
+       starts must still end it.  Drivers without these are pumped every
+       10 ms while SDL_WaitEvent() waits.
+     */
+    void (*WaitEvents) (_THIS, int timeout);
+    void (*WakeEvents) (_THIS);
+
     /* Suspend the screensaver */
     void (*SuspendScreenSaver) (_THIS);
 
@@ -431,6 +455,7 @@ extern void SDL_OnWindowResized(SDL_Window * window);
 extern void SDL_OnWindowFocusGained(SDL_Window * window);
 extern void SDL_OnWindowFocusLost(SDL_Window * window);
 extern SDL_WindowID SDL_GetFocusWindow(void);
+extern void *SDL_GetBatchBuffer(void **buffer, size_t * size, size_t needed);
 
 #endif /* _SDL_sysvideo_h */
 
@@ -27,12 +27,14 @@
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
+#include "SDL_blit_threads.h"
 #include "SDL_pixels_c.h"
 #include "SDL_renderer_gl.h"
 #include "SDL_renderer_gles.h"
 #include "SDL_renderer_sw.h"
 #include "../events/SDL_sysevents.h"
 #include "../events/SDL_events_c.h"
+#include "../SDL_profile_c.h"
 
 #if SDL_VIDEO_OPENGL_ES
 #include "SDL_opengles.h"
@@ -288,6 +290,10 @@ SDL_VideoInit(const char *driver_name, Uint32 flags)
         }
     }
 
+    /* Start the blit worker threads, if they've been requested */
+    SDL_BlitThreadsInit();
+    SDL_InitBlitCache();
+
     /* We're ready to go! */
     return 0;
 }
@@ -2161,6 +2167,8 @@ SDL_RenderPoint(int x, int y)
 {
     SDL_Renderer *renderer;
     SDL_Window *window;
+    int status;
+    SDL_PROFILE_BEGIN("SDL_RenderPoint");
 
     if (!_this) {
         SDL_UninitializedVideo();
@@ -2178,7 +2186,9 @@ SDL_RenderPoint(int x, int y)
     if (x < 0 || y < 0 || x >= window->w || y >= window->h) {
         return 0;
     }
-    return renderer->RenderPoint(renderer, x, y);
+    status = renderer->RenderPoint(renderer, x, y);
+    SDL_PROFILE_END(1);
+    return status;
 }
 
 int
@@ -2187,6 +2197,8 @@ SDL_RenderLine(int x1, int y1, int x2, int y2)
     SDL_Renderer *renderer;
     SDL_Window *window;
     SDL_Rect real_rect;
+    int status;
+    SDL_PROFILE_BEGIN("SDL_RenderLine");
 
     if (x1 == x2 && y1 == y2) {
         return SDL_RenderPoint(x1, y1);
@@ -2213,7 +2225,9 @@ SDL_RenderLine(int x1, int y1, int x2, int y2)
     if (!SDL_IntersectRectAndLine(&real_rect, &x1, &y1, &x2, &y2)) {
         return (0);
     }
-    return renderer->RenderLine(renderer, x1, y1, x2, y2);
+    status = renderer->RenderLine(renderer, x1, y1, x2, y2);
+    SDL_PROFILE_END(1);
+    return status;
 }
 
 int
@@ -2222,6 +2236,8 @@ SDL_RenderFill(const SDL_Rect * rect)
     SDL_Renderer *renderer;
     SDL_Window *window;
     SDL_Rect real_rect;
+    int status;
+    SDL_PROFILE_BEGIN("SDL_RenderFill");
 
     if (!_this) {
         SDL_UninitializedVideo();
@@ -2246,7 +2262,49 @@ SDL_RenderFill(const SDL_Rect * rect)
             return 0;
         }
     }
-    return renderer->RenderFill(renderer, &real_rect);
+    status = renderer->RenderFill(renderer, &real_rect);
+    SDL_PROFILE_END(real_rect.w * real_rect.h);
+    return status;
+}
+
+static SDL_bool
+SDL_ClipCopyRects(SDL_Texture * texture, SDL_Window * window,
+                  const SDL_Rect * srcrect, const SDL_Rect * dstrect,
+                  SDL_Rect * real_srcrect, SDL_Rect * real_dstrect)
+{
+    real_srcrect->x = 0;
+    real_srcrect->y = 0;
+    real_srcrect->w = texture->w;
+    real_srcrect->h = texture->h;
+    if (srcrect) {
+        if (!SDL_IntersectRect(srcrect, real_srcrect, real_srcrect)) {
+            return SDL_FALSE;
+        }
+    }
+
+    real_dstrect->x = 0;
+    real_dstrect->y = 0;
+    real_dstrect->w = window->w;
+    real_dstrect->h = window->h;
+    if (dstrect) {
+        if (!SDL_IntersectRect(dstrect, real_dstrect, real_dstrect)) {
+            return SDL_FALSE;
+        }
+        /* Clip srcrect by the same amount as dstrect was clipped */
+        if (dstrect->w != real_dstrect->w) {
+            int deltax = (real_dstrect->x - dstrect->x);
+            int deltaw = (real_dstrect->w - dstrect->w);
+            real_srcrect->x += (deltax * dstrect->w) / real_srcrect->w;
+            real_srcrect->w += (deltaw * dstrect->w) / real_srcrect->w;
+        }
+        if (dstrect->h != real_dstrect->h) {
+            int deltay = (real_dstrect->y - dstrect->y);
+            int deltah = (real_dstrect->h - dstrect->h);
+            real_srcrect->y += (deltay * dstrect->h) / real_srcrect->h;
+            real_srcrect->h += (deltah * dstrect->h) / real_srcrect->h;
+        }
+    }
+    return SDL_TRUE;
 }
 
 int
@@ -2258,6 +2316,8 @@ SDL_RenderCopy(SDL_TextureID textureID, const SDL_Rect * srcrect,
     SDL_Window *window;
     SDL_Rect real_srcrect;
     SDL_Rect real_dstrect;
+    int status;
+    SDL_PROFILE_BEGIN("SDL_RenderCopy");
 
     if (!texture || texture->renderer != SDL_CurrentDisplay.current_renderer) {
         return -1;
@@ -2272,47 +2332,336 @@ SDL_RenderCopy(SDL_TextureID textureID, const SDL_Rect * srcrect,
     }
     window = SDL_GetWindowFromID(renderer->window);
 
-    real_srcrect.x = 0;
-    real_srcrect.y = 0;
-    real_srcrect.w = texture->w;
-    real_srcrect.h = texture->h;
-    if (srcrect) {
-        if (!SDL_IntersectRect(srcrect, &real_srcrect, &real_srcrect)) {
-            return 0;
+    if (!SDL_ClipCopyRects(texture, window, srcrect, dstrect,
+                           &real_srcrect, &real_dstrect)) {
+        return 0;
+    }
+
+    status = renderer->RenderCopy(renderer, texture, &real_srcrect,
+                                  &real_dstrect);
+    SDL_PROFILE_END(real_dstrect.w * real_dstrect.h);
+    return status;
+}
+
+int
+SDL_RenderPoints(const SDL_Point * points, int count)
+{
+    SDL_Renderer *renderer;
+    SDL_Window *window;
+    SDL_Point *clipped;
+    int i, n;
+    int status = 0;
+    SDL_PROFILE_BEGIN("SDL_RenderPoints");
+
+    if (!_this) {
+        SDL_UninitializedVideo();
+        return -1;
+    }
+    renderer = SDL_CurrentDisplay.current_renderer;
+    if (!renderer) {
+        return -1;
+    }
+    if (!renderer->RenderPoints && !renderer->RenderPoint) {
+        SDL_Unsupported();
+        return -1;
+    }
+    if (!points || count <= 0) {
+        return 0;
+    }
+    window = SDL_GetWindowFromID(renderer->window);
+
+    /* Only make a clipped copy if some points are outside the window */
+    for (i = 0; i < count; ++i) {
+        if (points[i].x < 0 || points[i].y < 0 ||
+            points[i].x >= window->w || points[i].y >= window->h) {
+            break;
+        }
+    }
+    if (i < count) {
+        clipped = (SDL_Point *)
+            SDL_GetBatchBuffer(&renderer->batch_clipped,
+                               &renderer->batch_clipped_size,
+                               count * sizeof(*clipped));
+        if (!clipped) {
+            return -1;
+        }
+        n = 0;
+        for (i = 0; i < count; ++i) {
+            if (points[i].x < 0 || points[i].y < 0 ||
+                points[i].x >= window->w || points[i].y >= window->h) {
+                continue;
+            }
+            clipped[n++] = points[i];
         }
+        points = clipped;
+        count = n;
     }
 
-    real_dstrect.x = 0;
-    real_dstrect.y = 0;
-    real_dstrect.w = window->w;
-    real_dstrect.h = window->h;
-    if (dstrect) {
-        if (!SDL_IntersectRect(dstrect, &real_dstrect, &real_dstrect)) {
-            return 0;
+    if (count > 0) {
+        if (renderer->RenderPoints) {
+            status = renderer->RenderPoints(renderer, points, count);
+        } else {
+            for (i = 0; i < count && status == 0; ++i) {
+                status =
+                    renderer->RenderPoint(renderer, points[i].x, points[i].y);
+            }
         }
-        /* Clip srcrect by the same amount as dstrect was clipped */
-        if (dstrect->w != real_dstrect.w) {
-            int deltax = (real_dstrect.x - dstrect->x);
-            int deltaw = (real_dstrect.w - dstrect->w);
-            real_srcrect.x += (deltax * dstrect->w) / real_srcrect.w;
-            real_srcrect.w += (deltaw * dstrect->w) / real_srcrect.w;
+    }
+    SDL_PROFILE_END(count);
+    return status;
+}
+
+int
+SDL_RenderLines(const SDL_Point * points, int count)
+{
+    SDL_Renderer *renderer;
+    SDL_Window *window;
+    SDL_Rect real_rect;
+    SDL_Point *clipped;
+    int i, n;
+    int status = 0;
+    SDL_PROFILE_BEGIN("SDL_RenderLines");
+
+    if (!_this) {
+        SDL_UninitializedVideo();
+        return -1;
+    }
+    renderer = SDL_CurrentDisplay.current_renderer;
+    if (!renderer) {
+        return -1;
+    }
+    if (!renderer->RenderLines && !renderer->RenderLine) {
+        SDL_Unsupported();
+        return -1;
+    }
+    if (!points || count <= 0) {
+        return 0;
+    }
+    window = SDL_GetWindowFromID(renderer->window);
+
+    real_rect.x = 0;
+    real_rect.y = 0;
+    real_rect.w = window->w;
+    real_rect.h = window->h;
+
+    /* Only make a clipped copy if some end points are outside the window */
+    for (i = 0; i < 2 * count; ++i) {
+        if (points[i].x < 0 || points[i].y < 0 ||
+            points[i].x >= window->w || points[i].y >= window->h) {
+            break;
+        }
+    }
+    if (i < 2 * count) {
+        clipped = (SDL_Point *)
+            SDL_GetBatchBuffer(&renderer->batch_clipped,
+                               &renderer->batch_clipped_size,
+                               2 * count * sizeof(*clipped));
+        if (!clipped) {
+            return -1;
         }
-        if (dstrect->h != real_dstrect.h) {
-            int deltay = (real_dstrect.y - dstrect->y);
-            int deltah = (real_dstrect.h - dstrect->h);
-            real_srcrect.y += (deltay * dstrect->h) / real_srcrect.h;
-            real_srcrect.h += (deltah * dstrect->h) / real_srcrect.h;
+        n = 0;
+        for (i = 0; i < count; ++i) {
+            int x1 = points[2 * i].x;
+            int y1 = points[2 * i].y;
+            int x2 = points[2 * i + 1].x;
+            int y2 = points[2 * i + 1].y;
+
+            if (!SDL_IntersectRectAndLine(&real_rect, &x1, &y1, &x2, &y2)) {
+                continue;
+            }
+            clipped[2 * n].x = x1;
+            clipped[2 * n].y = y1;
+            clipped[2 * n + 1].x = x2;
+            clipped[2 * n + 1].y = y2;
+            ++n;
+        }
+        points = clipped;
+        count = n;
+    }
+
+    if (count > 0) {
+        if (renderer->RenderLines) {
+            status = renderer->RenderLines(renderer, points, count);
+        } else {
+            for (i = 0; i < count && status == 0; ++i) {
+                status =
+                    renderer->RenderLine(renderer, points[2 * i].x,
+                                         points[2 * i].y,
+                                         points[2 * i + 1].x,
+                                         points[2 * i + 1].y);
+            }
+        }
+    }
+    SDL_PROFILE_END(count);
+    return status;
+}
+
+int
+SDL_RenderFills(const SDL_Rect * rects, int count)
+{
+    SDL_Renderer *renderer;
+    SDL_Window *window;
+    SDL_Rect real_rect;
+    SDL_Rect *clipped;
+    int i, n;
+    int status = 0;
+    SDL_PROFILE_BEGIN("SDL_RenderFills");
+
+    if (!_this) {
+        SDL_UninitializedVideo();
+        return -1;
+    }
+    renderer = SDL_CurrentDisplay.current_renderer;
+    if (!renderer) {
+        return -1;
+    }
+    if (!renderer->RenderFills && !renderer->RenderFill) {
+        SDL_Unsupported();
+        return -1;
+    }
+    if (!rects || count <= 0) {
+        return 0;
+    }
+    window = SDL_GetWindowFromID(renderer->window);
+
+    real_rect.x = 0;
+    real_rect.y = 0;
+    real_rect.w = window->w;
+    real_rect.h = window->h;
+
+    /* Only make a clipped copy if some rects aren't inside the window */
+    for (i = 0; i < count; ++i) {
+        if (SDL_RectEmpty(&rects[i]) || rects[i].x < 0 || rects[i].y < 0 ||
+            (rects[i].x + rects[i].w) > window->w ||
+            (rects[i].y + rects[i].h) > window->h) {
+            break;
+        }
+    }
+    if (i < count) {
+        clipped = (SDL_Rect *)
+            SDL_GetBatchBuffer(&renderer->batch_clipped,
+                               &renderer->batch_clipped_size,
+                               count * sizeof(*clipped));
+        if (!clipped) {
+            return -1;
+        }
+        n = 0;
+        for (i = 0; i < count; ++i) {
+            if (SDL_IntersectRect(&rects[i], &real_rect, &clipped[n])) {
+                ++n;
+            }
+        }
+        rects = clipped;
+        count = n;
+    }
+
+    if (count > 0) {
+        if (renderer->RenderFills) {
+            status = renderer->RenderFills(renderer, rects, count);
+        } else {
+            for (i = 0; i < count && status == 0; ++i) {
+                status = renderer->RenderFill(renderer, &rects[i]);
+            }
+        }
+    }
+    SDL_PROFILE_END(count);
+    return status;
+}
+
+/* Grow a buffer kept between calls, so a batch doesn't allocate each time */
+void *
+SDL_GetBatchBuffer(void **buffer, size_t * size, size_t needed)
+{
+    size_t newsize;
+
+    if (needed > *size) {
+        newsize = *size ? *size : 256;
+        while (newsize < needed) {
+            newsize *= 2;
+        }
+        if (*buffer) {
+            SDL_free(*buffer);
+        }
+        *buffer = SDL_malloc(newsize);
+        if (!*buffer) {
+            *size = 0;
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        *size = newsize;
+    }
+    return *buffer;
+}
+
+int
+SDL_RenderCopies(SDL_TextureID textureID, const SDL_Rect * srcrects,
+                 const SDL_Rect * dstrects, int count)
+{
+    SDL_Texture *texture = SDL_GetTextureFromID(textureID);
+    SDL_Renderer *renderer;
+    SDL_Window *window;
+    SDL_Rect *real_srcrects;
+    SDL_Rect *real_dstrects;
+    int i, n;
+    int status = 0;
+    SDL_PROFILE_BEGIN("SDL_RenderCopies");
+
+    if (!texture || texture->renderer != SDL_CurrentDisplay.current_renderer) {
+        return -1;
+    }
+    renderer = SDL_CurrentDisplay.current_renderer;
+    if (!renderer) {
+        return -1;
+    }
+    if (!renderer->RenderCopies && !renderer->RenderCopy) {
+        SDL_Unsupported();
+        return -1;
+    }
+    if (!dstrects || count <= 0) {
+        return 0;
+    }
+    window = SDL_GetWindowFromID(renderer->window);
+
+    real_srcrects = (SDL_Rect *)
+        SDL_GetBatchBuffer(&renderer->batch_clipped,
+                           &renderer->batch_clipped_size,
+                           2 * count * sizeof(SDL_Rect));
+    if (!real_srcrects) {
+        return -1;
+    }
+    real_dstrects = real_srcrects + count;
+
+    n = 0;
+    for (i = 0; i < count; ++i) {
+        if (SDL_ClipCopyRects(texture, window,
+                              srcrects ? &srcrects[i] : NULL, &dstrects[i],
+                              &real_srcrects[n], &real_dstrects[n])) {
+            ++n;
         }
     }
 
-    return renderer->RenderCopy(renderer, texture, &real_srcrect,
-                                &real_dstrect);
+    if (n > 0) {
+        if (renderer->RenderCopies) {
+            status =
+                renderer->RenderCopies(renderer, texture, real_srcrects,
+                                       real_dstrects, n);
+        } else {
+            for (i = 0; i < n && status == 0; ++i) {
+                status =
+                    renderer->RenderCopy(renderer, texture, &real_srcrects[i],
+                                         &real_dstrects[i]);
+            }
+        }
+    }
+    SDL_PROFILE_END(n);
+    return status;
 }
 
 void
 SDL_RenderPresent(void)
 {
     SDL_Renderer *renderer;
+    SDL_PROFILE_BEGIN("SDL_RenderPresent");
 
     if (!_this) {
         SDL_UninitializedVideo();
@@ -2323,6 +2672,7 @@ SDL_RenderPresent(void)
         return;
     }
     renderer->RenderPresent(renderer);
+    SDL_PROFILE_END(1);
 }
 
 void
@@ -2398,6 +2748,12 @@ SDL_DestroyRenderer(SDL_WindowID windowID)
     }
 
     /* Free the renderer instance */
+    if (renderer->batch_clipped) {
+        SDL_free(renderer->batch_clipped);
+    }
+    if (renderer->batch_scratch) {
+        SDL_free(renderer->batch_scratch);
+    }
     renderer->DestroyRenderer(renderer);
 
     /* Clear references */
@@ -2457,6 +2813,8 @@ SDL_VideoQuit(void)
     /* Halt event processing before doing anything else */
     SDL_StopEventLoop();
     SDL_EnableScreenSaver();
+    SDL_BlitThreadsQuit();
+    SDL_QuitBlitCache();
 
     /* Clean up the system video */
     for (i = _this->num_displays; i--;) {
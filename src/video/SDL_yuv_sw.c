@@ -86,8 +86,20 @@
 #include "SDL_video.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_yuv_sw_c.h"
+#include "SDL_blit.h"
+#include "SDL_blit_threads.h"
+#include "../SDL_profile_c.h"
 
 
+/* How the samples of a row are laid out */
+#define YUV_LAYOUT_PLANAR   0   /* Y, U and V each in their own plane */
+#define YUV_LAYOUT_NV       1   /* Y plane, then U and V interleaved */
+#define YUV_LAYOUT_PACKED   2   /* Y, U and V interleaved in one plane */
+
+typedef void (*SDL_SW_YUVRowFunc) (SDL_SW_YUVTexture * swdata,
+                                   const Uint8 * lum, const Uint8 * cr,
+                                   const Uint8 * cb, void *out, int width);
+
 struct SDL_SW_YUVTexture
 {
     Uint32 format;
@@ -96,24 +108,52 @@ struct SDL_SW_YUVTexture
     Uint8 *pixels;
     int *colortab;
     Uint32 *rgb_2_pix;
+
+    /* Converts an even number of pixels in a row to the target format,
+       as 16-bit pixels for 2 byte formats and 32-bit pixels otherwise. */
+    SDL_SW_YUVRowFunc ConvertRow;
+    SDL_SW_YUVRowFunc ConvertRowC;
+    int layout;
+    int lum_step;               /* Bytes from one Y sample to the next */
+    int chroma_step;            /* Bytes from one Cr (or Cb) sample to the next */
+    int target_bytes;
+
+#ifdef __SSE2__
+    /* Where the channels go in the target format */
+    int sse2_pos[4];            /* Byte of R, G, B and A in 24/32-bit pixels */
+    int sse2_alpha;             /* The value of the alpha byte */
+    int sse2_loss[3];           /* Bits dropped from R, G and B in 16-bit pixels */
+    int sse2_shift[3];          /* Bit position of R, G and B in 16-bit pixels */
+    int sse2_amask;
+#endif
+
+#if (__GNUC__ > 2) && defined(__i386__) && __OPTIMIZE__ && SDL_ASSEMBLY_ROUTINES
+    /* Converts a whole unscaled YV12 or IYUV frame with MMX */
     void (*Display1X) (int *colortab, Uint32 * rgb_2_pix,
                        unsigned char *lum, unsigned char *cr,
                        unsigned char *cb, unsigned char *out,
                        int rows, int cols, int mod);
-    void (*Display2X) (int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod);
+#endif
 
     /* These are just so we don't have to allocate them separately */
     Uint16 pitches[3];
     Uint8 *planes[3];
 
-    /* This is a temporary surface in case we have to stretch copy */
-    SDL_Surface *stretch;
-    SDL_Surface *display;
+    /* The source column of each destination pixel when scaling */
+    int *xmap;
+    int xmap_size;
 };
 
+/* One SDL_SW_CopyYUVToRGB() call, split into bands of rows */
+typedef struct
+{
+    SDL_SW_YUVTexture *swdata;
+    SDL_Rect srcrect;
+    int w, h;
+    Uint8 *pixels;
+    SDL_bool direct;            /* Convert straight into the target rows */
+} SDL_SW_YUVCopy;
+
 /* The colorspace conversion functions */
 
 #if (__GNUC__ > 2) && defined(__i386__) && __OPTIMIZE__ && SDL_ASSEMBLY_ROUTINES
@@ -128,759 +168,261 @@ extern void ColorRGBDitherYV12MMX1X(int *colortab, Uint32 * rgb_2_pix,
 #endif
 
 static void
-Color16DitherYV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
+Color16YUVRow(SDL_SW_YUVTexture * swdata, const Uint8 * lum,
+              const Uint8 * cr, const Uint8 * cb, void *out, int width)
 {
-    unsigned short *row1;
-    unsigned short *row2;
-    unsigned char *lum2;
-    int x, y;
+    const int *colortab = swdata->colortab;
+    const Uint32 *rgb_2_pix = swdata->rgb_2_pix;
+    const int lum_step = swdata->lum_step;
+    const int chroma_step = swdata->chroma_step;
+    Uint16 *row = (Uint16 *) out;
+    int x;
     int cr_r;
     int crb_g;
     int cb_b;
-    int cols_2 = cols / 2;
-
-    row1 = (unsigned short *) out;
-    row2 = row1 + cols + mod;
-    lum2 = lum + cols;
 
-    mod += cols + mod;
+    x = width / 2;
+    while (x--) {
+        register int L;
 
-    y = rows / 2;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
+        cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
+        crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
+            + colortab[*cb + 2 * 256];
+        cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
+        cr += chroma_step;
+        cb += chroma_step;
 
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            ++cr;
-            ++cb;
-
-            L = *lum++;
-            *row1++ = (unsigned short) (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-
-            L = *lum++;
-            *row1++ = (unsigned short) (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-
-
-            /* Now, do second row.  */
-
-            L = *lum2++;
-            *row2++ = (unsigned short) (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-
-            L = *lum2++;
-            *row2++ = (unsigned short) (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-        }
-
-        /*
-         * These values are at the start of the next line, (due
-         * to the ++'s above),but they need to be at the start
-         * of the line after that.
-         */
-        lum += cols;
-        lum2 += cols;
-        row1 += mod;
-        row2 += mod;
-    }
-}
-
-static void
-Color24DitherYV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int value;
-    unsigned char *row1;
-    unsigned char *row2;
-    unsigned char *lum2;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    row1 = out;
-    row2 = row1 + cols * 3 + mod * 3;
-    lum2 = lum + cols;
-
-    mod += cols + mod;
-    mod *= 3;
-
-    y = rows / 2;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            ++cr;
-            ++cb;
-
-            L = *lum++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            *row1++ = (value) & 0xFF;
-            *row1++ = (value >> 8) & 0xFF;
-            *row1++ = (value >> 16) & 0xFF;
-
-            L = *lum++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            *row1++ = (value) & 0xFF;
-            *row1++ = (value >> 8) & 0xFF;
-            *row1++ = (value >> 16) & 0xFF;
-
-
-            /* Now, do second row.  */
-
-            L = *lum2++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            *row2++ = (value) & 0xFF;
-            *row2++ = (value >> 8) & 0xFF;
-            *row2++ = (value >> 16) & 0xFF;
-
-            L = *lum2++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            *row2++ = (value) & 0xFF;
-            *row2++ = (value >> 8) & 0xFF;
-            *row2++ = (value >> 16) & 0xFF;
-        }
+        L = *lum;
+        lum += lum_step;
+        *row++ = (Uint16) (rgb_2_pix[L + cr_r] |
+                           rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
 
-        /*
-         * These values are at the start of the next line, (due
-         * to the ++'s above),but they need to be at the start
-         * of the line after that.
-         */
-        lum += cols;
-        lum2 += cols;
-        row1 += mod;
-        row2 += mod;
+        L = *lum;
+        lum += lum_step;
+        *row++ = (Uint16) (rgb_2_pix[L + cr_r] |
+                           rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
     }
 }
 
 static void
-Color32DitherYV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
+Color32YUVRow(SDL_SW_YUVTexture * swdata, const Uint8 * lum,
+              const Uint8 * cr, const Uint8 * cb, void *out, int width)
 {
-    unsigned int *row1;
-    unsigned int *row2;
-    unsigned char *lum2;
-    int x, y;
+    const int *colortab = swdata->colortab;
+    const Uint32 *rgb_2_pix = swdata->rgb_2_pix;
+    const int lum_step = swdata->lum_step;
+    const int chroma_step = swdata->chroma_step;
+    Uint32 *row = (Uint32 *) out;
+    int x;
     int cr_r;
     int crb_g;
     int cb_b;
-    int cols_2 = cols / 2;
-
-    row1 = (unsigned int *) out;
-    row2 = row1 + cols + mod;
-    lum2 = lum + cols;
-
-    mod += cols + mod;
-
-    y = rows / 2;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
 
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            ++cr;
-            ++cb;
+    x = width / 2;
+    while (x--) {
+        register int L;
 
-            L = *lum++;
-            *row1++ = (rgb_2_pix[L + cr_r] |
-                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+        cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
+        crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
+            + colortab[*cb + 2 * 256];
+        cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
+        cr += chroma_step;
+        cb += chroma_step;
 
-            L = *lum++;
-            *row1++ = (rgb_2_pix[L + cr_r] |
-                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+        L = *lum;
+        lum += lum_step;
+        *row++ = (rgb_2_pix[L + cr_r] |
+                  rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
 
-
-            /* Now, do second row.  */
-
-            L = *lum2++;
-            *row2++ = (rgb_2_pix[L + cr_r] |
-                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-
-            L = *lum2++;
-            *row2++ = (rgb_2_pix[L + cr_r] |
-                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-        }
-
-        /*
-         * These values are at the start of the next line, (due
-         * to the ++'s above),but they need to be at the start
-         * of the line after that.
-         */
-        lum += cols;
-        lum2 += cols;
-        row1 += mod;
-        row2 += mod;
+        L = *lum;
+        lum += lum_step;
+        *row++ = (rgb_2_pix[L + cr_r] |
+                  rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
     }
 }
 
+#ifdef __SSE2__
 /*
- * In this function I make use of a nasty trick. The tables have the lower
- * 16 bits replicated in the upper 16. This means I can write ints and get
- * the horisontal doubling for free (almost).
+ * The SSE2 converters work on 8 pixels at a time, with 16-bit Y values and
+ * 16-bit chroma pairs (Cb then Cr, or Cr then Cb) for each two pixels.
+ * The colour matrix is the one the tables above are built from, in 10-bit
+ * fixed point, so the results can be one or two off from the C code.
  */
-static void
-Color16DitherYV12Mod2X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int *row1 = (unsigned int *) out;
-    const int next_row = cols + (mod / 2);
-    unsigned int *row2 = row1 + 2 * next_row;
-    unsigned char *lum2;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    lum2 = lum + cols;
-
-    mod = (next_row * 3) + (mod / 2);
-
-    y = rows / 2;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            ++cr;
-            ++cb;
-
-            L = *lum++;
-            row1[0] = row1[next_row] = (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-            row1++;
-
-            L = *lum++;
-            row1[0] = row1[next_row] = (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-            row1++;
-
-
-            /* Now, do second row. */
-
-            L = *lum2++;
-            row2[0] = row2[next_row] = (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-            row2++;
-
-            L = *lum2++;
-            row2[0] = row2[next_row] = (rgb_2_pix[L + cr_r] |
-                                        rgb_2_pix[L + crb_g] |
-                                        rgb_2_pix[L + cb_b]);
-            row2++;
-        }
-
-        /*
-         * These values are at the start of the next line, (due
-         * to the ++'s above),but they need to be at the start
-         * of the line after that.
-         */
-        lum += cols;
-        lum2 += cols;
-        row1 += mod;
-        row2 += mod;
-    }
-}
-
-static void
-Color24DitherYV12Mod2X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int value;
-    unsigned char *row1 = out;
-    const int next_row = (cols * 2 + mod) * 3;
-    unsigned char *row2 = row1 + 2 * next_row;
-    unsigned char *lum2;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    lum2 = lum + cols;
-
-    mod = next_row * 3 + mod * 3;
-
-    y = rows / 2;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            ++cr;
-            ++cb;
-
-            L = *lum++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row1[0 + 0] = row1[3 + 0] = row1[next_row + 0] =
-                row1[next_row + 3 + 0] = (value) & 0xFF;
-            row1[0 + 1] = row1[3 + 1] = row1[next_row + 1] =
-                row1[next_row + 3 + 1] = (value >> 8) & 0xFF;
-            row1[0 + 2] = row1[3 + 2] = row1[next_row + 2] =
-                row1[next_row + 3 + 2] = (value >> 16) & 0xFF;
-            row1 += 2 * 3;
-
-            L = *lum++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row1[0 + 0] = row1[3 + 0] = row1[next_row + 0] =
-                row1[next_row + 3 + 0] = (value) & 0xFF;
-            row1[0 + 1] = row1[3 + 1] = row1[next_row + 1] =
-                row1[next_row + 3 + 1] = (value >> 8) & 0xFF;
-            row1[0 + 2] = row1[3 + 2] = row1[next_row + 2] =
-                row1[next_row + 3 + 2] = (value >> 16) & 0xFF;
-            row1 += 2 * 3;
-
-
-            /* Now, do second row. */
-
-            L = *lum2++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row2[0 + 0] = row2[3 + 0] = row2[next_row + 0] =
-                row2[next_row + 3 + 0] = (value) & 0xFF;
-            row2[0 + 1] = row2[3 + 1] = row2[next_row + 1] =
-                row2[next_row + 3 + 1] = (value >> 8) & 0xFF;
-            row2[0 + 2] = row2[3 + 2] = row2[next_row + 2] =
-                row2[next_row + 3 + 2] = (value >> 16) & 0xFF;
-            row2 += 2 * 3;
-
-            L = *lum2++;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row2[0 + 0] = row2[3 + 0] = row2[next_row + 0] =
-                row2[next_row + 3 + 0] = (value) & 0xFF;
-            row2[0 + 1] = row2[3 + 1] = row2[next_row + 1] =
-                row2[next_row + 3 + 1] = (value >> 8) & 0xFF;
-            row2[0 + 2] = row2[3 + 2] = row2[next_row + 2] =
-                row2[next_row + 3 + 2] = (value >> 16) & 0xFF;
-            row2 += 2 * 3;
-        }
-
-        /*
-         * These values are at the start of the next line, (due
-         * to the ++'s above),but they need to be at the start
-         * of the line after that.
-         */
-        lum += cols;
-        lum2 += cols;
-        row1 += mod;
-        row2 += mod;
-    }
-}
-
-static void
-Color32DitherYV12Mod2X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
+static __inline__ void
+SSE2_YUVToRGB(__m128i y, __m128i c, int cb_first,
+              __m128i * r, __m128i * g, __m128i * b)
 {
-    unsigned int *row1 = (unsigned int *) out;
-    const int next_row = cols * 2 + mod;
-    unsigned int *row2 = row1 + 2 * next_row;
-    unsigned char *lum2;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    lum2 = lum + cols;
-
-    mod = (next_row * 3) + mod;
-
-    y = rows / 2;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            ++cr;
-            ++cb;
-
-            L = *lum++;
-            row1[0] = row1[1] = row1[next_row] = row1[next_row + 1] =
-                (rgb_2_pix[L + cr_r] |
-                 rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row1 += 2;
-
-            L = *lum++;
-            row1[0] = row1[1] = row1[next_row] = row1[next_row + 1] =
-                (rgb_2_pix[L + cr_r] |
-                 rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row1 += 2;
-
-
-            /* Now, do second row. */
-
-            L = *lum2++;
-            row2[0] = row2[1] = row2[next_row] = row2[next_row + 1] =
-                (rgb_2_pix[L + cr_r] |
-                 rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row2 += 2;
-
-            L = *lum2++;
-            row2[0] = row2[1] = row2[next_row] = row2[next_row + 1] =
-                (rgb_2_pix[L + cr_r] |
-                 rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row2 += 2;
-        }
-
-        /*
-         * These values are at the start of the next line, (due
-         * to the ++'s above),but they need to be at the start
-         * of the line after that.
-         */
-        lum += cols;
-        lum2 += cols;
-        row1 += mod;
-        row2 += mod;
-    }
+    const __m128i bias = _mm_set1_epi16(128);
+    __m128i first, second, u, v;
+
+    /* Give both pixels of a pair the same chroma */
+    first = _mm_and_si128(c, _mm_set1_epi32(0xFFFF));
+    first = _mm_or_si128(first, _mm_slli_epi32(first, 16));
+    second = _mm_srli_epi32(c, 16);
+    second = _mm_or_si128(second, _mm_slli_epi32(second, 16));
+    if (cb_first) {
+        u = first;
+        v = second;
+    } else {
+        u = second;
+        v = first;
+    }
+
+    u = _mm_slli_epi16(_mm_sub_epi16(u, bias), 6);
+    v = _mm_slli_epi16(_mm_sub_epi16(v, bias), 6);
+    *r = _mm_add_epi16(y, _mm_mulhi_epi16(v, _mm_set1_epi16(1435)));
+    *g = _mm_add_epi16(y,
+                       _mm_add_epi16(_mm_mulhi_epi16
+                                     (v, _mm_set1_epi16(-731)),
+                                     _mm_mulhi_epi16(u,
+                                                     _mm_set1_epi16(-353))));
+    *b = _mm_add_epi16(y, _mm_mulhi_epi16(u, _mm_set1_epi16(1816)));
 }
 
 static void
-Color16DitherYUY2Mod1X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
+SSE2YUVRow(SDL_SW_YUVTexture * swdata, const Uint8 * lum,
+           const Uint8 * cr, const Uint8 * cb, void *out, int width)
 {
-    unsigned short *row;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    row = (unsigned short *) out;
-
-    y = rows;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            cr += 4;
-            cb += 4;
-
-            L = *lum;
-            lum += 2;
-            *row++ = (unsigned short) (rgb_2_pix[L + cr_r] |
-                                       rgb_2_pix[L + crb_g] |
-                                       rgb_2_pix[L + cb_b]);
-
-            L = *lum;
-            lum += 2;
-            *row++ = (unsigned short) (rgb_2_pix[L + cr_r] |
-                                       rgb_2_pix[L + crb_g] |
-                                       rgb_2_pix[L + cb_b]);
-
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low_bytes = _mm_set1_epi16(0x00FF);
+    const __m128i alpha = _mm_set1_epi8((char) swdata->sse2_alpha);
+    const __m128i amask = _mm_set1_epi16((short) swdata->sse2_amask);
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i rloss = _mm_cvtsi32_si128(swdata->sse2_loss[0]);
+    const __m128i gloss = _mm_cvtsi32_si128(swdata->sse2_loss[1]);
+    const __m128i bloss = _mm_cvtsi32_si128(swdata->sse2_loss[2]);
+    const __m128i rshift = _mm_cvtsi32_si128(swdata->sse2_shift[0]);
+    const __m128i gshift = _mm_cvtsi32_si128(swdata->sse2_shift[1]);
+    const __m128i bshift = _mm_cvtsi32_si128(swdata->sse2_shift[2]);
+    const int cb_first = (cb < cr);
+    const int lum_high = (lum > cb);
+    const Uint8 *packed = (lum < cb) ? lum : cb;
+    const Uint8 *pairs = (cb < cr) ? cb : cr;
+    Uint8 *dst = (Uint8 *) out;
+    int x;
+
+    if (packed > cr) {
+        packed = cr;
+    }
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        __m128i y, c, r, g, b;
+
+        switch (swdata->layout) {
+        case YUV_LAYOUT_PLANAR:
+            y = _mm_unpacklo_epi8(_mm_loadl_epi64
+                                  ((const __m128i *) (lum + x)), zero);
+            c = _mm_unpacklo_epi8(_mm_cvtsi32_si128
+                                  (*(const int *) (cb + x / 2)),
+                                  _mm_cvtsi32_si128(*(const int *)
+                                                    (cr + x / 2)));
+            c = _mm_unpacklo_epi8(c, zero);
+            break;
+        case YUV_LAYOUT_NV:
+            y = _mm_unpacklo_epi8(_mm_loadl_epi64
+                                  ((const __m128i *) (lum + x)), zero);
+            c = _mm_unpacklo_epi8(_mm_loadl_epi64
+                                  ((const __m128i *) (pairs + x)), zero);
+            break;
+        default:
+            c = _mm_loadu_si128((const __m128i *) (packed + x * 2));
+            if (lum_high) {
+                y = _mm_srli_epi16(c, 8);
+                c = _mm_and_si128(c, low_bytes);
+            } else {
+                y = _mm_and_si128(c, low_bytes);
+                c = _mm_srli_epi16(c, 8);
+            }
+            break;
         }
-
-        row += mod;
-    }
-}
-
-static void
-Color24DitherYUY2Mod1X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int value;
-    unsigned char *row;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    row = (unsigned char *) out;
-    mod *= 3;
-    y = rows;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            cr += 4;
-            cb += 4;
-
-            L = *lum;
-            lum += 2;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            *row++ = (value) & 0xFF;
-            *row++ = (value >> 8) & 0xFF;
-            *row++ = (value >> 16) & 0xFF;
-
-            L = *lum;
-            lum += 2;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            *row++ = (value) & 0xFF;
-            *row++ = (value >> 8) & 0xFF;
-            *row++ = (value >> 16) & 0xFF;
-
+        SSE2_YUVToRGB(y, c, (swdata->layout == YUV_LAYOUT_PLANAR) ?
+                      1 : cb_first, &r, &g, &b);
+
+        if (swdata->target_bytes == 2) {
+            r = _mm_min_epi16(_mm_max_epi16(r, zero), max);
+            g = _mm_min_epi16(_mm_max_epi16(g, zero), max);
+            b = _mm_min_epi16(_mm_max_epi16(b, zero), max);
+            r = _mm_sll_epi16(_mm_srl_epi16(r, rloss), rshift);
+            g = _mm_sll_epi16(_mm_srl_epi16(g, gloss), gshift);
+            b = _mm_sll_epi16(_mm_srl_epi16(b, bloss), bshift);
+            r = _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, amask));
+            _mm_storeu_si128((__m128i *) (dst + x * 2), r);
+        } else {
+            __m128i channels[4], lo, hi;
+
+            channels[swdata->sse2_pos[0]] = _mm_packus_epi16(r, r);
+            channels[swdata->sse2_pos[1]] = _mm_packus_epi16(g, g);
+            channels[swdata->sse2_pos[2]] = _mm_packus_epi16(b, b);
+            channels[swdata->sse2_pos[3]] = alpha;
+            lo = _mm_unpacklo_epi8(channels[0], channels[1]);
+            hi = _mm_unpacklo_epi8(channels[2], channels[3]);
+            _mm_storeu_si128((__m128i *) (dst + x * 4),
+                             _mm_unpacklo_epi16(lo, hi));
+            _mm_storeu_si128((__m128i *) (dst + x * 4 + 16),
+                             _mm_unpackhi_epi16(lo, hi));
         }
-        row += mod;
     }
-}
-
-static void
-Color32DitherYUY2Mod1X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int *row;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    row = (unsigned int *) out;
-    y = rows;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            cr += 4;
-            cb += 4;
 
-            L = *lum;
-            lum += 2;
-            *row++ = (rgb_2_pix[L + cr_r] |
-                      rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-
-            L = *lum;
-            lum += 2;
-            *row++ = (rgb_2_pix[L + cr_r] |
-                      rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-
-
-        }
-        row += mod;
+    /* Finish off the last few pixels */
+    if (x < width) {
+        swdata->ConvertRowC(swdata, lum + x * swdata->lum_step,
+                            cr + (x / 2) * swdata->chroma_step,
+                            cb + (x / 2) * swdata->chroma_step,
+                            dst + x * ((swdata->target_bytes == 2) ? 2 : 4),
+                            width - x);
     }
 }
 
-/*
- * In this function I make use of a nasty trick. The tables have the lower
- * 16 bits replicated in the upper 16. This means I can write ints and get
- * the horisontal doubling for free (almost).
- */
-static void
-Color16DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
+/* See if the SSE2 converter can produce the target format */
+static SDL_bool
+SSE2_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 Rmask, Uint32 Gmask,
+                     Uint32 Bmask, Uint32 Amask)
 {
-    unsigned int *row = (unsigned int *) out;
-    const int next_row = cols + (mod / 2);
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-
-    y = rows;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            cr += 4;
-            cb += 4;
-
-            L = *lum;
-            lum += 2;
-            row[0] = row[next_row] = (rgb_2_pix[L + cr_r] |
-                                      rgb_2_pix[L + crb_g] |
-                                      rgb_2_pix[L + cb_b]);
-            row++;
-
-            L = *lum;
-            lum += 2;
-            row[0] = row[next_row] = (rgb_2_pix[L + cr_r] |
-                                      rgb_2_pix[L + crb_g] |
-                                      rgb_2_pix[L + cb_b]);
-            row++;
+    const Uint32 masks[3] = { Rmask, Gmask, Bmask };
+    int i;
 
-        }
-        row += next_row;
+    if (!(SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2)) {
+        return SDL_FALSE;
     }
-}
-
-static void
-Color24DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int value;
-    unsigned char *row = out;
-    const int next_row = (cols * 2 + mod) * 3;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-    y = rows;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            cr += 4;
-            cb += 4;
-
-            L = *lum;
-            lum += 2;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row[0 + 0] = row[3 + 0] = row[next_row + 0] =
-                row[next_row + 3 + 0] = (value) & 0xFF;
-            row[0 + 1] = row[3 + 1] = row[next_row + 1] =
-                row[next_row + 3 + 1] = (value >> 8) & 0xFF;
-            row[0 + 2] = row[3 + 2] = row[next_row + 2] =
-                row[next_row + 3 + 2] = (value >> 16) & 0xFF;
-            row += 2 * 3;
-
-            L = *lum;
-            lum += 2;
-            value = (rgb_2_pix[L + cr_r] |
-                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row[0 + 0] = row[3 + 0] = row[next_row + 0] =
-                row[next_row + 3 + 0] = (value) & 0xFF;
-            row[0 + 1] = row[3 + 1] = row[next_row + 1] =
-                row[next_row + 3 + 1] = (value >> 8) & 0xFF;
-            row[0 + 2] = row[3 + 2] = row[next_row + 2] =
-                row[next_row + 3 + 2] = (value >> 16) & 0xFF;
-            row += 2 * 3;
-
+    if (swdata->target_bytes == 2) {
+        for (i = 0; i < 3; ++i) {
+            int bits = 0, shift = 0;
+            if (!masks[i]) {
+                return SDL_FALSE;
+            }
+            while (!(masks[i] & (1 << shift))) {
+                ++shift;
+            }
+            while (masks[i] & (1 << (shift + bits))) {
+                ++bits;
+            }
+            if (bits > 8) {
+                return SDL_FALSE;
+            }
+            swdata->sse2_loss[i] = 8 - bits;
+            swdata->sse2_shift[i] = shift;
         }
-        row += next_row;
-    }
-}
-
-static void
-Color32DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
-                       unsigned char *lum, unsigned char *cr,
-                       unsigned char *cb, unsigned char *out,
-                       int rows, int cols, int mod)
-{
-    unsigned int *row = (unsigned int *) out;
-    const int next_row = cols * 2 + mod;
-    int x, y;
-    int cr_r;
-    int crb_g;
-    int cb_b;
-    int cols_2 = cols / 2;
-    mod += mod;
-    y = rows;
-    while (y--) {
-        x = cols_2;
-        while (x--) {
-            register int L;
-
-            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
-            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
-                + colortab[*cb + 2 * 256];
-            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
-            cr += 4;
-            cb += 4;
-
-            L = *lum;
-            lum += 2;
-            row[0] = row[1] = row[next_row] = row[next_row + 1] =
-                (rgb_2_pix[L + cr_r] |
-                 rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row += 2;
-
-            L = *lum;
-            lum += 2;
-            row[0] = row[1] = row[next_row] = row[next_row + 1] =
-                (rgb_2_pix[L + cr_r] |
-                 rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
-            row += 2;
-
-
+        swdata->sse2_amask = (int) Amask;
+    } else {
+        int pos_sum = 0;
+        for (i = 0; i < 3; ++i) {
+            int shift = 0;
+            while (shift < 32 && masks[i] != (0xFFu << shift)) {
+                shift += 8;
+            }
+            if (shift == 32) {
+                return SDL_FALSE;
+            }
+            swdata->sse2_pos[i] = shift / 8;
+            pos_sum += shift / 8;
         }
-
-        row += next_row;
+        /* Whichever byte is left over is alpha, or padding */
+        swdata->sse2_pos[3] = (0 + 1 + 2 + 3) - pos_sum;
+        swdata->sse2_alpha = (Amask >> (swdata->sse2_pos[3] * 8)) & 0xFF;
     }
+    return SDL_TRUE;
 }
+#endif /* __SSE2__ */
 
 /*
  * How many 1 bits are there in the Uint32.
@@ -928,11 +470,12 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
     }
 
     swdata->target_format = target_format;
+    swdata->target_bytes = SDL_BYTESPERPIXEL(target_format);
     r_2_pix_alloc = &swdata->rgb_2_pix[0 * 768];
     g_2_pix_alloc = &swdata->rgb_2_pix[1 * 768];
     b_2_pix_alloc = &swdata->rgb_2_pix[2 * 768];
 
-    /* 
+    /*
      * Set up entries 0-255 in rgb-to-pixel value tables.
      */
     for (i = 0; i < 256; ++i) {
@@ -947,21 +490,6 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
         b_2_pix_alloc[i + 256] |= Amask;
     }
 
-    /*
-     * If we have 16-bit output depth, then we double the value
-     * in the top word. This means that we can write out both
-     * pixels in the pixel doubling mode with one op. It is 
-     * harmless in the normal case as storing a 32-bit value
-     * through a short pointer will lose the top bits anyway.
-     */
-    if (SDL_BYTESPERPIXEL(target_format) == 2) {
-        for (i = 0; i < 256; ++i) {
-            r_2_pix_alloc[i + 256] |= (r_2_pix_alloc[i + 256]) << 16;
-            g_2_pix_alloc[i + 256] |= (g_2_pix_alloc[i + 256]) << 16;
-            b_2_pix_alloc[i + 256] |= (b_2_pix_alloc[i + 256]) << 16;
-        }
-    }
-
     /*
      * Spread out the values we have to the rest of the array so that
      * we do not need to check for overflow.
@@ -976,73 +504,31 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
     }
 
     /* You have chosen wisely... */
-    switch (swdata->format) {
-    case SDL_PIXELFORMAT_YV12:
-    case SDL_PIXELFORMAT_IYUV:
-        if (SDL_BYTESPERPIXEL(target_format) == 2) {
-#if (__GNUC__ > 2) && defined(__i386__) && __OPTIMIZE__ && SDL_ASSEMBLY_ROUTINES
-            /* inline assembly functions */
-            if (SDL_HasMMX() && (Rmask == 0xF800) &&
-                (Gmask == 0x07E0) && (Bmask == 0x001F)
-                && (swdata->w & 15) == 0) {
-/*printf("Using MMX 16-bit 565 dither\n");*/
-                swdata->Display1X = Color565DitherYV12MMX1X;
-            } else {
-/*printf("Using C 16-bit dither\n");*/
-                swdata->Display1X = Color16DitherYV12Mod1X;
-            }
-#else
-            swdata->Display1X = Color16DitherYV12Mod1X;
+    if (swdata->target_bytes == 2) {
+        swdata->ConvertRowC = Color16YUVRow;
+    } else {
+        swdata->ConvertRowC = Color32YUVRow;
+    }
+    swdata->ConvertRow = swdata->ConvertRowC;
+#ifdef __SSE2__
+    if (SSE2_SetupYUVDisplay(swdata, Rmask, Gmask, Bmask, Amask)) {
+        swdata->ConvertRow = SSE2YUVRow;
+    }
 #endif
-            swdata->Display2X = Color16DitherYV12Mod2X;
-        }
-        if (SDL_BYTESPERPIXEL(target_format) == 3) {
-            swdata->Display1X = Color24DitherYV12Mod1X;
-            swdata->Display2X = Color24DitherYV12Mod2X;
-        }
-        if (SDL_BYTESPERPIXEL(target_format) == 4) {
+
 #if (__GNUC__ > 2) && defined(__i386__) && __OPTIMIZE__ && SDL_ASSEMBLY_ROUTINES
-            /* inline assembly functions */
-            if (SDL_HasMMX() && (Rmask == 0x00FF0000) &&
-                (Gmask == 0x0000FF00) &&
-                (Bmask == 0x000000FF) && (swdata->w & 15) == 0) {
-/*printf("Using MMX 32-bit dither\n");*/
-                swdata->Display1X = ColorRGBDitherYV12MMX1X;
-            } else {
-/*printf("Using C 32-bit dither\n");*/
-                swdata->Display1X = Color32DitherYV12Mod1X;
-            }
-#else
-            swdata->Display1X = Color32DitherYV12Mod1X;
-#endif
-            swdata->Display2X = Color32DitherYV12Mod2X;
+    /* inline assembly functions, for processors without SSE2 */
+    swdata->Display1X = NULL;
+    if (swdata->ConvertRow == swdata->ConvertRowC && SDL_HasMMX() &&
+        swdata->layout == YUV_LAYOUT_PLANAR && (swdata->w & 15) == 0) {
+        if ((Rmask == 0xF800) && (Gmask == 0x07E0) && (Bmask == 0x001F)) {
+            swdata->Display1X = Color565DitherYV12MMX1X;
+        } else if (swdata->target_bytes == 4 && (Rmask == 0x00FF0000) &&
+                   (Gmask == 0x0000FF00) && (Bmask == 0x000000FF)) {
+            swdata->Display1X = ColorRGBDitherYV12MMX1X;
         }
-        break;
-    case SDL_PIXELFORMAT_YUY2:
-    case SDL_PIXELFORMAT_UYVY:
-    case SDL_PIXELFORMAT_YVYU:
-        if (SDL_BYTESPERPIXEL(target_format) == 2) {
-            swdata->Display1X = Color16DitherYUY2Mod1X;
-            swdata->Display2X = Color16DitherYUY2Mod2X;
-        }
-        if (SDL_BYTESPERPIXEL(target_format) == 3) {
-            swdata->Display1X = Color24DitherYUY2Mod1X;
-            swdata->Display2X = Color24DitherYUY2Mod2X;
-        }
-        if (SDL_BYTESPERPIXEL(target_format) == 4) {
-            swdata->Display1X = Color32DitherYUY2Mod1X;
-            swdata->Display2X = Color32DitherYUY2Mod2X;
-        }
-        break;
-    default:
-        /* We should never get here (caught above) */
-        break;
-    }
-
-    if (swdata->display) {
-        SDL_FreeSurface(swdata->display);
-        swdata->display = NULL;
     }
+#endif
     return 0;
 }
 
@@ -1057,15 +543,11 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     int i;
     int CR, CB;
 
-    swdata = (SDL_SW_YUVTexture *) SDL_calloc(1, sizeof(*swdata));
-    if (!swdata) {
-        SDL_OutOfMemory();
-        return NULL;
-    }
-
     switch (format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1075,6 +557,12 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         return NULL;
     }
 
+    swdata = (SDL_SW_YUVTexture *) SDL_calloc(1, sizeof(*swdata));
+    if (!swdata) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
     swdata->format = format;
     swdata->target_format = SDL_PIXELFORMAT_UNKNOWN;
     swdata->w = w;
@@ -1114,12 +602,28 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         swdata->planes[0] = swdata->pixels;
         swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
         swdata->planes[2] = swdata->planes[1] + swdata->pitches[1] * h / 2;
+        swdata->layout = YUV_LAYOUT_PLANAR;
+        swdata->lum_step = 1;
+        swdata->chroma_step = 1;
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        swdata->pitches[0] = w;
+        swdata->pitches[1] = w;
+        swdata->planes[0] = swdata->pixels;
+        swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
+        swdata->layout = YUV_LAYOUT_NV;
+        swdata->lum_step = 1;
+        swdata->chroma_step = 2;
         break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
         swdata->pitches[0] = w * 2;
         swdata->planes[0] = swdata->pixels;
+        swdata->layout = YUV_LAYOUT_PACKED;
+        swdata->lum_step = 2;
+        swdata->chroma_step = 4;
         break;
     default:
         /* We should never get here (caught above) */
@@ -1146,14 +650,19 @@ SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     switch (swdata->format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
         if (rect
             && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w
                 || rect->h != swdata->h)) {
             SDL_SetError
-                ("YV12 and IYUV textures only support full surface updates");
+                ("Planar YUV textures only support full surface updates");
             return -1;
         }
-        SDL_memcpy(swdata->pixels, pixels, swdata->h * swdata->w * 2);
+        /* The luma plane and two quarter size chroma planes */
+        SDL_memcpy(swdata->pixels, pixels,
+                   swdata->h * swdata->w + 2 * (swdata->h / 2) *
+                   (swdata->w / 2));
         break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
@@ -1186,11 +695,13 @@ SDL_SW_LockYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     switch (swdata->format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
         if (rect
             && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w
                 || rect->h != swdata->h)) {
             SDL_SetError
-                ("YV12 and IYUV textures only support full surface locks");
+                ("Planar YUV textures only support full surface locks");
             return -1;
         }
         break;
@@ -1206,15 +717,154 @@ SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture * swdata)
 {
 }
 
+/* Find the first samples of a source row */
+static void
+SDL_SW_GetYUVRow(SDL_SW_YUVTexture * swdata, int y, const Uint8 ** lum,
+                 const Uint8 ** cr, const Uint8 ** cb)
+{
+    const Uint8 *row = swdata->planes[0] + y * swdata->pitches[0];
+    const Uint8 *chroma;
+
+    switch (swdata->format) {
+    case SDL_PIXELFORMAT_YV12:
+        *lum = row;
+        *cr = swdata->planes[1] + (y / 2) * swdata->pitches[1];
+        *cb = swdata->planes[2] + (y / 2) * swdata->pitches[2];
+        break;
+    case SDL_PIXELFORMAT_IYUV:
+        *lum = row;
+        *cr = swdata->planes[2] + (y / 2) * swdata->pitches[2];
+        *cb = swdata->planes[1] + (y / 2) * swdata->pitches[1];
+        break;
+    case SDL_PIXELFORMAT_NV12:
+        chroma = swdata->planes[1] + (y / 2) * swdata->pitches[1];
+        *lum = row;
+        *cr = chroma + 1;
+        *cb = chroma;
+        break;
+    case SDL_PIXELFORMAT_NV21:
+        chroma = swdata->planes[1] + (y / 2) * swdata->pitches[1];
+        *lum = row;
+        *cr = chroma;
+        *cb = chroma + 1;
+        break;
+    case SDL_PIXELFORMAT_YUY2:
+        *lum = row;
+        *cr = row + 3;
+        *cb = row + 1;
+        break;
+    case SDL_PIXELFORMAT_UYVY:
+        *lum = row + 1;
+        *cr = row + 2;
+        *cb = row;
+        break;
+    case SDL_PIXELFORMAT_YVYU:
+        *lum = row;
+        *cr = row + 1;
+        *cb = row + 3;
+        break;
+    }
+}
+
+/* Convert and scale a band of destination rows.  The blit threads split
+   a copy like any other blit: info->src points at the SDL_SW_YUVCopy and
+   isn't moved, since its pitch is 0, and info->dst is the first row of
+   the band.
+ */
+static void SDLCALL
+SDL_SW_CopyYUVRows(SDL_BlitInfo * info)
+{
+    const SDL_SW_YUVCopy *copy = (const SDL_SW_YUVCopy *) info->src;
+    SDL_SW_YUVTexture *swdata = copy->swdata;
+    const int bytes = swdata->target_bytes;
+    const int row_bytes = (bytes == 2) ? 2 : 4;
+    const int first = (int) ((info->dst - copy->pixels) / info->dst_pitch);
+    const int x = copy->srcrect.x & ~1;
+    const int width = ((copy->srcrect.x + copy->srcrect.w + 1) & ~1) - x;
+    Uint8 *rowbuf = NULL;
+    Uint8 *out = info->dst;
+    int dy, sy, last_sy = -1;
+
+    if (!copy->direct) {
+        rowbuf = SDL_stack_alloc(Uint8, width * row_bytes);
+        if (!rowbuf) {
+            return;
+        }
+    }
+
+    for (dy = first; dy < first + info->dst_h; ++dy, out += info->dst_pitch) {
+        const Uint8 *lum, *cr, *cb;
+
+        sy = copy->srcrect.y + (dy * copy->srcrect.h) / copy->h;
+        if (sy == last_sy) {
+            /* Scaling up, this row looks just like the last one */
+            SDL_memcpy(out, out - info->dst_pitch, copy->w * bytes);
+            continue;
+        }
+        last_sy = sy;
+
+        SDL_SW_GetYUVRow(swdata, sy, &lum, &cr, &cb);
+        lum += x * swdata->lum_step;
+        cr += (x / 2) * swdata->chroma_step;
+        cb += (x / 2) * swdata->chroma_step;
+        if (copy->direct) {
+            swdata->ConvertRow(swdata, lum, cr, cb, out, width);
+            continue;
+        }
+        swdata->ConvertRow(swdata, lum, cr, cb, rowbuf, width);
+
+        /* Pick out the source pixel for each destination pixel */
+        {
+            const int *xmap = swdata->xmap;
+            int i;
+
+            switch (bytes) {
+            case 2:
+                {
+                    const Uint16 *src = (const Uint16 *) rowbuf;
+                    Uint16 *dst = (Uint16 *) out;
+                    for (i = 0; i < copy->w; ++i) {
+                        dst[i] = src[xmap[i]];
+                    }
+                }
+                break;
+            case 3:
+                {
+                    const Uint32 *src = (const Uint32 *) rowbuf;
+                    Uint8 *dst = out;
+                    for (i = 0; i < copy->w; ++i) {
+                        const Uint32 value = src[xmap[i]];
+                        *dst++ = (value) & 0xFF;
+                        *dst++ = (value >> 8) & 0xFF;
+                        *dst++ = (value >> 16) & 0xFF;
+                    }
+                }
+                break;
+            default:
+                {
+                    const Uint32 *src = (const Uint32 *) rowbuf;
+                    Uint32 *dst = (Uint32 *) out;
+                    for (i = 0; i < copy->w; ++i) {
+                        dst[i] = src[xmap[i]];
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    if (rowbuf) {
+        SDL_stack_free(rowbuf);
+    }
+}
+
 int
 SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
                     Uint32 target_format, int w, int h, void *pixels,
                     int pitch)
 {
-    int stretch;
-    int scale_2x;
-    Uint8 *lum, *Cr, *Cb;
-    int mod;
+    SDL_SW_YUVCopy copy;
+    SDL_BlitInfo info;
 
     /* Make sure we're set up to display in the desired format */
     if (target_format != swdata->target_format) {
@@ -1222,102 +872,75 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
             return -1;
         }
     }
+    if (w <= 0 || h <= 0 || srcrect->w <= 0 || srcrect->h <= 0) {
+        return 0;
+    }
 
-    stretch = 0;
-    scale_2x = 0;
-    if (srcrect->x || srcrect->y || srcrect->w < swdata->w
-        || srcrect->h < swdata->h) {
-        /* The source rectangle has been clipped.
-           Using a scratch surface is easier than adding clipped
-           source support to all the blitters, plus that would
-           slow them down in the general unclipped case.
-         */
-        stretch = 1;
-    } else if ((srcrect->w != w) || (srcrect->h != h)) {
-        if ((w == 2 * srcrect->w) && (h == 2 * srcrect->h)) {
-            scale_2x = 1;
-        } else {
-            stretch = 1;
+#if (__GNUC__ > 2) && defined(__i386__) && __OPTIMIZE__ && SDL_ASSEMBLY_ROUTINES
+    if (swdata->Display1X && !srcrect->x && !srcrect->y &&
+        srcrect->w == swdata->w && srcrect->h == swdata->h &&
+        w == swdata->w && h == swdata->h) {
+        Uint8 *lum = swdata->planes[0];
+        Uint8 *Cr = swdata->planes[1];
+        Uint8 *Cb = swdata->planes[2];
+
+        if (swdata->format == SDL_PIXELFORMAT_IYUV) {
+            Cr = swdata->planes[2];
+            Cb = swdata->planes[1];
         }
+        swdata->Display1X(swdata->colortab, swdata->rgb_2_pix, lum, Cr, Cb,
+                          pixels, swdata->h, swdata->w,
+                          (pitch / swdata->target_bytes) - swdata->w);
+        return 0;
     }
-    if (stretch) {
-        int bpp;
-        Uint32 Rmask, Gmask, Bmask, Amask;
-
-        if (swdata->display) {
-            swdata->display->w = w;
-            swdata->display->h = h;
-            swdata->display->pixels = pixels;
-            swdata->display->pitch = pitch;
-        } else {
-            /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
-            SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
-                                       &Bmask, &Amask);
-            swdata->display =
-                SDL_CreateRGBSurfaceFrom(pixels, w, h, bpp, pitch, Rmask,
-                                         Gmask, Bmask, Amask);
-            if (!swdata->display) {
-                return (-1);
+#endif
+
+    copy.swdata = swdata;
+    copy.srcrect = *srcrect;
+    copy.w = w;
+    copy.h = h;
+    copy.pixels = (Uint8 *) pixels;
+
+    /* Rows can be converted in place unless they're scaled or packed into
+       24-bit pixels, or start or end halfway through a chroma pair.
+     */
+    copy.direct = (w == srcrect->w && swdata->target_bytes != 3 &&
+                   !(srcrect->x & 1) && !(srcrect->w & 1));
+    if (!copy.direct) {
+        int i;
+
+        if (w > swdata->xmap_size) {
+            int *xmap = (int *) SDL_realloc(swdata->xmap, w * sizeof(int));
+            if (!xmap) {
+                SDL_OutOfMemory();
+                return -1;
             }
+            swdata->xmap = xmap;
+            swdata->xmap_size = w;
         }
-        if (!swdata->stretch) {
-            /* This must have succeeded in SDL_SW_SetupYUVDisplay() earlier */
-            SDL_PixelFormatEnumToMasks(target_format, &bpp, &Rmask, &Gmask,
-                                       &Bmask, &Amask);
-            swdata->stretch =
-                SDL_CreateRGBSurface(0, swdata->w, swdata->h, bpp, Rmask,
-                                     Gmask, Bmask, Amask);
-            if (!swdata->stretch) {
-                return (-1);
-            }
+        for (i = 0; i < w; ++i) {
+            swdata->xmap[i] = (srcrect->x & 1) + (i * srcrect->w) / w;
         }
-        pixels = swdata->stretch->pixels;
-        pitch = swdata->stretch->pitch;
     }
-    switch (swdata->format) {
-    case SDL_PIXELFORMAT_YV12:
-        lum = swdata->planes[0];
-        Cr = swdata->planes[1];
-        Cb = swdata->planes[2];
-        break;
-    case SDL_PIXELFORMAT_IYUV:
-        lum = swdata->planes[0];
-        Cr = swdata->planes[2];
-        Cb = swdata->planes[1];
-        break;
-    case SDL_PIXELFORMAT_YUY2:
-        lum = swdata->planes[0];
-        Cr = lum + 3;
-        Cb = lum + 1;
-        break;
-    case SDL_PIXELFORMAT_UYVY:
-        lum = swdata->planes[0] + 1;
-        Cr = lum + 1;
-        Cb = lum - 1;
-        break;
-    case SDL_PIXELFORMAT_YVYU:
-        lum = swdata->planes[0];
-        Cr = lum + 1;
-        Cb = lum + 3;
-        break;
-    default:
-        SDL_SetError("Unsupported YUV format in copy");
-        return (-1);
-    }
-    mod = (pitch / SDL_BYTESPERPIXEL(target_format));
 
-    if (scale_2x) {
-        mod -= (swdata->w * 2);
-        swdata->Display2X(swdata->colortab, swdata->rgb_2_pix,
-                          lum, Cr, Cb, pixels, swdata->h, swdata->w, mod);
-    } else {
-        mod -= swdata->w;
-        swdata->Display1X(swdata->colortab, swdata->rgb_2_pix,
-                          lum, Cr, Cb, pixels, swdata->h, swdata->w, mod);
-    }
-    if (stretch) {
-        SDL_Rect rect = *srcrect;
-        SDL_SoftStretch(swdata->stretch, &rect, swdata->display, NULL);
+    /* Split big copies across the blit threads, if there are any.  The
+       rows work out their own source lines, so as far as the bands go
+       this is an unscaled blit. */
+    SDL_zero(info);
+    info.src = (Uint8 *) & copy;
+    info.src_h = h;
+    info.src_pitch = 0;
+    info.dst = copy.pixels;
+    info.dst_w = w;
+    info.dst_h = h;
+    info.dst_pitch = pitch;
+    {
+        SDL_PROFILE_BEGIN("SDL_SW_CopyYUVToRGB in bands");
+        if (SDL_ThreadedBlit(SDL_SW_CopyYUVRows, &info)) {
+            SDL_PROFILE_END((Uint64) w * h);
+        } else {
+            SDL_SW_CopyYUVRows(&info);
+        }
     }
     return 0;
 }
@@ -1335,11 +958,8 @@ SDL_SW_DestroyYUVTexture(SDL_SW_YUVTexture * swdata)
         if (swdata->rgb_2_pix) {
             SDL_free(swdata->rgb_2_pix);
         }
-        if (swdata->stretch) {
-            SDL_FreeSurface(swdata->stretch);
-        }
-        if (swdata->display) {
-            SDL_FreeSurface(swdata->display);
+        if (swdata->xmap) {
+            SDL_free(swdata->xmap);
         }
         SDL_free(swdata);
     }
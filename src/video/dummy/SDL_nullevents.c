@@ -24,16 +24,75 @@
 /* Being a null driver, there's no event stream. We just define stubs for
    most of the API. */
 
+#include "SDL_mutex.h"
+#include "SDL_timer.h"
 #include "../../events/SDL_sysevents.h"
 #include "../../events/SDL_events_c.h"
 
 #include "SDL_nullvideo.h"
 #include "SDL_nullevents_c.h"
 
+/* The only events come from other threads, so waiting for them is just
+   sleeping until DUMMY_WakeEvents() is called. */
+static SDL_mutex *wait_lock = NULL;
+static SDL_cond *wait_cond = NULL;
+static int woken = 0;
+
+void
+DUMMY_InitEvents(_THIS)
+{
+    wait_lock = SDL_CreateMutex();
+    wait_cond = SDL_CreateCond();
+    woken = 0;
+}
+
 void
 DUMMY_PumpEvents(_THIS)
 {
     /* do nothing. */
 }
 
+void
+DUMMY_WaitEvents(_THIS, int timeout)
+{
+    if (!wait_lock || !wait_cond) {
+        SDL_Delay((timeout < 0 || timeout > 10) ? 10 : timeout);
+        return;
+    }
+    SDL_mutexP(wait_lock);
+    if (!woken) {
+        if (timeout < 0) {
+            SDL_CondWait(wait_cond, wait_lock);
+        } else {
+            SDL_CondWaitTimeout(wait_cond, wait_lock, timeout);
+        }
+    }
+    woken = 0;
+    SDL_mutexV(wait_lock);
+}
+
+void
+DUMMY_WakeEvents(_THIS)
+{
+    if (wait_lock && wait_cond) {
+        SDL_mutexP(wait_lock);
+        woken = 1;
+        SDL_CondSignal(wait_cond);
+        SDL_mutexV(wait_lock);
+    }
+}
+
+void
+DUMMY_QuitEvents(_THIS)
+{
+    if (wait_cond) {
+        SDL_DestroyCond(wait_cond);
+        wait_cond = NULL;
+    }
+    if (wait_lock) {
+        SDL_DestroyMutex(wait_lock);
+        wait_lock = NULL;
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
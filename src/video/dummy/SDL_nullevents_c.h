@@ -23,6 +23,10 @@
 
 #include "SDL_nullvideo.h"
 
+extern void DUMMY_InitEvents(_THIS);
 extern void DUMMY_PumpEvents(_THIS);
+extern void DUMMY_WaitEvents(_THIS, int timeout);
+extern void DUMMY_WakeEvents(_THIS);
+extern void DUMMY_QuitEvents(_THIS);
 
 /* vi: set ts=4 sw=4 expandtab: */
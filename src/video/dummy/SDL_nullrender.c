@@ -40,6 +40,16 @@ static int SDL_DUMMY_RenderCopy(SDL_Renderer * renderer,
                                 SDL_Texture * texture,
                                 const SDL_Rect * srcrect,
                                 const SDL_Rect * dstrect);
+static int SDL_DUMMY_RenderPoints(SDL_Renderer * renderer,
+                                  const SDL_Point * points, int count);
+static int SDL_DUMMY_RenderLines(SDL_Renderer * renderer,
+                                 const SDL_Point * points, int count);
+static int SDL_DUMMY_RenderFills(SDL_Renderer * renderer,
+                                 const SDL_Rect * rects, int count);
+static int SDL_DUMMY_RenderCopies(SDL_Renderer * renderer,
+                                  SDL_Texture * texture,
+                                  const SDL_Rect * srcrects,
+                                  const SDL_Rect * dstrects, int count);
 static void SDL_DUMMY_RenderPresent(SDL_Renderer * renderer);
 static void SDL_DUMMY_DestroyRenderer(SDL_Renderer * renderer);
 
@@ -95,6 +105,10 @@ SDL_DUMMY_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderLine = SDL_DUMMY_RenderLine;
     renderer->RenderFill = SDL_DUMMY_RenderFill;
     renderer->RenderCopy = SDL_DUMMY_RenderCopy;
+    renderer->RenderPoints = SDL_DUMMY_RenderPoints;
+    renderer->RenderLines = SDL_DUMMY_RenderLines;
+    renderer->RenderFills = SDL_DUMMY_RenderFills;
+    renderer->RenderCopies = SDL_DUMMY_RenderCopies;
     renderer->RenderPresent = SDL_DUMMY_RenderPresent;
     renderer->DestroyRenderer = SDL_DUMMY_DestroyRenderer;
     renderer->info.name = SDL_DUMMY_RenderDriver.info.name;
@@ -225,6 +239,107 @@ SDL_DUMMY_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     }
 }
 
+static int
+SDL_DUMMY_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points,
+                       int count)
+{
+    SDL_DUMMY_RenderData *data =
+        (SDL_DUMMY_RenderData *) renderer->driverdata;
+    SDL_Surface *target = data->screens[data->current_screen];
+
+    if (renderer->blendMode == SDL_BLENDMODE_NONE ||
+        renderer->blendMode == SDL_BLENDMODE_MASK) {
+        Uint32 color =
+            SDL_MapRGBA(target->format, renderer->r, renderer->g, renderer->b,
+                        renderer->a);
+
+        return SDL_DrawPoints(target, points, count, color);
+    } else {
+        return SDL_BlendPoints(target, points, count, renderer->blendMode,
+                               renderer->r, renderer->g, renderer->b,
+                               renderer->a);
+    }
+}
+
+static int
+SDL_DUMMY_RenderLines(SDL_Renderer * renderer, const SDL_Point * points,
+                      int count)
+{
+    SDL_DUMMY_RenderData *data =
+        (SDL_DUMMY_RenderData *) renderer->driverdata;
+    SDL_Surface *target = data->screens[data->current_screen];
+    Uint32 color = 0;
+    int i;
+    int status = 0;
+
+    if (renderer->blendMode == SDL_BLENDMODE_NONE ||
+        renderer->blendMode == SDL_BLENDMODE_MASK) {
+        color = SDL_MapRGBA(target->format, renderer->r, renderer->g,
+                            renderer->b, renderer->a);
+    }
+    for (i = 0; i < count && status == 0; ++i) {
+        const SDL_Point *p = &points[2 * i];
+
+        if (renderer->blendMode == SDL_BLENDMODE_NONE ||
+            renderer->blendMode == SDL_BLENDMODE_MASK) {
+            status = SDL_DrawLine(target, p[0].x, p[0].y, p[1].x, p[1].y,
+                                  color);
+        } else {
+            status =
+                SDL_BlendLine(target, p[0].x, p[0].y, p[1].x, p[1].y,
+                              renderer->blendMode, renderer->r, renderer->g,
+                              renderer->b, renderer->a);
+        }
+    }
+    return status;
+}
+
+static int
+SDL_DUMMY_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects,
+                      int count)
+{
+    SDL_DUMMY_RenderData *data =
+        (SDL_DUMMY_RenderData *) renderer->driverdata;
+    SDL_Surface *target = data->screens[data->current_screen];
+    Uint32 color = 0;
+    int i;
+    int status = 0;
+
+    if (renderer->blendMode == SDL_BLENDMODE_NONE) {
+        color = SDL_MapRGBA(target->format, renderer->r, renderer->g,
+                            renderer->b, renderer->a);
+    }
+    for (i = 0; i < count && status == 0; ++i) {
+        SDL_Rect real_rect = rects[i];
+
+        if (renderer->blendMode == SDL_BLENDMODE_NONE) {
+            status = SDL_FillRect(target, &real_rect, color);
+        } else {
+            status =
+                SDL_BlendRect(target, &real_rect, renderer->blendMode,
+                              renderer->r, renderer->g, renderer->b,
+                              renderer->a);
+        }
+    }
+    return status;
+}
+
+static int
+SDL_DUMMY_RenderCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+                       const SDL_Rect * srcrects, const SDL_Rect * dstrects,
+                       int count)
+{
+    int i;
+    int status = 0;
+
+    for (i = 0; i < count && status == 0; ++i) {
+        status =
+            SDL_DUMMY_RenderCopy(renderer, texture, &srcrects[i],
+                                 &dstrects[i]);
+    }
+    return status;
+}
+
 static void
 SDL_DUMMY_RenderPresent(SDL_Renderer * renderer)
 {
@@ -92,6 +92,8 @@ DUMMY_CreateDevice(int devindex)
     device->VideoQuit = DUMMY_VideoQuit;
     device->SetDisplayMode = DUMMY_SetDisplayMode;
     device->PumpEvents = DUMMY_PumpEvents;
+    device->WaitEvents = DUMMY_WaitEvents;
+    device->WakeEvents = DUMMY_WakeEvents;
 
     device->free = DUMMY_DeleteDevice;
 
@@ -121,6 +123,8 @@ DUMMY_VideoInit(_THIS)
     SDL_zero(mode);
     SDL_AddDisplayMode(0, &mode);
 
+    DUMMY_InitEvents(_this);
+
     /* We're done! */
     return 0;
 }
@@ -134,6 +138,7 @@ DUMMY_SetDisplayMode(_THIS, SDL_DisplayMode * mode)
 void
 DUMMY_VideoQuit(_THIS)
 {
+    DUMMY_QuitEvents(_this);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
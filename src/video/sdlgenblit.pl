@@ -76,6 +76,21 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# The channel held in each byte of a pixel, lowest address first,
+# used to build the SSE2 shuffles.  'x' is an unused byte.
+my %format_lanes = (
+    "RGB888" => "BGRx",
+    "BGR888" => "RGBx",
+    "ARGB8888" => "BGRA",
+    "RGBA8888" => "ABGR",
+    "ABGR8888" => "RGBA",
+    "BGRA8888" => "ARGB",
+);
+
+# The SSE2 blitters work on pixels unpacked to 16 bits per channel,
+# with the channels rearranged into this order.
+my $sse2_lanes = "BGRA";
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -158,6 +173,230 @@ sub output_copyfuncname
     print FILE "$suffix";
 }
 
+sub output_copyfuncname_sse2
+{
+    my $prefix = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $suffix = shift;
+
+    print FILE "$prefix SDL_Blit_${src}_${dst}";
+    if ( $modulate ) {
+        print FILE "_Modulate";
+    }
+    if ( $blend ) {
+        print FILE "_Blend";
+    }
+    print FILE "_SSE2$suffix";
+}
+
+# Return the _MM_SHUFFLE() arguments that move the channels from one
+# lane order to another, or "" if they're already in place.
+sub get_shuffle_sse2
+{
+    my $from = shift;
+    my $to = shift;
+    my @lanes;
+
+    $from =~ s/x/A/;
+    $to =~ s/x/A/;
+    for (my $i = 3; $i >= 0; --$i) {
+        push(@lanes, index($from, substr($to, $i, 1)));
+    }
+    if ( join(",", @lanes) eq "3,2,1,0" ) {
+        return "";
+    }
+    return join(", ", @lanes);
+}
+
+sub shuffle_sse2
+{
+    my $var = shift;
+    my $from = shift;
+    my $to = shift;
+    my $shuffle = get_shuffle_sse2($from, $to);
+
+    if ( $shuffle ne "" ) {
+        print FILE <<__EOF__;
+    $var = _mm_shufflelo_epi16($var, _MM_SHUFFLE($shuffle));
+    $var = _mm_shufflehi_epi16($var, _MM_SHUFFLE($shuffle));
+__EOF__
+    }
+}
+
+sub output_copycore_sse2
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    output_copyfuncname_sse2("static __inline__ __m128i", $src, $dst, $modulate, $blend, "_Pixels");
+    if ( $blend ) {
+        print FILE "(__m128i src, __m128i dst, const int flags, const __m128i modulate)\n";
+    } else {
+        print FILE "(__m128i src, const int flags, const __m128i modulate)\n";
+    }
+    print FILE <<__EOF__;
+{
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    const __m128i zero = _mm_setzero_si128();
+    __m128i srcA, result;
+
+__EOF__
+    }
+    shuffle_sse2("src", $format_lanes{$src}, $sse2_lanes);
+    if ( $format_lanes{$src} =~ /x/ ) {
+        print FILE <<__EOF__;
+    src = _mm_or_si128(src, SDL_ALPHA_SSE2);
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    if (flags & (SDL_COPY_MODULATE_COLOR|SDL_COPY_MODULATE_ALPHA)) {
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, modulate));
+    }
+__EOF__
+    }
+    if ( $blend ) {
+        shuffle_sse2("dst", $format_lanes{$dst}, $sse2_lanes);
+        print FILE <<__EOF__;
+    srcA = _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3));
+    srcA = _mm_shufflehi_epi16(srcA, _MM_SHUFFLE(3, 3, 3, 3));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        /* This goes away if we ever use premultiplied alpha */
+        src = SDL_DIV255_SSE2(_mm_mullo_epi16(src, _mm_or_si128(_mm_and_si128(srcA, SDL_RGBMASK_SSE2), SDL_ALPHA_SSE2)));
+    }
+    switch (flags & (SDL_COPY_MASK|SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_MASK:
+        result = _mm_cmpeq_epi16(srcA, zero);
+        result = _mm_or_si128(_mm_and_si128(result, dst), _mm_andnot_si128(result, src));
+        break;
+    case SDL_COPY_BLEND:
+        result = _mm_sub_epi16(_mm_set1_epi16(255), srcA);
+        result = _mm_add_epi16(src, SDL_DIV255_SSE2(_mm_mullo_epi16(result, dst)));
+        break;
+    case SDL_COPY_ADD:
+        /* The final pack saturates this to 255 */
+        result = _mm_add_epi16(src, dst);
+        break;
+    case SDL_COPY_MOD:
+        result = SDL_DIV255_SSE2(_mm_mullo_epi16(src, dst));
+        break;
+    default:
+        result = dst;
+        break;
+    }
+    /* The destination alpha is left alone */
+    src = _mm_or_si128(_mm_and_si128(result, SDL_RGBMASK_SSE2), _mm_andnot_si128(SDL_RGBMASK_SSE2, dst));
+__EOF__
+    }
+    if ( $format_lanes{$dst} =~ /x/ ) {
+        print FILE <<__EOF__;
+    src = _mm_and_si128(src, SDL_RGBMASK_SSE2);
+__EOF__
+    }
+    shuffle_sse2("src", $sse2_lanes, $format_lanes{$dst});
+    print FILE <<__EOF__;
+    return src;
+}
+
+__EOF__
+}
+
+sub output_copyfunc_sse2
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+
+    output_copycore_sse2($src, $dst, $modulate, $blend);
+
+    output_copyfuncname_sse2("static void", $src, $dst, $modulate, $blend, "(SDL_BlitInfo *info)\n");
+    print FILE <<__EOF__;
+{
+    const int flags = info->flags;
+    const __m128i zero = _mm_setzero_si128();
+__EOF__
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    const __m128i modulate = SDL_Blit_Modulate_SSE2(info);
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    const __m128i modulate = zero;
+__EOF__
+    }
+    print FILE <<__EOF__;
+    __m128i srcpixels, lo, hi;
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    __m128i dstpixels;
+__EOF__
+    }
+    print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        $format_type{$src} *src = ($format_type{$src} *)info->src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        while (n >= 4) {
+            srcpixels = _mm_loadu_si128((__m128i *)src);
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            dstpixels = _mm_loadu_si128((__m128i *)dst);
+__EOF__
+    }
+    foreach my $half ("lo", "hi") {
+        print FILE "            $half =";
+        output_copyfuncname_sse2("", $src, $dst, $modulate, $blend, "_Pixels");
+        print FILE "(_mm_unpack${half}_epi8(srcpixels, zero), ";
+        if ( $blend ) {
+            print FILE "_mm_unpack${half}_epi8(dstpixels, zero), ";
+        }
+        print FILE "flags, modulate);\n";
+    }
+    print FILE <<__EOF__;
+            _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(lo, hi));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            srcpixels = _mm_cvtsi32_si128(*src);
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            dstpixels = _mm_cvtsi32_si128(*dst);
+__EOF__
+    }
+    print FILE "            lo =";
+    output_copyfuncname_sse2("", $src, $dst, $modulate, $blend, "_Pixels");
+    print FILE "(_mm_unpacklo_epi8(srcpixels, zero), ";
+    if ( $blend ) {
+        print FILE "_mm_unpacklo_epi8(dstpixels, zero), ";
+    }
+    print FILE "flags, modulate);\n";
+    print FILE <<__EOF__;
+            *dst = _mm_cvtsi128_si32(_mm_packus_epi16(lo, zero));
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+}
+
 sub get_rgba
 {
     my $prefix = shift;
@@ -385,6 +624,39 @@ sub output_copyinc
 __EOF__
 }
 
+sub output_copyinc_sse2
+{
+    print FILE <<__EOF__;
+#ifdef __SSE2__
+
+/* Exact (x / 255) for each unsigned 16-bit lane */
+#define SDL_DIV255_SSE2(x) \\
+    _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7)
+
+/* Lanes holding the color channels and the alpha channel of two pixels */
+#define SDL_RGBMASK_SSE2 _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1)
+#define SDL_ALPHA_SSE2 _mm_set_epi16(0xFF, 0, 0, 0, 0xFF, 0, 0, 0)
+
+static __inline__ __m128i SDL_Blit_Modulate_SSE2(const SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    short r = 255, g = 255, b = 255, a = 255;
+
+    /* Modulating by 255 leaves a channel unchanged */
+    if (flags & SDL_COPY_MODULATE_COLOR) {
+        r = info->r;
+        g = info->g;
+        b = info->b;
+    }
+    if (flags & SDL_COPY_MODULATE_ALPHA) {
+        a = info->a;
+    }
+    return _mm_set_epi16(a, r, g, b, a, r, g, b);
+}
+
+__EOF__
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -394,6 +666,26 @@ __EOF__
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
             my $dst = $dst_formats[$j];
+            print FILE "#ifdef __SSE2__\n";
+            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                for (my $blend = 0; $blend <= 1; ++$blend) {
+                    if ( $modulate || $blend ) {
+                        print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, (";
+                        if ( $modulate ) {
+                            print FILE "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
+                        }
+                        if ( $modulate && $blend ) {
+                            print FILE " | ";
+                        }
+                        if ( $blend ) {
+                            print FILE "SDL_COPY_MASK | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
+                        }
+                        print FILE "), SDL_CPU_SSE2,";
+                        output_copyfuncname_sse2("", $src, $dst, $modulate, $blend, " },\n");
+                    }
+                }
+            }
+            print FILE "#endif\n";
             for (my $modulate = 0; $modulate <= 1; ++$modulate) {
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
@@ -459,6 +751,20 @@ sub output_copyfunc_c
     }
 }
 
+sub output_copyfunc_c_sse2
+{
+    my $src = shift;
+    my $dst = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            if ( $modulate || $blend ) {
+                output_copyfunc_sse2($src, $dst, $modulate, $blend);
+            }
+        }
+    }
+}
+
 open_file("SDL_blit_auto.h");
 output_copydefs();
 for (my $i = 0; $i <= $#src_formats; ++$i) {
@@ -476,5 +782,12 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_copyinc_sse2();
+for (my $i = 0; $i <= $#src_formats; ++$i) {
+    for (my $j = 0; $j <= $#dst_formats; ++$j) {
+        output_copyfunc_c_sse2($src_formats[$i], $dst_formats[$j]);
+    }
+}
+print FILE "#endif /* __SSE2__ */\n\n";
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -83,7 +83,7 @@ SDL_RenderDriver GDI_RenderDriver = {
      (SDL_TEXTUREMODULATE_NONE | SDL_TEXTUREMODULATE_ALPHA),
      (SDL_BLENDMODE_NONE | SDL_BLENDMODE_MASK),
      (SDL_TEXTURESCALEMODE_NONE | SDL_TEXTURESCALEMODE_FAST),
-     14,
+     16,
      {
       SDL_PIXELFORMAT_INDEX8,
       SDL_PIXELFORMAT_RGB555,
@@ -98,7 +98,9 @@ SDL_RenderDriver GDI_RenderDriver = {
       SDL_PIXELFORMAT_IYUV,
       SDL_PIXELFORMAT_YUY2,
       SDL_PIXELFORMAT_UYVY,
-      SDL_PIXELFORMAT_YVYU},
+      SDL_PIXELFORMAT_YVYU,
+      SDL_PIXELFORMAT_NV12,
+      SDL_PIXELFORMAT_NV21},
      0,
      0}
 };
@@ -247,6 +249,7 @@ GDI_CreateRenderer(SDL_Window * window, Uint32 flags)
         SelectObject(data->render_hdc, data->hbm[0]);
         data->current_hdc = data->render_hdc;
         data->makedirty = SDL_TRUE;
+        SDL_SetDirtyRectBounds(&data->dirty, window->w, window->h);
     } else {
         data->current_hdc = data->window_hdc;
         data->makedirty = SDL_FALSE;
@@ -288,6 +291,7 @@ GDI_DisplayModeChanged(SDL_Renderer * renderer)
     }
     if (n > 0) {
         SelectObject(data->render_hdc, data->hbm[0]);
+        SDL_SetDirtyRectBounds(&data->dirty, window->w, window->h);
     }
     data->current_hbm = 0;
 
@@ -826,7 +830,8 @@ GDI_RenderPresent(SDL_Renderer * renderer)
 
     /* Send the data to the display */
     if (!(renderer->info.flags & SDL_RENDERER_SINGLEBUFFER)) {
-        for (dirty = data->dirty.list; dirty; dirty = dirty->next) {
+        for (dirty = SDL_GetDirtyRects(&data->dirty); dirty;
+             dirty = dirty->next) {
             const SDL_Rect *rect = &dirty->rect;
             BitBlt(data->window_hdc, rect->x, rect->y, rect->w, rect->h,
                    data->render_hdc, rect->x, rect->y, SRCCOPY);
@@ -42,6 +42,10 @@
 #include <X11/extensions/Xrandr.h>
 #endif
 
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+
 #if SDL_VIDEO_DRIVER_X11_XINPUT
 #include <X11/extensions/XInput.h>
 #endif
@@ -23,6 +23,7 @@
 
 #include <sys/types.h>
 #include <sys/time.h>
+#include <poll.h>
 #include <unistd.h>
 
 #include "SDL_syswm.h"
@@ -409,6 +410,52 @@ X11_PumpEvents(_THIS)
     }
 }
 
+void
+X11_WaitEvents(_THIS, int timeout)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+    struct pollfd fds[2];
+    char buf[64];
+
+    /* Don't sleep on events Xlib has already read */
+    XFlush(data->display);
+    if (XEventsQueued(data->display, QueuedAlready)) {
+        return;
+    }
+
+    /* Wake up in time to keep the screensaver away */
+    if (_this->suspend_screensaver && (timeout < 0 || timeout > 30000)) {
+        timeout = 30000;
+    }
+    if (data->wakeup_pipe[0] < 0 && (timeout < 0 || timeout > 10)) {
+        timeout = 10;
+    }
+
+    fds[0].fd = ConnectionNumber(data->display);
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+    fds[1].fd = data->wakeup_pipe[0];
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+    if (poll(fds, 2, timeout) > 0 && (fds[1].revents & POLLIN)) {
+        while (read(data->wakeup_pipe[0], buf, sizeof(buf)) > 0) {
+            /* Empty the pipe */ ;
+        }
+    }
+}
+
+void
+X11_WakeEvents(_THIS)
+{
+    SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
+    const char c = 0;
+
+    /* If the pipe is full, a wakeup is already waiting anyway */
+    if (data->wakeup_pipe[1] >= 0) {
+        write(data->wakeup_pipe[1], &c, 1);
+    }
+}
+
 /* This is so wrong it hurts */
 #define GNOME_SCREENSAVER_HACK
 #ifdef GNOME_SCREENSAVER_HACK
@@ -25,6 +25,8 @@
 #define _SDL_x11events_h
 
 extern void X11_PumpEvents(_THIS);
+extern void X11_WaitEvents(_THIS, int timeout);
+extern void X11_WakeEvents(_THIS);
 extern void X11_SuspendScreenSaver(_THIS);
 
 #endif /* _SDL_x11events_h */
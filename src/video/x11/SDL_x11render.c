@@ -27,6 +27,7 @@
 #include "../SDL_rect_c.h"
 #include "../SDL_pixels_c.h"
 #include "../SDL_yuv_sw_c.h"
+#include "../SDL_alphamult.h"
 
 /* X11 renderer implementation */
 
@@ -52,6 +53,12 @@ static int X11_RenderPoint(SDL_Renderer * renderer, int x, int y);
 static int X11_RenderLine(SDL_Renderer * renderer, int x1, int y1, int x2,
                           int y2);
 static int X11_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect);
+static int X11_RenderPoints(SDL_Renderer * renderer,
+                            const SDL_Point * points, int count);
+static int X11_RenderLines(SDL_Renderer * renderer,
+                           const SDL_Point * points, int count);
+static int X11_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects,
+                           int count);
 static int X11_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * srcrect, const SDL_Rect * dstrect);
 static void X11_RenderPresent(SDL_Renderer * renderer);
@@ -91,6 +98,18 @@ typedef struct
     GC gc;
     SDL_DirtyRectList dirty;
     SDL_bool makedirty;
+#ifndef NO_SHARED_MEMORY
+    SDL_bool shm_pixmaps;
+#endif
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    SDL_bool use_xrender;
+    SDL_bool use_pad;           /* RepeatPad needs XRender 0.10 */
+    XRenderPictFormat *xwindow_format;
+    XRenderPictFormat *opaque_format;   /* 32-bit pixmaps without alpha */
+    Picture xwindow_pict;
+    Picture pixmap_picts[3];
+    Picture drawable_pict;
+#endif
 } X11_RenderData;
 
 typedef struct
@@ -106,6 +125,22 @@ typedef struct
     XImage *scaling_image;
     void *pixels;
     int pitch;
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    Picture picture;
+    Picture opaque;             /* The pixmap without alpha, or None */
+    /* Scaled copies of part of the texture are filtered from a copy of
+       just that part, so the filter doesn't reach the texels around it */
+    Pixmap part_pixmap;
+    Picture part_picture;
+    Picture part_opaque;
+    int part_w, part_h;
+    /* Textures with alpha are uploaded to a 32-bit pixmap from 'pixels' */
+    SDL_bool alpha;
+    SDL_bool premultiplied;
+    void *premultiplied_pixels; /* Where uploads are premultiplied */
+    GC gc;
+    SDL_Rect locked;
+#endif
 } X11_TextureData;
 
 #ifndef NO_SHARED_MEMORY
@@ -138,12 +173,220 @@ UpdateYUVTextureData(SDL_Texture * texture)
                         texture->h, data->pixels, data->pitch);
 }
 
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+static SDL_bool
+CheckXRender(Display * display, int *major, int *minor)
+{
+    const char *env;
+    int event_base, error_base;
+
+    /* Default the extension not available */
+    *major = *minor = 0;
+
+    /* Allow environment override */
+    env = SDL_getenv("SDL_VIDEO_X11_XRENDER");
+    if (env && !SDL_atoi(env)) {
+        return SDL_FALSE;
+    }
+
+    if (!SDL_X11_HAVE_XRENDER) {
+        return SDL_FALSE;
+    }
+
+    /* Picture transforms and filters need version 0.6 */
+    if (!XRenderQueryExtension(display, &event_base, &error_base) ||
+        !XRenderQueryVersion(display, major, minor)) {
+        return SDL_FALSE;
+    }
+    if (*major == 0 && *minor < 6) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+static void
+X11_CreateDrawablePictures(X11_RenderData * data)
+{
+    int i;
+
+    if (!data->use_xrender) {
+        return;
+    }
+    if (data->xwindow_pict == None) {
+        data->xwindow_pict =
+            XRenderCreatePicture(data->display, data->window,
+                                 data->xwindow_format, 0, NULL);
+    }
+    for (i = 0; i < SDL_arraysize(data->pixmaps); ++i) {
+        if (data->pixmaps[i] != None && data->pixmap_picts[i] == None) {
+            data->pixmap_picts[i] =
+                XRenderCreatePicture(data->display, data->pixmaps[i],
+                                     data->xwindow_format, 0, NULL);
+        }
+    }
+    if (data->drawable == data->window) {
+        data->drawable_pict = data->xwindow_pict;
+    } else {
+        data->drawable_pict = data->pixmap_picts[data->current_pixmap];
+    }
+}
+
+static void
+X11_FreePixmapPictures(X11_RenderData * data)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(data->pixmap_picts); ++i) {
+        if (data->pixmap_picts[i] != None) {
+            XRenderFreePicture(data->display, data->pixmap_picts[i]);
+            data->pixmap_picts[i] = None;
+        }
+    }
+}
+
+/* Make the pictures a texture is composited from.  Copies that don't
+   blend use the one without alpha, so they don't write the texture's alpha
+   into the drawable.  Filters pad the edges out instead of fading them to
+   transparent black.
+ */
+static void
+X11_CreateTexturePictures(X11_RenderData * data, SDL_bool alpha,
+                          Pixmap pixmap, Picture * picture, Picture * opaque)
+{
+    XRenderPictureAttributes attributes;
+    unsigned long mask = 0;
+
+    if (data->use_pad) {
+        attributes.repeat = RepeatPad;
+        mask |= CPRepeat;
+    }
+    *opaque = None;
+    if (alpha) {
+        *picture =
+            XRenderCreatePicture(data->display, pixmap,
+                                 XRenderFindStandardFormat(data->display,
+                                                           PictStandardARGB32),
+                                 mask, &attributes);
+        if (data->opaque_format) {
+            *opaque =
+                XRenderCreatePicture(data->display, pixmap,
+                                     data->opaque_format, mask, &attributes);
+        }
+    } else {
+        *picture =
+            XRenderCreatePicture(data->display, pixmap, data->xwindow_format,
+                                 mask, &attributes);
+    }
+}
+
+static void
+X11_FreeTexturePart(X11_RenderData * renderdata, X11_TextureData * data)
+{
+    if (data->part_picture != None) {
+        XRenderFreePicture(renderdata->display, data->part_picture);
+        data->part_picture = None;
+    }
+    if (data->part_opaque != None) {
+        XRenderFreePicture(renderdata->display, data->part_opaque);
+        data->part_opaque = None;
+    }
+    if (data->part_pixmap != None) {
+        XFreePixmap(renderdata->display, data->part_pixmap);
+        data->part_pixmap = None;
+    }
+    data->part_w = 0;
+    data->part_h = 0;
+}
+
+/* Copy 'srcrect' of the texture to a pixmap of its own */
+static int
+X11_CopyTexturePart(X11_RenderData * renderdata, X11_TextureData * data,
+                    const SDL_Rect * srcrect)
+{
+    if (data->part_w != srcrect->w || data->part_h != srcrect->h) {
+        X11_FreeTexturePart(renderdata, data);
+        data->part_pixmap =
+            XCreatePixmap(renderdata->display, renderdata->window, srcrect->w,
+                          srcrect->h, data->alpha ? 32 : renderdata->depth);
+        if (data->part_pixmap == None) {
+            SDL_SetError("XCreatePixmap() failed");
+            return -1;
+        }
+        X11_CreateTexturePictures(renderdata, data->alpha, data->part_pixmap,
+                                  &data->part_picture, &data->part_opaque);
+        data->part_w = srcrect->w;
+        data->part_h = srcrect->h;
+    }
+    XCopyArea(renderdata->display, data->pixmap, data->part_pixmap,
+              data->alpha ? data->gc : renderdata->gc, srcrect->x,
+              srcrect->y, srcrect->w, srcrect->h, 0, 0);
+    return 0;
+}
+
+/* Copy part of a texture with alpha to its pixmap, premultiplied when the
+   texture is blended, which is what XRender expects.
+ */
+static int
+X11_UploadTexture(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Rect * rect)
+{
+    X11_RenderData *renderdata = (X11_RenderData *) renderer->driverdata;
+    X11_TextureData *data = (X11_TextureData *) texture->driverdata;
+    Uint8 *src;
+    void *pixels;
+    int pitch;
+
+    if (rect->w <= 0 || rect->h <= 0) {
+        return 0;
+    }
+    src = (Uint8 *) data->pixels + rect->y * data->pitch + rect->x * 4;
+    if (data->premultiplied) {
+        Uint8 *dst;
+        int row;
+
+        if (!data->premultiplied_pixels) {
+            data->premultiplied_pixels =
+                SDL_malloc(texture->w * texture->h * 4);
+            if (!data->premultiplied_pixels) {
+                SDL_OutOfMemory();
+                return -1;
+            }
+        }
+        pitch = rect->w * 4;
+        pixels = data->premultiplied_pixels;
+        dst = (Uint8 *) pixels;
+        for (row = 0; row < rect->h; ++row) {
+            SDL_memcpy(dst, src, pitch);
+            src += data->pitch;
+            dst += pitch;
+        }
+        SDL_PreMultiplyAlphaARGB8888(rect->w, rect->h, (Uint32 *) pixels,
+                                     pitch);
+    } else {
+        pixels = src;
+        pitch = data->pitch;
+    }
+
+    data->image->width = rect->w;
+    data->image->height = rect->h;
+    data->image->data = (char *) pixels;
+    data->image->bytes_per_line = pitch;
+    XPutImage(renderdata->display, data->pixmap, data->gc, data->image, 0, 0,
+              rect->x, rect->y, rect->w, rect->h);
+    data->image->data = NULL;
+    return 0;
+}
+#endif /* SDL_VIDEO_DRIVER_X11_XRENDER */
+
 void
 X11_AddRenderDriver(_THIS)
 {
     SDL_VideoData *data = (SDL_VideoData *) _this->driverdata;
     SDL_RendererInfo *info = &X11_RenderDriver.info;
     SDL_DisplayMode *mode = &SDL_CurrentDisplay.desktop_mode;
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    int major, minor;
+#endif
 
     info->texture_formats[info->num_texture_formats++] = mode->format;
     info->texture_formats[info->num_texture_formats++] = SDL_PIXELFORMAT_YV12;
@@ -151,6 +394,22 @@ X11_AddRenderDriver(_THIS)
     info->texture_formats[info->num_texture_formats++] = SDL_PIXELFORMAT_YUY2;
     info->texture_formats[info->num_texture_formats++] = SDL_PIXELFORMAT_UYVY;
     info->texture_formats[info->num_texture_formats++] = SDL_PIXELFORMAT_YVYU;
+    info->texture_formats[info->num_texture_formats++] = SDL_PIXELFORMAT_NV12;
+    info->texture_formats[info->num_texture_formats++] = SDL_PIXELFORMAT_NV21;
+
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    /* XRender can blend and scale, and takes textures with alpha */
+    if (CheckXRender(data->display, &major, &minor)) {
+        if (mode->format != SDL_PIXELFORMAT_ARGB8888) {
+            info->texture_formats[info->num_texture_formats++] =
+                SDL_PIXELFORMAT_ARGB8888;
+        }
+        info->blend_modes |= (SDL_BLENDMODE_BLEND | SDL_BLENDMODE_ADD);
+        info->scale_modes |=
+            (SDL_TEXTURESCALEMODE_FAST | SDL_TEXTURESCALEMODE_SLOW |
+             SDL_TEXTURESCALEMODE_BEST);
+    }
+#endif
 
     SDL_AddRenderDriver(0, &X11_RenderDriver);
 }
@@ -168,6 +427,9 @@ X11_CreateRenderer(SDL_Window * window, Uint32 flags)
     int i, n;
     int bpp;
     Uint32 Rmask, Gmask, Bmask, Amask;
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    int major, minor;
+#endif
 
     renderer = (SDL_Renderer *) SDL_calloc(1, sizeof(*renderer));
     if (!renderer) {
@@ -201,6 +463,9 @@ X11_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderLine = X11_RenderLine;
     renderer->RenderFill = X11_RenderFill;
     renderer->RenderCopy = X11_RenderCopy;
+    renderer->RenderPoints = X11_RenderPoints;
+    renderer->RenderLines = X11_RenderLines;
+    renderer->RenderFills = X11_RenderFills;
     renderer->RenderPresent = X11_RenderPresent;
     renderer->DestroyTexture = X11_DestroyTexture;
     renderer->DestroyRenderer = X11_DestroyRenderer;
@@ -237,6 +502,7 @@ X11_CreateRenderer(SDL_Window * window, Uint32 flags)
     if (n > 0) {
         data->drawable = data->pixmaps[0];
         data->makedirty = SDL_TRUE;
+        SDL_SetDirtyRectBounds(&data->dirty, window->w, window->h);
     } else {
         data->drawable = data->window;
         data->makedirty = SDL_FALSE;
@@ -263,6 +529,53 @@ X11_CreateRenderer(SDL_Window * window, Uint32 flags)
         return NULL;
     }
 
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    if (CheckXRender(data->display, &major, &minor)) {
+        data->xwindow_format =
+            XRenderFindVisualFormat(data->display, data->visual);
+        if (data->xwindow_format) {
+            XRenderPictFormat templ;
+
+            data->use_xrender = SDL_TRUE;
+            data->use_pad = (major > 0 || minor >= 10);
+
+            /* x8r8g8b8, for copying textures with alpha without it */
+            SDL_zero(templ);
+            templ.type = PictTypeDirect;
+            templ.depth = 32;
+            templ.direct.red = 16;
+            templ.direct.redMask = 0xFF;
+            templ.direct.green = 8;
+            templ.direct.greenMask = 0xFF;
+            templ.direct.blue = 0;
+            templ.direct.blueMask = 0xFF;
+            templ.direct.alphaMask = 0;
+            data->opaque_format =
+                XRenderFindFormat(data->display,
+                                  PictFormatType | PictFormatDepth |
+                                  PictFormatRed | PictFormatRedMask |
+                                  PictFormatGreen | PictFormatGreenMask |
+                                  PictFormatBlue | PictFormatBlueMask |
+                                  PictFormatAlphaMask, &templ, 0);
+        }
+    }
+    X11_CreateDrawablePictures(data);
+
+#ifndef NO_SHARED_MEMORY
+    /* Streaming textures in pixmaps that share memory with us can be
+       composited without uploading them.
+     */
+    if (data->use_xrender && SDL_X11_HAVE_SHM) {
+        Bool pixmaps = False;
+
+        if (XShmQueryVersion(data->display, &major, &minor, &pixmaps) &&
+            pixmaps && XShmPixmapFormat(data->display) == ZPixmap) {
+            data->shm_pixmaps = SDL_TRUE;
+        }
+    }
+#endif
+#endif /* SDL_VIDEO_DRIVER_X11_XRENDER */
+
     return renderer;
 }
 
@@ -282,6 +595,9 @@ X11_DisplayModeChanged(SDL_Renderer * renderer)
     } else {
         n = 1;
     }
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    X11_FreePixmapPictures(data);
+#endif
     for (i = 0; i < n; ++i) {
         if (data->pixmaps[i] != None) {
             XFreePixmap(data->display, data->pixmaps[i]);
@@ -299,8 +615,12 @@ X11_DisplayModeChanged(SDL_Renderer * renderer)
     }
     if (n > 0) {
         data->drawable = data->pixmaps[0];
+        SDL_SetDirtyRectBounds(&data->dirty, window->w, window->h);
     }
     data->current_pixmap = 0;
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    X11_CreateDrawablePictures(data);
+#endif
 
     return 0;
 }
@@ -332,7 +652,15 @@ X11_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
     } else {
         /* The image/pixmap depth must be the same as the window or you
            get a BadMatch error when trying to putimage or copyarea.
+           XRender composites textures with alpha from 32-bit pixmaps.
          */
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+        if (renderdata->use_xrender
+            && texture->format == SDL_PIXELFORMAT_ARGB8888
+            && texture->format != display->current_mode.format) {
+            data->alpha = SDL_TRUE;
+        } else
+#endif
         if (texture->format != display->current_mode.format) {
             SDL_SetError("Texture format doesn't match window format");
             return -1;
@@ -342,6 +670,47 @@ X11_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
     data->pitch = texture->w * SDL_BYTESPERPIXEL(data->format);
     data->pitch = (data->pitch + pitch_alignmask) & ~pitch_alignmask;
 
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    if (data->alpha) {
+        XGCValues gcv;
+
+        data->pixels = SDL_malloc(texture->h * data->pitch);
+        if (!data->pixels) {
+            X11_DestroyTexture(renderer, texture);
+            SDL_OutOfMemory();
+            return -1;
+        }
+        data->pixmap =
+            XCreatePixmap(renderdata->display, renderdata->window, texture->w,
+                          texture->h, 32);
+        if (data->pixmap == None) {
+            X11_DestroyTexture(renderer, texture);
+            SDL_SetError("XCreatePixmap() failed");
+            return -1;
+        }
+        gcv.graphics_exposures = False;
+        data->gc =
+            XCreateGC(renderdata->display, data->pixmap, GCGraphicsExposures,
+                      &gcv);
+        if (!data->gc) {
+            X11_DestroyTexture(renderer, texture);
+            SDL_SetError("XCreateGC() failed");
+            return -1;
+        }
+        data->image =
+            XCreateImage(renderdata->display, renderdata->visual, 32, ZPixmap,
+                         0, NULL, texture->w, texture->h, 32, data->pitch);
+        if (!data->image) {
+            X11_DestroyTexture(renderer, texture);
+            SDL_SetError("XCreateImage() failed");
+            return -1;
+        }
+        X11_CreateTexturePictures(renderdata, SDL_TRUE, data->pixmap,
+                                  &data->picture, &data->opaque);
+        return 0;
+    }
+#endif
+
     if (data->yuv || texture->access == SDL_TEXTUREACCESS_STREAMING) {
 #ifndef NO_SHARED_MEMORY
         XShmSegmentInfo *shminfo = &data->shminfo;
@@ -380,6 +749,11 @@ X11_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
                 XSync(renderdata->display, False);
                 shmdt(shminfo->shmaddr);
                 shm_error = True;
+            } else if (renderdata->shm_pixmaps) {
+                data->pixmap =
+                    XShmCreatePixmap(renderdata->display, renderdata->window,
+                                     shminfo->shmaddr, shminfo, texture->w,
+                                     texture->h, renderdata->depth);
             }
         }
         if (shm_error) {
@@ -429,6 +803,12 @@ X11_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
         }
     }
 
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    if (renderdata->use_xrender && data->pixmap != None) {
+        X11_CreateTexturePictures(renderdata, SDL_FALSE, data->pixmap,
+                                  &data->picture, &data->opaque);
+    }
+#endif
     return 0;
 }
 
@@ -440,6 +820,11 @@ X11_QueryTexturePixels(SDL_Renderer * renderer, SDL_Texture * texture,
 
     if (data->yuv) {
         return SDL_SW_QueryYUVTexturePixels(data->yuv, pixels, pitch);
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    } else if (data->alpha) {
+        SDL_SetError("Texture pixels are only uploaded when unlocked");
+        return -1;
+#endif
     } else {
         *pixels = data->pixels;
         *pitch = data->pitch;
@@ -450,14 +835,43 @@ X11_QueryTexturePixels(SDL_Renderer * renderer, SDL_Texture * texture,
 static int
 X11_SetTextureBlendMode(SDL_Renderer * renderer, SDL_Texture * texture)
 {
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    X11_TextureData *data = (X11_TextureData *) texture->driverdata;
+    SDL_bool premultiplied = SDL_FALSE;
+#endif
+
     switch (texture->blendMode) {
     case SDL_BLENDMODE_NONE:
-        return 0;
+        break;
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_ADD:
+        if (data->picture) {
+            premultiplied = SDL_TRUE;
+            break;
+        }
+        /* Fall through to unsupported case */
+#endif
     default:
         SDL_Unsupported();
         texture->blendMode = SDL_BLENDMODE_NONE;
         return -1;
     }
+
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    /* Keep the pixmap of a texture with alpha the way it's composited */
+    if (data->alpha && data->premultiplied != premultiplied) {
+        SDL_Rect rect;
+
+        data->premultiplied = premultiplied;
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = texture->w;
+        rect.h = texture->h;
+        return X11_UploadTexture(renderer, texture, &rect);
+    }
+#endif
+    return 0;
 }
 
 static int
@@ -465,6 +879,24 @@ X11_SetTextureScaleMode(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     X11_TextureData *data = (X11_TextureData *) texture->driverdata;
 
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    /* XRender does the scaling for textures in pictures, the filter is
+       set on whichever picture a scaled copy comes from */
+    if (data->picture) {
+        switch (texture->scaleMode) {
+        case SDL_TEXTURESCALEMODE_NONE:
+        case SDL_TEXTURESCALEMODE_FAST:
+        case SDL_TEXTURESCALEMODE_SLOW:
+        case SDL_TEXTURESCALEMODE_BEST:
+            return 0;
+        default:
+            SDL_Unsupported();
+            texture->scaleMode = SDL_TEXTURESCALEMODE_NONE;
+            return -1;
+        }
+    }
+#endif
+
     switch (texture->scaleMode) {
     case SDL_TEXTURESCALEMODE_NONE:
         return 0;
@@ -474,6 +906,13 @@ X11_SetTextureScaleMode(SDL_Renderer * renderer, SDL_Texture * texture)
             return 0;
         }
         /* Fall through to unsupported case */
+    case SDL_TEXTURESCALEMODE_SLOW:
+        /* Streaming textures with 32-bit pixels can be filtered */
+        if (!data->yuv && texture->access == SDL_TEXTUREACCESS_STREAMING
+            && SDL_BYTESPERPIXEL(data->format) == 4) {
+            return 0;
+        }
+        /* Fall through to unsupported case */
     default:
         SDL_Unsupported();
         texture->scaleMode = SDL_TEXTURESCALEMODE_NONE;
@@ -512,6 +951,11 @@ X11_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                 src += pitch;
                 dst += data->pitch;
             }
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+            if (data->alpha) {
+                return X11_UploadTexture(renderer, texture, rect);
+            }
+#endif
         } else {
             data->image->width = rect->w;
             data->image->height = rect->h;
@@ -535,6 +979,11 @@ X11_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
         return SDL_SW_LockYUVTexture(data->yuv, rect, markDirty, pixels,
                                      pitch);
     } else if (data->pixels) {
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+        if (data->alpha) {
+            data->locked = *rect;
+        }
+#endif
         *pixels =
             (void *) ((Uint8 *) data->pixels + rect->y * data->pitch +
                       rect->x * SDL_BYTESPERPIXEL(texture->format));
@@ -555,6 +1004,12 @@ X11_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture)
         SDL_SW_UnlockYUVTexture(data->yuv);
         UpdateYUVTextureData(texture);
     }
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    if (data->alpha) {
+        X11_UploadTexture(renderer, texture, &data->locked);
+        SDL_zero(data->locked);
+    }
+#endif
 }
 
 static int
@@ -657,6 +1112,110 @@ X11_RenderFill(SDL_Renderer * renderer, const SDL_Rect * rect)
     return 0;
 }
 
+static int
+X11_RenderPoints(SDL_Renderer * renderer, const SDL_Point * points,
+                 int count)
+{
+    X11_RenderData *data = (X11_RenderData *) renderer->driverdata;
+    unsigned long foreground;
+    XPoint *xpoints;
+    int i;
+
+    if (data->makedirty) {
+        SDL_Rect rect;
+
+        if (SDL_EnclosePoints(points, count, NULL, &rect)) {
+            SDL_AddDirtyRect(&data->dirty, &rect);
+        }
+    }
+
+    xpoints = (XPoint *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * sizeof(*xpoints));
+    if (!xpoints) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        xpoints[i].x = points[i].x;
+        xpoints[i].y = points[i].y;
+    }
+
+    foreground = renderdrawcolor(renderer, 1);
+    XSetForeground(data->display, data->gc, foreground);
+    XDrawPoints(data->display, data->drawable, data->gc, xpoints, count,
+                CoordModeOrigin);
+    return 0;
+}
+
+static int
+X11_RenderLines(SDL_Renderer * renderer, const SDL_Point * points,
+                int count)
+{
+    X11_RenderData *data = (X11_RenderData *) renderer->driverdata;
+    unsigned long foreground;
+    XSegment *segments;
+    int i;
+
+    if (data->makedirty) {
+        SDL_Rect rect;
+
+        if (SDL_EnclosePoints(points, 2 * count, NULL, &rect)) {
+            SDL_AddDirtyRect(&data->dirty, &rect);
+        }
+    }
+
+    segments = (XSegment *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * sizeof(*segments));
+    if (!segments) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        segments[i].x1 = points[2 * i].x;
+        segments[i].y1 = points[2 * i].y;
+        segments[i].x2 = points[2 * i + 1].x;
+        segments[i].y2 = points[2 * i + 1].y;
+    }
+
+    foreground = renderdrawcolor(renderer, 1);
+    XSetForeground(data->display, data->gc, foreground);
+    XDrawSegments(data->display, data->drawable, data->gc, segments, count);
+    return 0;
+}
+
+static int
+X11_RenderFills(SDL_Renderer * renderer, const SDL_Rect * rects, int count)
+{
+    X11_RenderData *data = (X11_RenderData *) renderer->driverdata;
+    unsigned long foreground;
+    XRectangle *xrects;
+    int i;
+
+    xrects = (XRectangle *)
+        SDL_GetBatchBuffer(&renderer->batch_scratch,
+                           &renderer->batch_scratch_size,
+                           count * sizeof(*xrects));
+    if (!xrects) {
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        if (data->makedirty) {
+            SDL_AddDirtyRect(&data->dirty, &rects[i]);
+        }
+        xrects[i].x = rects[i].x;
+        xrects[i].y = rects[i].y;
+        xrects[i].width = rects[i].w;
+        xrects[i].height = rects[i].h;
+    }
+
+    foreground = renderdrawcolor(renderer, 1);
+    XSetForeground(data->display, data->gc, foreground);
+    XFillRectangles(data->display, data->drawable, data->gc, xrects, count);
+    return 0;
+}
+
 static int
 X11_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                const SDL_Rect * srcrect, const SDL_Rect * dstrect)
@@ -667,6 +1226,72 @@ X11_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     if (data->makedirty) {
         SDL_AddDirtyRect(&data->dirty, dstrect);
     }
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    if (texturedata->picture) {
+        Picture picture = texturedata->picture;
+        Picture opaque = texturedata->opaque;
+        XTransform transform;
+        int op, src_x = srcrect->x, src_y = srcrect->y;
+
+        switch (texture->blendMode) {
+        case SDL_BLENDMODE_BLEND:
+            op = PictOpOver;
+            break;
+        case SDL_BLENDMODE_ADD:
+            op = PictOpAdd;
+            break;
+        default:
+            op = PictOpSrc;
+            break;
+        }
+
+        /* The transform maps the destination onto the source, it's set on
+           every copy since copies share the pictures */
+        SDL_zero(transform);
+        transform.matrix[0][0] = XDoubleToFixed(1.0);
+        transform.matrix[1][1] = XDoubleToFixed(1.0);
+        transform.matrix[2][2] = XDoubleToFixed(1.0);
+        if (srcrect->w != dstrect->w || srcrect->h != dstrect->h) {
+            const char *filter = FilterNearest;
+
+            if (texture->scaleMode == SDL_TEXTURESCALEMODE_SLOW) {
+                filter = FilterBilinear;
+            } else if (texture->scaleMode == SDL_TEXTURESCALEMODE_BEST) {
+                filter = FilterBest;
+            }
+            if (filter != FilterNearest &&
+                (srcrect->x != 0 || srcrect->y != 0 ||
+                 srcrect->w != texture->w || srcrect->h != texture->h)) {
+                if (X11_CopyTexturePart(data, texturedata, srcrect) < 0) {
+                    return -1;
+                }
+                picture = texturedata->part_picture;
+                opaque = texturedata->part_opaque;
+                src_x = 0;
+                src_y = 0;
+            }
+            if (op == PictOpSrc && opaque != None) {
+                picture = opaque;
+            }
+            transform.matrix[0][0] =
+                XDoubleToFixed((double) srcrect->w / dstrect->w);
+            transform.matrix[0][2] = XDoubleToFixed(src_x);
+            transform.matrix[1][1] =
+                XDoubleToFixed((double) srcrect->h / dstrect->h);
+            transform.matrix[1][2] = XDoubleToFixed(src_y);
+            XRenderSetPictureFilter(data->display, picture, filter, NULL, 0);
+            src_x = 0;
+            src_y = 0;
+        } else if (op == PictOpSrc && opaque != None) {
+            picture = opaque;
+        }
+        XRenderSetPictureTransform(data->display, picture, &transform);
+        XRenderComposite(data->display, op, picture, None,
+                         data->drawable_pict, src_x, src_y, 0, 0,
+                         dstrect->x, dstrect->y, dstrect->w, dstrect->h);
+        return 0;
+    }
+#endif
     if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
 #ifndef NO_SHARED_MEMORY
         if (texturedata->shminfo.shmaddr) {
@@ -691,6 +1316,8 @@ X11_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         SDL_PixelFormat fmt;
         SDL_Rect rect;
         XImage *image = texturedata->scaling_image;
+        int bpp;
+        Uint32 Rmask, Gmask, Bmask, Amask;
 
         if (!image) {
             int depth;
@@ -750,13 +1377,24 @@ X11_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         dst.pixels = image->data;
         dst.pitch = image->bytes_per_line;
 
-        fmt.BytesPerPixel = SDL_BYTESPERPIXEL(texturedata->format);
+        /* SDL_SoftStretchLinear() needs the masks to pick its path */
+        SDL_zero(fmt);
+        if (SDL_PixelFormatEnumToMasks
+            (texturedata->format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
+            SDL_InitFormat(&fmt, bpp, Rmask, Gmask, Bmask, Amask);
+        } else {
+            fmt.BytesPerPixel = SDL_BYTESPERPIXEL(texturedata->format);
+        }
 
         rect.x = 0;
         rect.y = 0;
         rect.w = dstrect->w;
         rect.h = dstrect->h;
-        if (SDL_SoftStretch(&src, srcrect, &dst, &rect) < 0) {
+        if (texture->scaleMode == SDL_TEXTURESCALEMODE_SLOW) {
+            if (SDL_SoftStretchLinear(&src, srcrect, &dst, &rect) < 0) {
+                return -1;
+            }
+        } else if (SDL_SoftStretch(&src, srcrect, &dst, &rect) < 0) {
             return -1;
         }
         XPutImage(data->display, data->drawable, data->gc, image, 0, 0,
@@ -777,7 +1415,8 @@ X11_RenderPresent(SDL_Renderer * renderer)
 
     /* Send the data to the display */
     if (!(renderer->info.flags & SDL_RENDERER_SINGLEBUFFER)) {
-        for (dirty = data->dirty.list; dirty; dirty = dirty->next) {
+        for (dirty = SDL_GetDirtyRects(&data->dirty); dirty;
+             dirty = dirty->next) {
             const SDL_Rect *rect = &dirty->rect;
             XCopyArea(data->display, data->drawable, data->window,
                       data->gc, rect->x, rect->y, rect->w, rect->h,
@@ -795,6 +1434,11 @@ X11_RenderPresent(SDL_Renderer * renderer)
         data->current_pixmap = (data->current_pixmap + 1) % 3;
         data->drawable = data->pixmaps[data->current_pixmap];
     }
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    if (data->use_xrender && data->drawable != data->window) {
+        data->drawable_pict = data->pixmap_picts[data->current_pixmap];
+    }
+#endif
 }
 
 static void
@@ -809,6 +1453,21 @@ X11_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
     if (data->yuv) {
         SDL_SW_DestroyYUVTexture(data->yuv);
     }
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+    X11_FreeTexturePart(renderdata, data);
+    if (data->picture != None) {
+        XRenderFreePicture(renderdata->display, data->picture);
+    }
+    if (data->opaque != None) {
+        XRenderFreePicture(renderdata->display, data->opaque);
+    }
+    if (data->gc) {
+        XFreeGC(renderdata->display, data->gc);
+    }
+    if (data->premultiplied_pixels) {
+        SDL_free(data->premultiplied_pixels);
+    }
+#endif
     if (data->pixmap != None) {
         XFreePixmap(renderdata->display, data->pixmap);
     }
@@ -843,6 +1502,12 @@ X11_DestroyRenderer(SDL_Renderer * renderer)
     int i;
 
     if (data) {
+#if SDL_VIDEO_DRIVER_X11_XRENDER
+        X11_FreePixmapPictures(data);
+        if (data->xwindow_pict != None) {
+            XRenderFreePicture(data->display, data->xwindow_pict);
+        }
+#endif
         for (i = 0; i < SDL_arraysize(data->pixmaps); ++i) {
             if (data->pixmaps[i] != None) {
                 XFreePixmap(data->display, data->pixmaps[i]);
@@ -21,6 +21,9 @@
 */
 #include "SDL_config.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "SDL_video.h"
 #include "SDL_mouse.h"
 #include "../SDL_sysvideo.h"
@@ -137,6 +140,7 @@ X11_CreateDevice(int devindex)
         return NULL;
     }
     device->driverdata = data;
+    data->wakeup_pipe[0] = data->wakeup_pipe[1] = -1;
 
 #if SDL_VIDEO_DRIVER_PANDORA
     device->gles_data = (struct SDL_PrivateGLESData *) SDL_calloc(1, sizeof(SDL_PrivateGLESData));
@@ -186,6 +190,8 @@ X11_CreateDevice(int devindex)
     device->GetDisplayGammaRamp = X11_GetDisplayGammaRamp;
     device->SuspendScreenSaver = X11_SuspendScreenSaver;
     device->PumpEvents = X11_PumpEvents;
+    device->WaitEvents = X11_WaitEvents;
+    device->WakeEvents = X11_WakeEvents;
 
     device->CreateWindow = X11_CreateWindow;
     device->CreateWindowFrom = X11_CreateWindowFrom;
@@ -256,6 +262,17 @@ X11_VideoInit(_THIS)
     data->WM_DELETE_WINDOW =
         XInternAtom(data->display, "WM_DELETE_WINDOW", False);
 
+    /* A pipe other threads can write to, to wake up X11_WaitEvents() */
+    if (pipe(data->wakeup_pipe) == 0) {
+        int i;
+        for (i = 0; i < 2; ++i) {
+            fcntl(data->wakeup_pipe[i], F_SETFL, O_NONBLOCK);
+            fcntl(data->wakeup_pipe[i], F_SETFD, FD_CLOEXEC);
+        }
+    } else {
+        data->wakeup_pipe[0] = data->wakeup_pipe[1] = -1;
+    }
+
     X11_InitModes(_this);
 
 #if SDL_VIDEO_RENDER_X11
@@ -283,6 +300,11 @@ X11_VideoQuit(_THIS)
         XCloseIM(data->im);
     }
 #endif
+    if (data->wakeup_pipe[0] >= 0) {
+        close(data->wakeup_pipe[0]);
+        close(data->wakeup_pipe[1]);
+        data->wakeup_pipe[0] = data->wakeup_pipe[1] = -1;
+    }
 
     X11_QuitModes(_this);
     X11_QuitKeyboard(_this);
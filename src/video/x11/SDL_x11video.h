@@ -70,6 +70,7 @@ typedef struct SDL_VideoData
     int keyboard;
     Atom WM_DELETE_WINDOW;
     SDL_scancode key_layout[256];
+    int wakeup_pipe[2];
 } SDL_VideoData;
 
 extern SDL_bool X11_UseDirectColorVisuals();
@@ -0,0 +1,103 @@
+
+/* Program to load a wave file and loop playing it using SDL sound queueing */
+
+/* This is loopwave.c without the audio callback: the main thread keeps
+	about a second of audio queued with SDL_QueueAudio()
+*/
+#include "SDL_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#include "SDL.h"
+#include "SDL_audio.h"
+
+struct
+{
+    SDL_AudioSpec spec;
+    Uint8 *sound;               /* Pointer to wave data */
+    Uint32 soundlen;            /* Length of wave data */
+} wave;
+
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+static int done = 0;
+void
+poked(int sig)
+{
+    done = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_AudioDeviceID dev;
+    Uint32 onesecond;
+
+    /* Load the SDL library */
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    if (argv[1] == NULL) {
+        argv[1] = "sample.wav";
+    }
+    /* Load the wave file into memory */
+    if (SDL_LoadWAV(argv[1], &wave.spec, &wave.sound, &wave.soundlen) == NULL) {
+        fprintf(stderr, "Couldn't load %s: %s\n", argv[1], SDL_GetError());
+        quit(1);
+    }
+
+    /* No callback, we're going to queue audio instead */
+    wave.spec.callback = NULL;
+#if HAVE_SIGNAL_H
+    /* Set the signals */
+#ifdef SIGHUP
+    signal(SIGHUP, poked);
+#endif
+    signal(SIGINT, poked);
+#ifdef SIGQUIT
+    signal(SIGQUIT, poked);
+#endif
+    signal(SIGTERM, poked);
+#endif /* HAVE_SIGNAL_H */
+
+    dev = SDL_OpenAudioDevice(NULL, 0, &wave.spec, NULL, 0);
+    if (dev == 0) {
+        fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_FreeWAV(wave.sound);
+        quit(2);
+    }
+    onesecond = wave.spec.freq * wave.spec.channels *
+        (SDL_AUDIO_BITSIZE(wave.spec.format) / 8);
+
+    SDL_QueueAudio(dev, wave.sound, wave.soundlen);
+    SDL_PauseAudioDevice(dev, 0);
+
+    /* Top up the queue whenever it drops under a second */
+    while (!done && (SDL_GetAudioDeviceStatus(dev) == SDL_AUDIO_PLAYING)) {
+        if (SDL_GetQueuedAudioSize(dev) < onesecond) {
+            SDL_QueueAudio(dev, wave.sound, wave.soundlen);
+        }
+        SDL_Delay(100);
+    }
+
+    /* Clean up on signal */
+    SDL_ClearQueuedAudio(dev);
+    SDL_CloseAudioDevice(dev);
+    SDL_FreeWAV(wave.sound);
+    SDL_Quit();
+    return (0);
+}
@@ -0,0 +1,325 @@
+
+/*
+ * Checks loading images and sounds in the background: that the results
+ * match loading them directly, that a completion event arrives for each
+ * load, already queued when the load is seen to finish, that failures and
+ * cancellations are reported, and that SDL_Quit() copes with loads that
+ * haven't finished.  Then it times how long the main thread is held up by
+ * starting loads, against doing them directly.
+ *
+ * Events need the video subsystem, so this uses the dummy video driver
+ * unless SDL_VIDEODRIVER says otherwise.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define NUM_LOADS   16
+#define NUM_RACES   200
+
+static SDL_Surface *bmp;
+static SDL_AudioSpec wav_spec;
+static Uint8 *wav_buf;
+static Uint32 wav_len;
+
+static int
+CheckSurface(SDL_AsyncLoad * load)
+{
+    SDL_Surface *surface;
+    int y, errors = 0;
+
+    surface = SDL_GetAsyncLoadSurface(load);
+    if (!surface) {
+        printf("Couldn't get the surface: %s\n", SDL_GetError());
+        return 1;
+    }
+    if (surface->w != bmp->w || surface->h != bmp->h ||
+        surface->format->BitsPerPixel != bmp->format->BitsPerPixel) {
+        printf("The surface is %dx%dx%d, not %dx%dx%d\n",
+               surface->w, surface->h, surface->format->BitsPerPixel,
+               bmp->w, bmp->h, bmp->format->BitsPerPixel);
+        SDL_FreeSurface(surface);
+        return 1;
+    }
+    for (y = 0; y < surface->h; ++y) {
+        if (SDL_memcmp((Uint8 *) surface->pixels + y * surface->pitch,
+                       (Uint8 *) bmp->pixels + y * bmp->pitch,
+                       surface->w * surface->format->BytesPerPixel) != 0) {
+            printf("Row %d of the surface is different\n", y);
+            ++errors;
+            break;
+        }
+    }
+    if (SDL_GetAsyncLoadSurface(load)) {
+        printf("The surface could be taken twice\n");
+        ++errors;
+    }
+    SDL_FreeSurface(surface);
+    return errors;
+}
+
+static int
+CheckWAV(SDL_AsyncLoad * load)
+{
+    SDL_AudioSpec spec;
+    Uint8 *buf;
+    Uint32 len;
+    int errors = 0;
+
+    if (!SDL_GetAsyncLoadWAV(load, &spec, &buf, &len)) {
+        printf("Couldn't get the sound: %s\n", SDL_GetError());
+        return 1;
+    }
+    if (spec.freq != wav_spec.freq || spec.format != wav_spec.format ||
+        spec.channels != wav_spec.channels || len != wav_len ||
+        SDL_memcmp(buf, wav_buf, len) != 0) {
+        printf("The sound is different\n");
+        ++errors;
+    }
+    SDL_FreeWAV(buf);
+    return errors;
+}
+
+/* Start loads of both kinds and check what they load */
+static int
+TestLoads(Uint8 event_type)
+{
+    SDL_AsyncLoad *loads[NUM_LOADS];
+    SDL_Event event;
+    int i, events = 0, errors = 0;
+
+    for (i = 0; i < NUM_LOADS; ++i) {
+        if (i % 4 == 0) {
+            loads[i] = SDL_LoadWAVAsync("sample.wav", event_type);
+        } else {
+            loads[i] = SDL_LoadBMPAsync("sample.bmp", event_type);
+        }
+        if (!loads[i]) {
+            printf("Couldn't start load %d: %s\n", i, SDL_GetError());
+            return 1;
+        }
+    }
+    for (i = 0; i < NUM_LOADS; ++i) {
+        if (SDL_WaitAsyncLoad(loads[i]) != SDL_ASYNCLOAD_DONE) {
+            printf("Load %d failed: %s\n", i, SDL_GetError());
+            ++errors;
+        } else if (i % 4 == 0) {
+            errors += CheckWAV(loads[i]);
+        } else {
+            errors += CheckSurface(loads[i]);
+        }
+    }
+
+    /* Every load has been waited for, so all the events are queued */
+    while (SDL_PollEvent(&event)) {
+        if (event.type != event_type) {
+            continue;
+        }
+        for (i = 0; i < NUM_LOADS; ++i) {
+            if (event.user.data1 == loads[i]) {
+                break;
+            }
+        }
+        if (i == NUM_LOADS || event.user.code != SDL_ASYNCLOAD_DONE ||
+            SDL_GetAsyncLoadStatus(loads[i]) != SDL_ASYNCLOAD_DONE) {
+            printf("Got a completion event for an unknown or unfinished "
+                   "load\n");
+            ++errors;
+        }
+        ++events;
+    }
+    if (events != NUM_LOADS) {
+        printf("%d completion events for %d loads\n", events, NUM_LOADS);
+        ++errors;
+    }
+    for (i = 0; i < NUM_LOADS; ++i) {
+        SDL_FreeAsyncLoad(loads[i]);
+    }
+    return errors;
+}
+
+/* Free each load as soon as it's seen to be done and its event is read */
+static int
+TestEventOrder(Uint8 event_type)
+{
+    SDL_AsyncLoad *load;
+    SDL_Surface *surface;
+    SDL_Event event;
+    int i, errors = 0;
+
+    for (i = 0; i < NUM_RACES && !errors; ++i) {
+        load = SDL_LoadBMPAsync("sample.bmp", event_type);
+        if (i & 1) {
+            SDL_WaitAsyncLoad(load);
+        } else {
+            while (SDL_GetAsyncLoadStatus(load) == SDL_ASYNCLOAD_PENDING ||
+                   SDL_GetAsyncLoadStatus(load) == SDL_ASYNCLOAD_LOADING) {
+                SDL_Delay(0);
+            }
+        }
+        if (SDL_PeepEvents(&event, 1, SDL_GETEVENT,
+                           SDL_EVENTMASK(event_type)) != 1 ||
+            event.user.data1 != load) {
+            printf("Load %d finished before its event was queued\n", i);
+            ++errors;
+        } else {
+            surface = SDL_GetAsyncLoadSurface((SDL_AsyncLoad *)
+                                              event.user.data1);
+            if (!surface) {
+                printf("Load %d: %s\n", i, SDL_GetError());
+                ++errors;
+            }
+            SDL_FreeSurface(surface);
+        }
+        SDL_FreeAsyncLoad(load);
+    }
+    return errors;
+}
+
+static int
+TestFailure(void)
+{
+    static const char garbage[] = "This isn't a BMP or a WAVE file";
+    SDL_AsyncLoad *load;
+    int errors = 0;
+
+    if (SDL_LoadBMPAsync("no such file.bmp", 0)) {
+        printf("Started loading a file that doesn't exist\n");
+        ++errors;
+    }
+    load = SDL_LoadBMPAsync_RW(SDL_RWFromConstMem(garbage, sizeof(garbage)),
+                               1, 0);
+    if (SDL_WaitAsyncLoad(load) != SDL_ASYNCLOAD_FAILED) {
+        printf("Loading garbage didn't fail\n");
+        ++errors;
+    } else {
+        printf("Loading garbage failed: %s\n", SDL_GetError());
+    }
+    if (SDL_GetAsyncLoadSurface(load)) {
+        printf("Got a surface from a failed load\n");
+        ++errors;
+    }
+    SDL_FreeAsyncLoad(load);
+    return errors;
+}
+
+/* Cancelling loads behind a queue of others, and freeing them unfinished */
+static int
+TestCancel(void)
+{
+    SDL_AsyncLoad *loads[NUM_LOADS];
+    int i, cancelled = 0, errors = 0;
+
+    for (i = 0; i < NUM_LOADS; ++i) {
+        loads[i] = SDL_LoadBMPAsync("sample.bmp", 0);
+    }
+    for (i = NUM_LOADS / 2; i < NUM_LOADS; ++i) {
+        if (SDL_CancelAsyncLoad(loads[i]) == 0) {
+            ++cancelled;
+            if (SDL_GetAsyncLoadStatus(loads[i]) != SDL_ASYNCLOAD_CANCELLED ||
+                SDL_WaitAsyncLoad(loads[i]) != SDL_ASYNCLOAD_CANCELLED) {
+                printf("Load %d wasn't cancelled\n", i);
+                ++errors;
+            }
+        }
+    }
+    if (SDL_WaitAsyncLoad(loads[0]) != SDL_ASYNCLOAD_DONE ||
+        SDL_CancelAsyncLoad(loads[0]) == 0) {
+        printf("Cancelled a load that had finished\n");
+        ++errors;
+    }
+    printf("Cancelled %d of %d loads\n", cancelled, NUM_LOADS / 2);
+    for (i = 0; i < NUM_LOADS; ++i) {
+        SDL_FreeAsyncLoad(loads[i]);
+    }
+    return errors;
+}
+
+static void
+TimeLoads(void)
+{
+    SDL_AsyncLoad *loads[NUM_LOADS];
+    SDL_AudioSpec spec;
+    Uint8 *buf;
+    Uint32 len;
+    Uint64 start, direct, started, finished;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_LOADS; ++i) {
+        if (SDL_LoadWAV("sample.wav", &spec, &buf, &len)) {
+            SDL_FreeWAV(buf);
+        }
+    }
+    direct = SDL_GetPerformanceCounter() - start;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_LOADS; ++i) {
+        loads[i] = SDL_LoadWAVAsync("sample.wav", 0);
+    }
+    started = SDL_GetPerformanceCounter() - start;
+    for (i = 0; i < NUM_LOADS; ++i) {
+        SDL_WaitAsyncLoad(loads[i]);
+        SDL_FreeAsyncLoad(loads[i]);
+    }
+    finished = SDL_GetPerformanceCounter() - start;
+
+    printf("%d sounds: %8.1f us loading directly, %8.1f us to start loading "
+           "them, %8.1f us until they're loaded\n", NUM_LOADS,
+           (double) direct * 1000000.0 / SDL_GetPerformanceFrequency(),
+           (double) started * 1000000.0 / SDL_GetPerformanceFrequency(),
+           (double) finished * 1000000.0 / SDL_GetPerformanceFrequency());
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_AsyncLoad *loads[NUM_LOADS];
+    Uint8 event_type = SDL_USEREVENT;
+    int i, errors = 0;
+
+    /* Events need the video subsystem, but not a display */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    bmp = SDL_LoadBMP("sample.bmp");
+    if (!bmp || !SDL_LoadWAV("sample.wav", &wav_spec, &wav_buf, &wav_len)) {
+        fprintf(stderr, "Couldn't load the samples: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    errors += TestLoads(event_type);
+    errors += TestEventOrder(event_type);
+    errors += TestFailure();
+    errors += TestCancel();
+    SDL_FreeSurface(bmp);
+    SDL_FreeWAV(wav_buf);
+    TimeLoads();
+
+    /* SDL_Quit() finishes or cancels every load */
+    for (i = 0; i < NUM_LOADS; ++i) {
+        loads[i] = SDL_LoadBMPAsync("sample.bmp", event_type);
+    }
+    SDL_Quit();
+    for (i = 0; i < NUM_LOADS; ++i) {
+        SDL_AsyncLoadStatus status = SDL_GetAsyncLoadStatus(loads[i]);
+
+        if (status != SDL_ASYNCLOAD_DONE &&
+            status != SDL_ASYNCLOAD_CANCELLED) {
+            printf("Load %d is unfinished after SDL_Quit()\n", i);
+            ++errors;
+        }
+        SDL_FreeAsyncLoad(loads[i]);
+    }
+
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
@@ -0,0 +1,361 @@
+
+/*
+ * Checks SDL_ConvertAudio() sample rate conversion and times it.
+ *
+ * A sine wave is resampled in one piece and in random sized pieces, the
+ * two must match exactly, and the result is compared with the ideal sine
+ * at the new rate. Then each conversion is timed with the polyphase
+ * filters and with the older linear ones (SDL_AUDIO_RESAMPLER_QUALITY=0).
+ *
+ * Last, some common conversions that change the format, channels and rate
+ * at once are run in pieces of 1/25 second and in random sized pieces;
+ * both must give the same bytes, and the throughput is printed.
+ *
+ * Then more converters than the resampler keeps filter tables for take
+ * turns converting a piece each; every one must still use the polyphase
+ * filters and give the same bytes as converting on its own.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "SDL.h"
+
+#define TONE_FREQ   1000.0
+#define SECONDS     1
+#define BENCH_LOOPS 20
+#define CHAIN_LOOPS 100
+#define NUM_RATIOS  12
+
+static const struct
+{
+    int src_rate;
+    int dst_rate;
+} rates[] = {
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 22050, 44100 },
+    { 44100, 22050 },
+    { 8000, 44100 },
+    { 44100, 11025 },
+};
+
+static const struct
+{
+    const char *name;
+    SDL_AudioFormat format;
+} formats[] = {
+    { "S16", AUDIO_S16SYS },
+    { "F32", AUDIO_F32SYS },
+};
+
+static const struct
+{
+    const char *name;
+    SDL_AudioFormat src_format;
+    int src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    int dst_channels;
+    int dst_rate;
+} chains[] = {
+    { "U8 mono 22k -> F32 stereo 48k",
+      AUDIO_U8, 1, 22050, AUDIO_F32SYS, 2, 48000 },
+    { "S16 mono 22k -> F32 stereo 48k",
+      AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 2, 48000 },
+    { "S16 stereo 44.1k -> F32 stereo 48k",
+      AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 48000 },
+    { "S16 stereo 48k -> F32 stereo 44.1k",
+      AUDIO_S16SYS, 2, 48000, AUDIO_F32SYS, 2, 44100 },
+    { "F32 stereo 48k -> S16 stereo 44.1k",
+      AUDIO_F32SYS, 2, 48000, AUDIO_S16SYS, 2, 44100 },
+    { "S16 5.1 48k -> S16 stereo 44.1k",
+      AUDIO_S16SYS, 6, 48000, AUDIO_S16SYS, 2, 44100 },
+    { "U8 mono 22k -> S16 stereo 22k",
+      AUDIO_U8, 1, 22050, AUDIO_S16SYS, 2, 22050 },
+    { "S16 stereo 44.1k -> F32 5.1 44.1k",
+      AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 6, 44100 },
+};
+
+static Uint8 *
+MakeTone(SDL_AudioFormat format, int channels, int rate, int *len)
+{
+    const int frames = rate * SECONDS;
+    const int size = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint8 *buf = (Uint8 *) SDL_malloc(frames * channels * size);
+    int i, c;
+
+    for (i = 0; i < frames; ++i) {
+        const double value = 0.5 * sin(2.0 * M_PI * TONE_FREQ * i / rate);
+        for (c = 0; c < channels; ++c) {
+            if (format == AUDIO_U8) {
+                buf[i * channels + c] = (Uint8) (128 + value * 127);
+            } else if (format == AUDIO_S16SYS) {
+                ((Sint16 *) buf)[i * channels + c] = (Sint16) (value * 32767);
+            } else {
+                ((float *) buf)[i * channels + c] = (float) value;
+            }
+        }
+    }
+    *len = frames * channels * size;
+    return buf;
+}
+
+/* Converts 'len' bytes of 'data' in pieces of 'piece' bytes, or of
+   random sizes up to that */
+static Uint8 *
+Convert(SDL_AudioCVT * cvt, const Uint8 * data, int len, int framesize,
+        int piece, SDL_bool random, int *outlen)
+{
+    Uint8 *out = (Uint8 *) SDL_malloc(len * cvt->len_mult + framesize);
+    Uint8 *buf = (Uint8 *) SDL_malloc(piece * cvt->len_mult);
+    int pos = 0;
+
+    *outlen = 0;
+    while (pos < len) {
+        int chunk = piece;
+        if (random) {
+            chunk = framesize * (1 + rand() % (piece / framesize));
+        }
+        chunk = SDL_min(chunk, len - pos);
+        SDL_memcpy(buf, data + pos, chunk);
+        cvt->buf = buf;
+        cvt->len = chunk;
+        SDL_ConvertAudio(cvt);
+        SDL_memcpy(out + *outlen, buf, cvt->len_cvt);
+        *outlen += cvt->len_cvt;
+        pos += chunk;
+    }
+    SDL_free(buf);
+    return out;
+}
+
+/* Signal to noise ratio against the ideal tone, skipping the edges */
+static double
+ToneSNR(SDL_AudioFormat format, int channels, int rate, const Uint8 * data,
+        int frames, double delay)
+{
+    double signal = 0.0, noise = 0.0;
+    int i;
+
+    for (i = rate / 100; i < frames - rate / 100; ++i) {
+        const double t = (i - delay) / rate;
+        const double expected = 0.5 * sin(2.0 * M_PI * TONE_FREQ * t);
+        double value;
+
+        if (format == AUDIO_S16SYS) {
+            value = ((const Sint16 *) data)[i * channels] / 32767.0;
+        } else {
+            value = ((const float *) data)[i * channels];
+        }
+        signal += expected * expected;
+        noise += (value - expected) * (value - expected);
+    }
+    return 10.0 * log10(signal / noise);
+}
+
+static int
+TestRate(int r, int f, int channels)
+{
+    const SDL_AudioFormat format = formats[f].format;
+    const int framesize = channels * SDL_AUDIO_BITSIZE(format) / 8;
+    const int src_rate = rates[r].src_rate;
+    const int dst_rate = rates[r].dst_rate;
+    SDL_AudioCVT cvt;
+    Uint8 *data, *whole, *pieces;
+    int len, wholelen, pieceslen;
+    /* The linear resamplers need pieces that convert to whole frames */
+    const int piece = (src_rate / 25) * framesize;
+    int error = 0;
+    Uint32 start, newtime, oldtime;
+    int i;
+
+    data = MakeTone(format, channels, src_rate, &len);
+
+    SDL_BuildAudioCVT(&cvt, format, channels, src_rate, format, channels,
+                      dst_rate);
+    whole = Convert(&cvt, data, len, framesize, len, SDL_FALSE, &wholelen);
+    SDL_BuildAudioCVT(&cvt, format, channels, src_rate, format, channels,
+                      dst_rate);
+    pieces = Convert(&cvt, data, len, framesize, 1024 * framesize, SDL_TRUE,
+                     &pieceslen);
+    if (wholelen != pieceslen || SDL_memcmp(whole, pieces, wholelen) != 0) {
+        printf("%s %d channels %d -> %d: piecewise conversion differs\n",
+               formats[f].name, channels, src_rate, dst_rate);
+        error = 1;
+    }
+
+    /* The filter delays the output by half its length */
+    printf("%s %d channels %5d -> %5d: %5.1f dB SNR", formats[f].name,
+           channels, src_rate, dst_rate,
+           ToneSNR(format, channels, dst_rate, whole, wholelen / framesize,
+                   cvt.resampler.taps / 2.0 * dst_rate / src_rate));
+
+    start = SDL_GetTicks();
+    for (i = 0; i < BENCH_LOOPS; ++i) {
+        SDL_free(Convert(&cvt, data, len, framesize, piece, SDL_FALSE,
+                         &pieceslen));
+    }
+    newtime = SDL_GetTicks() - start;
+
+    SDL_putenv("SDL_AUDIO_RESAMPLER_QUALITY=0");
+    SDL_BuildAudioCVT(&cvt, format, channels, src_rate, format, channels,
+                      dst_rate);
+    start = SDL_GetTicks();
+    for (i = 0; i < BENCH_LOOPS; ++i) {
+        SDL_free(pieces);
+        pieces = Convert(&cvt, data, len, framesize, piece, SDL_FALSE,
+                         &pieceslen);
+    }
+    oldtime = SDL_GetTicks() - start;
+    SDL_putenv("SDL_AUDIO_RESAMPLER_QUALITY=2");
+
+    printf(", %4.1f ms per second of audio (linear %5.1f dB, %4.1f ms)\n",
+           (double) newtime / BENCH_LOOPS,
+           ToneSNR(format, channels, dst_rate, pieces, pieceslen / framesize,
+                   0.0), (double) oldtime / BENCH_LOOPS);
+
+    SDL_free(data);
+    SDL_free(whole);
+    SDL_free(pieces);
+    return error;
+}
+
+/* Converts in pieces of 1/25 second and in random pieces, and returns 1
+   if they differ */
+static int
+TestChain(int n)
+{
+    const SDL_AudioFormat format = chains[n].src_format;
+    const int framesize =
+        chains[n].src_channels * SDL_AUDIO_BITSIZE(format) / 8;
+    const int piece = (chains[n].src_rate / 25) * framesize;
+    SDL_AudioCVT cvt;
+    Uint8 *data, *out[2];
+    int len, outlen[2];
+    Uint32 start, ticks;
+    int i;
+
+    data = MakeTone(format, chains[n].src_channels, chains[n].src_rate, &len);
+    SDL_BuildAudioCVT(&cvt, format, chains[n].src_channels,
+                      chains[n].src_rate, chains[n].dst_format,
+                      chains[n].dst_channels, chains[n].dst_rate);
+    out[0] = Convert(&cvt, data, len, framesize, piece, SDL_FALSE,
+                     &outlen[0]);
+    start = SDL_GetTicks();
+    for (i = 0; i < CHAIN_LOOPS; ++i) {
+        SDL_free(Convert(&cvt, data, len, framesize, piece, SDL_FALSE,
+                         &outlen[0]));
+    }
+    ticks = SDL_GetTicks() - start;
+
+    /* Bytes of source audio converted per second */
+    printf("%-36s %6.1f MB/s\n", chains[n].name,
+           (double) len * CHAIN_LOOPS / SDL_max(ticks, 1) / 1000.0);
+
+    /* The linear resamplers start over on each piece */
+    i = 0;
+    if (chains[n].src_rate == chains[n].dst_rate || cvt.resampler.taps) {
+        SDL_BuildAudioCVT(&cvt, format, chains[n].src_channels,
+                          chains[n].src_rate, chains[n].dst_format,
+                          chains[n].dst_channels, chains[n].dst_rate);
+        out[1] = Convert(&cvt, data, len, framesize, piece, SDL_TRUE,
+                         &outlen[1]);
+        i = (outlen[0] != outlen[1] ||
+             SDL_memcmp(out[0], out[1], outlen[0]));
+        if (i) {
+            printf("%s: converting in random pieces differs\n",
+                   chains[n].name);
+        }
+        SDL_free(out[1]);
+    }
+    SDL_free(data);
+    SDL_free(out[0]);
+    return i;
+}
+
+static int
+TestManyRatios(void)
+{
+    static const int dst_rates[NUM_RATIOS] = {
+        48000, 32000, 22050, 11025, 8000, 16000,
+        24000, 96000, 88200, 37800, 47250, 30000
+    };
+    const int framesize = 2 * sizeof(Sint16);
+    const int piece = 1000 * framesize;
+    SDL_AudioCVT cvt[NUM_RATIOS];
+    Uint8 *data, *out[NUM_RATIOS], *alone;
+    int len, outlen[NUM_RATIOS], alonelen;
+    int pos, i, errors = 0;
+
+    data = MakeTone(AUDIO_S16SYS, 2, 44100, &len);
+    for (i = 0; i < NUM_RATIOS; ++i) {
+        SDL_BuildAudioCVT(&cvt[i], AUDIO_S16SYS, 2, 44100, AUDIO_S16SYS, 2,
+                          dst_rates[i]);
+        if (cvt[i].resampler.taps == 0) {
+            printf("44100 -> %d: converter %d doesn't use the polyphase "
+                   "filters\n", dst_rates[i], i);
+            ++errors;
+        }
+        out[i] = (Uint8 *) SDL_malloc(len * cvt[i].len_mult);
+        outlen[i] = 0;
+    }
+
+    /* Every piece needs a table some other converter pushed out */
+    for (pos = 0; pos < len; pos += piece) {
+        for (i = 0; i < NUM_RATIOS; ++i) {
+            cvt[i].buf = out[i] + outlen[i];
+            cvt[i].len = SDL_min(piece, len - pos);
+            SDL_memcpy(cvt[i].buf, data + pos, cvt[i].len);
+            SDL_ConvertAudio(&cvt[i]);
+            outlen[i] += cvt[i].len_cvt;
+        }
+    }
+
+    for (i = 0; i < NUM_RATIOS; ++i) {
+        SDL_BuildAudioCVT(&cvt[i], AUDIO_S16SYS, 2, 44100, AUDIO_S16SYS, 2,
+                          dst_rates[i]);
+        alone = Convert(&cvt[i], data, len, framesize, piece, SDL_FALSE,
+                        &alonelen);
+        if (alonelen != outlen[i] || SDL_memcmp(alone, out[i], alonelen)) {
+            printf("44100 -> %d: taking turns with other converters "
+                   "differs\n", dst_rates[i]);
+            ++errors;
+        }
+        SDL_free(alone);
+        SDL_free(out[i]);
+    }
+    SDL_free(data);
+    return errors;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int r, f;
+    int errors = 0;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    srand(1);
+    SDL_putenv("SDL_AUDIO_RESAMPLER_QUALITY=2");
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        for (r = 0; r < SDL_arraysize(rates); ++r) {
+            errors += TestRate(r, f, 2);
+        }
+    }
+    errors += TestRate(0, 1, 1);
+    errors += TestRate(0, 1, 6);
+
+    for (r = 0; r < SDL_arraysize(chains); ++r) {
+        errors += TestChain(r);
+    }
+    errors += TestManyRatios();
+
+    SDL_Quit();
+    return (errors ? 1 : 0);
+}
@@ -0,0 +1,228 @@
+
+/*
+ * Checks the generated 32-bit modulate blitters (with and without each
+ * blend mode) against a straightforward reference, byte for byte.
+ *
+ * Run it normally to check the fastest blitters for this CPU, and with
+ * SDL_BLIT_CPU_FEATURES=0 in the environment to check the plain C ones.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "SDL.h"
+
+#define TEST_W  37
+#define TEST_H  5
+
+static const struct
+{
+    const char *name;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+} formats[] = {
+    { "RGB888", 0x00FF0000, 0x0000FF00, 0x000000FF, 0x00000000 },
+    { "BGR888", 0x000000FF, 0x0000FF00, 0x00FF0000, 0x00000000 },
+    { "ARGB8888", 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000 },
+    { "RGBA8888", 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF },
+    { "ABGR8888", 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000 },
+    { "BGRA8888", 0x0000FF00, 0x00FF0000, 0xFF000000, 0x000000FF },
+};
+#define NUM_SRC_FORMATS 6
+#define NUM_DST_FORMATS 3
+
+static const struct
+{
+    const char *name;
+    int blendMode;
+} blendModes[] = {
+    { "none", SDL_BLENDMODE_NONE },
+    { "mask", SDL_BLENDMODE_MASK },
+    { "blend", SDL_BLENDMODE_BLEND },
+    { "add", SDL_BLENDMODE_ADD },
+    { "mod", SDL_BLENDMODE_MOD },
+};
+
+static SDL_Surface *
+CreateSurface(int format)
+{
+    return SDL_CreateRGBSurface(0, TEST_W, TEST_H, 32,
+                                formats[format].Rmask, formats[format].Gmask,
+                                formats[format].Bmask, formats[format].Amask);
+}
+
+static void
+FillRandom(SDL_Surface * surface)
+{
+    Uint8 *pixels = (Uint8 *) surface->pixels;
+    int i;
+
+    for (i = 0; i < surface->h * surface->pitch; ++i) {
+        switch (rand() % 4) {
+        case 0:
+            pixels[i] = 0;
+            break;
+        case 1:
+            pixels[i] = 255;
+            break;
+        default:
+            pixels[i] = (Uint8) rand();
+            break;
+        }
+    }
+}
+
+/* This is the blit as documented for SDL_SetSurfaceBlendMode() */
+static Uint32
+BlitPixel(SDL_Surface * src, Uint32 srcpixel, SDL_Surface * dst,
+          Uint32 dstpixel, Uint8 modR, Uint8 modG, Uint8 modB, Uint8 modA,
+          int blendMode)
+{
+    Uint8 r, g, b, a;
+    Uint8 dr, dg, db, da;
+    unsigned sR, sG, sB, sA, dR, dG, dB;
+
+    SDL_GetRGBA(srcpixel, src->format, &r, &g, &b, &a);
+    SDL_GetRGBA(dstpixel, dst->format, &dr, &dg, &db, &da);
+    sR = (r * modR) / 255;
+    sG = (g * modG) / 255;
+    sB = (b * modB) / 255;
+    sA = (a * modA) / 255;
+    dR = dr;
+    dG = dg;
+    dB = db;
+
+    switch (blendMode) {
+    case SDL_BLENDMODE_NONE:
+        return SDL_MapRGBA(dst->format, sR, sG, sB, sA);
+    case SDL_BLENDMODE_MASK:
+        if (sA) {
+            dR = sR;
+            dG = sG;
+            dB = sB;
+        }
+        break;
+    case SDL_BLENDMODE_BLEND:
+        sR = (sR * sA) / 255;
+        sG = (sG * sA) / 255;
+        sB = (sB * sA) / 255;
+        dR = sR + ((255 - sA) * dR) / 255;
+        dG = sG + ((255 - sA) * dG) / 255;
+        dB = sB + ((255 - sA) * dB) / 255;
+        break;
+    case SDL_BLENDMODE_ADD:
+        sR = (sR * sA) / 255;
+        sG = (sG * sA) / 255;
+        sB = (sB * sA) / 255;
+        dR = SDL_min(sR + dR, 255);
+        dG = SDL_min(sG + dG, 255);
+        dB = SDL_min(sB + dB, 255);
+        break;
+    case SDL_BLENDMODE_MOD:
+        dR = (sR * dR) / 255;
+        dG = (sG * dG) / 255;
+        dB = (sB * dB) / 255;
+        break;
+    }
+    return SDL_MapRGBA(dst->format, dR, dG, dB, da);
+}
+
+static int
+TestBlit(int srcfmt, int dstfmt, int blend, SDL_bool verbose)
+{
+    SDL_Surface *src = CreateSurface(srcfmt);
+    SDL_Surface *dst = CreateSurface(dstfmt);
+    Uint32 *expected;
+    Uint32 mask;
+    Uint8 modR, modG, modB, modA;
+    int x, y;
+    int error = 0;
+
+    if (!src || !dst) {
+        printf("Couldn't create surfaces: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    FillRandom(src);
+    FillRandom(dst);
+    /* Without modulation some of these take the SDL_blit_A.c path */
+    modR = (Uint8) (rand() % 255);
+    modG = (Uint8) (rand() % 255);
+    modB = (Uint8) (rand() % 255);
+    modA = (Uint8) (rand() % 255);
+    SDL_SetSurfaceColorMod(src, modR, modG, modB);
+    SDL_SetSurfaceAlphaMod(src, modA);
+    SDL_SetSurfaceBlendMode(src, blendModes[blend].blendMode);
+
+    expected = (Uint32 *) SDL_malloc(TEST_W * TEST_H * sizeof(Uint32));
+    for (y = 0; y < TEST_H; ++y) {
+        const Uint32 *s = (Uint32 *) ((Uint8 *) src->pixels + y * src->pitch);
+        const Uint32 *d = (Uint32 *) ((Uint8 *) dst->pixels + y * dst->pitch);
+        for (x = 0; x < TEST_W; ++x) {
+            expected[y * TEST_W + x] =
+                BlitPixel(src, s[x], dst, d[x], modR, modG, modB, modA,
+                          blendModes[blend].blendMode);
+        }
+    }
+
+    SDL_BlitSurface(src, NULL, dst, NULL);
+
+    /* The unused byte of RGB888 and BGR888 can be anything */
+    mask = formats[dstfmt].Rmask | formats[dstfmt].Gmask |
+        formats[dstfmt].Bmask | formats[dstfmt].Amask;
+
+    for (y = 0; y < TEST_H && !error; ++y) {
+        const Uint32 *d = (Uint32 *) ((Uint8 *) dst->pixels + y * dst->pitch);
+        for (x = 0; x < TEST_W; ++x) {
+            if ((d[x] & mask) != (expected[y * TEST_W + x] & mask)) {
+                if (verbose) {
+                    printf("%s -> %s, %s: pixel %d,%d is 0x%8.8x, expected 0x%8.8x\n",
+                           formats[srcfmt].name, formats[dstfmt].name,
+                           blendModes[blend].name, x, y, d[x],
+                           expected[y * TEST_W + x]);
+                }
+                error = 1;
+                break;
+            }
+        }
+    }
+
+    SDL_free(expected);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return error;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_bool verbose = SDL_TRUE;
+    int srcfmt, dstfmt, blend;
+    int tests = 0;
+    int errors = 0;
+
+    if (argv[1] && (SDL_strcmp(argv[1], "-q") == 0)) {
+        verbose = SDL_FALSE;
+    }
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    srand(1);
+
+    for (srcfmt = 0; srcfmt < NUM_SRC_FORMATS; ++srcfmt) {
+        for (dstfmt = 0; dstfmt < NUM_DST_FORMATS; ++dstfmt) {
+            for (blend = 0; blend < SDL_arraysize(blendModes); ++blend) {
+                errors += TestBlit(srcfmt, dstfmt, blend, verbose);
+                ++tests;
+            }
+        }
+    }
+
+    if (verbose) {
+        printf("%d of %d blits matched the reference\n", tests - errors,
+               tests);
+    }
+    SDL_Quit();
+    return (errors ? 1 : 0);
+}
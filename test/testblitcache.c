@@ -0,0 +1,217 @@
+
+/*
+ * Changes the alpha and colour modulation and the blend mode of a surface
+ * between blits, the way sprite code does, and checks the results against
+ * a freshly made surface with the same settings.  Then it times small
+ * blits whose alpha or colour modulation is switched on and off each time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SPRITE_SIZE 32
+#define DRAW_SIZE   8
+#define NUM_DRAWS   200000
+
+static SDL_Surface *
+CreateSprite(int bpp)
+{
+    SDL_Surface *sprite;
+    int x, y;
+
+    if (bpp == 8) {
+        SDL_Color colors[256];
+        int i;
+
+        sprite = SDL_CreateRGBSurface(0, SPRITE_SIZE, SPRITE_SIZE, 8,
+                                      0, 0, 0, 0);
+        if (!sprite) {
+            return NULL;
+        }
+        for (i = 0; i < SDL_arraysize(colors); ++i) {
+            colors[i].r = (Uint8) i;
+            colors[i].g = (Uint8) (255 - i);
+            colors[i].b = (Uint8) (i * 7);
+            colors[i].unused = 0;
+        }
+        SDL_SetPaletteColors(sprite->format->palette, colors, 0, 256);
+    } else {
+        sprite = SDL_CreateRGBSurface(0, SPRITE_SIZE, SPRITE_SIZE, 32,
+                                      0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+        if (!sprite) {
+            return NULL;
+        }
+    }
+
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint8 *row = (Uint8 *) sprite->pixels + y * sprite->pitch;
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            if (bpp == 8) {
+                row[x] = (Uint8) (x * 8 + y);
+            } else {
+                ((Uint32 *) row)[x] = SDL_MapRGB(sprite->format,
+                                                 (Uint8) (x * 8),
+                                                 (Uint8) (y * 8),
+                                                 (Uint8) (x + y));
+            }
+        }
+    }
+    return sprite;
+}
+
+static void
+Setup(SDL_Surface * sprite, int blendMode, Uint8 r, Uint8 g, Uint8 b,
+      Uint8 a)
+{
+    SDL_SetSurfaceBlendMode(sprite, blendMode);
+    SDL_SetSurfaceColorMod(sprite, r, g, b);
+    SDL_SetSurfaceAlphaMod(sprite, a);
+}
+
+static void
+Fill(SDL_Surface * surface)
+{
+    SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 0x40, 0x80,
+                                           0xC0));
+}
+
+static int
+Compare(SDL_Surface * a, SDL_Surface * b)
+{
+    int y;
+
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *) a->pixels + y * a->pitch,
+                       (Uint8 *) b->pixels + y * b->pitch,
+                       a->w * a->format->BytesPerPixel) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int
+TestChanges(int bpp)
+{
+    static const struct
+    {
+        int blendMode;
+        Uint8 r, g, b, a;
+    } steps[] = {
+        {SDL_BLENDMODE_NONE, 0xFF, 0xFF, 0xFF, 0xFF},
+        {SDL_BLENDMODE_BLEND, 0xFF, 0xFF, 0xFF, 0x80},
+        {SDL_BLENDMODE_BLEND, 0xFF, 0xFF, 0xFF, 0x40},
+        {SDL_BLENDMODE_BLEND, 0xFF, 0xFF, 0xFF, 0xFF},
+        {SDL_BLENDMODE_NONE, 0xC0, 0x80, 0x40, 0xFF},
+        {SDL_BLENDMODE_NONE, 0x40, 0x80, 0xC0, 0xFF},
+        {SDL_BLENDMODE_BLEND, 0x40, 0x80, 0xC0, 0x20},
+        {SDL_BLENDMODE_ADD, 0xFF, 0xFF, 0xFF, 0xFF},
+        {SDL_BLENDMODE_BLEND, 0xFF, 0xFF, 0xFF, 0xA0},
+        {SDL_BLENDMODE_NONE, 0xFF, 0xFF, 0xFF, 0xFF},
+    };
+    SDL_Surface *sprite, *dst, *expected;
+    int i, errors = 0;
+
+    sprite = CreateSprite(bpp);
+    dst = SDL_CreateRGBSurface(0, SPRITE_SIZE, SPRITE_SIZE, 16,
+                               0xF800, 0x07E0, 0x001F, 0);
+    expected = SDL_CreateRGBSurface(0, SPRITE_SIZE, SPRITE_SIZE, 16,
+                                    0xF800, 0x07E0, 0x001F, 0);
+    if (!sprite || !dst || !expected) {
+        printf("Couldn't create surfaces: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < SDL_arraysize(steps); ++i) {
+        SDL_Surface *fresh = CreateSprite(bpp);
+        int result;
+
+        /* The sprite keeps its mapping, the fresh one starts over */
+        Setup(sprite, steps[i].blendMode, steps[i].r, steps[i].g,
+              steps[i].b, steps[i].a);
+        Setup(fresh, steps[i].blendMode, steps[i].r, steps[i].g,
+              steps[i].b, steps[i].a);
+        Fill(dst);
+        Fill(expected);
+        result = SDL_BlitSurface(sprite, NULL, dst, NULL);
+        if (SDL_BlitSurface(fresh, NULL, expected, NULL) != result) {
+            printf("%d bpp, step %d: blits returned different results\n",
+                   bpp, i);
+            ++errors;
+        } else if (Compare(dst, expected)) {
+            printf("%d bpp, step %d: blits drew different pixels\n", bpp,
+                   i);
+            ++errors;
+        }
+        SDL_FreeSurface(fresh);
+    }
+
+    SDL_FreeSurface(sprite);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(expected);
+    return errors;
+}
+
+static void
+TimeDraws(const char *what, SDL_bool color)
+{
+    SDL_Surface *sprite, *dst;
+    Uint64 start, ticks;
+    int i;
+
+    sprite = CreateSprite(32);
+    dst = SDL_CreateRGBSurface(0, 640, 480, 32, 0x00FF0000, 0x0000FF00,
+                               0x000000FF, 0);
+    if (!sprite || !dst) {
+        return;
+    }
+    SDL_SetSurfaceBlendMode(sprite, SDL_BLENDMODE_BLEND);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_DRAWS; ++i) {
+        SDL_Rect srcrect, dstrect;
+
+        /* Every other draw is modulated, so the blit changes every time */
+        if (color) {
+            SDL_SetSurfaceColorMod(sprite, 0xFF, (i & 1) ? 0x80 : 0xFF,
+                                   0xFF);
+        } else {
+            SDL_SetSurfaceAlphaMod(sprite, (i & 1) ? 0x80 : 0xFF);
+        }
+        srcrect.x = srcrect.y = 0;
+        srcrect.w = srcrect.h = DRAW_SIZE;
+        dstrect.x = (i * 13) % (dst->w - DRAW_SIZE);
+        dstrect.y = (i * 7) % (dst->h - DRAW_SIZE);
+        SDL_BlitSurface(sprite, &srcrect, dst, &dstrect);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    printf("%d %s changes and %dx%d blits: %.3f us each\n", NUM_DRAWS,
+           what, DRAW_SIZE, DRAW_SIZE,
+           (double) ticks * 1000000.0 / SDL_GetPerformanceFrequency() /
+           NUM_DRAWS);
+
+    SDL_FreeSurface(sprite);
+    SDL_FreeSurface(dst);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors = 0;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    errors += TestChanges(32);
+    errors += TestChanges(8);
+    TimeDraws("alpha", SDL_FALSE);
+    TimeDraws("colour", SDL_TRUE);
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
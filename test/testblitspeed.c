@@ -13,6 +13,7 @@
 static SDL_Surface *dest = NULL;
 static SDL_Surface *src = NULL;
 static int testSeconds = 10;
+static char threadsEnv[32];
 
 
 static int
@@ -187,6 +188,14 @@ atoi_hex(const char *str)
     return (atoi(str));
 }
 
+static void
+set_blit_threads(int threads)
+{
+    /* Read by SDL_Init(), so this has to happen before it. */
+    sprintf(threadsEnv, "SDL_BLIT_THREADS=%d", threads);
+    SDL_putenv(threadsEnv);
+}
+
 
 static int
 setup_test(int argc, char **argv)
@@ -261,6 +270,8 @@ setup_test(int argc, char **argv)
             screenSurface = 1;
         else if (strcmp(arg, "--dumpfile") == 0)
             dumpfile = argv[++i];
+        else if (strcmp(arg, "--threads") == 0)
+            set_blit_threads(atoi(argv[++i]));
         /* !!! FIXME: set colorkey. */
         else if (0) {           /* !!! FIXME: we handle some commandlines elsewhere now */
             fprintf(stderr, "Unknown commandline option: %s\n", arg);
@@ -361,7 +372,7 @@ setup_test(int argc, char **argv)
 }
 
 
-static void
+static int
 test_blit_speed(void)
 {
     Uint32 clearColor = SDL_MapRGB(dest->format, 0, 0, 0);
@@ -402,16 +413,62 @@ test_blit_speed(void)
     printf("Non-blitting crap accounted for %d percent of this run.\n",
            percent(testms - elasped, testms));
 
+    if (elasped == 0)
+        elasped = 1;
     printf("%d blits took %d ms (%d fps).\n",
            (int) iterations,
            (int) elasped,
            (int) (((float) iterations) / (((float) elasped) / 1000.0f)));
+
+    return (int) (((float) iterations) / (((float) elasped) / 1000.0f));
+}
+
+/* Run the same test with 1 through maxthreads blit threads. */
+static int
+test_thread_scaling(int argc, char **argv, int maxthreads)
+{
+    int results[16];
+    int threads;
+
+    if (maxthreads > (int) (sizeof(results) / sizeof(results[0])))
+        maxthreads = (int) (sizeof(results) / sizeof(results[0]));
+
+    for (threads = 1; threads <= maxthreads; threads++) {
+        printf("=== %d blit thread(s) ===\n", threads);
+        set_blit_threads(threads);
+        if (!setup_test(argc, argv))
+            return (0);
+        results[threads - 1] = test_blit_speed();
+        SDL_Quit();
+        printf("\n");
+    }
+
+    printf("Thread scaling:\n");
+    for (threads = 1; threads <= maxthreads; threads++) {
+        printf("  %2d thread(s): %6d fps (%d percent of 1 thread)\n",
+               threads, results[threads - 1],
+               percent(results[threads - 1], results[0] ? results[0] : 1));
+    }
+    return (1);
 }
 
 int
 main(int argc, char **argv)
 {
-    int initialized = setup_test(argc, argv);
+    int initialized = 0;
+    int maxthreads = 0;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threadscaling") == 0 && (i + 1) < argc)
+            maxthreads = atoi(argv[++i]);
+    }
+
+    if (maxthreads > 0) {
+        return (!test_thread_scaling(argc, argv, maxthreads));
+    }
+
+    initialized = setup_test(argc, argv);
     if (initialized) {
         test_blit_speed();
         SDL_Quit();
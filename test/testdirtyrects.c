@@ -0,0 +1,209 @@
+
+/*
+ * Draws with the software renderer, which only copies the parts of the
+ * frame that changed to the display, and checks that the display ends up
+ * showing everything that was drawn.  Then it times presenting frames of
+ * many small sprites, and of a few large ones that cover most of the
+ * window.
+ *
+ * This uses the dummy video driver, which can save the frames it shows.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define WINDOW_W    640
+#define WINDOW_H    480
+#define NUM_FRAMES  200
+
+static SDL_Surface *reference;
+
+static int
+CreateSoftwareRenderer(SDL_WindowID window)
+{
+    int i;
+
+    for (i = 0; i < SDL_GetNumRenderDrivers(); ++i) {
+        SDL_RendererInfo info;
+
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 &&
+            SDL_strcmp(info.name, "software") == 0) {
+            return SDL_CreateRenderer(window, i, 0);
+        }
+    }
+    SDL_SetError("No software renderer");
+    return -1;
+}
+
+/* Fill a rectangle on the window and on the reference picture */
+static void
+Fill(int x, int y, int w, int h, Uint8 r, Uint8 g, Uint8 b)
+{
+    SDL_Rect rect;
+
+    rect.x = x;
+    rect.y = y;
+    rect.w = w;
+    rect.h = h;
+    SDL_SetRenderDrawColor(r, g, b, 0xFF);
+    SDL_RenderFill(&rect);
+    SDL_FillRect(reference, &rect, SDL_MapRGB(reference->format, r, g, b));
+}
+
+static void
+Point(int x, int y, Uint8 r, Uint8 g, Uint8 b)
+{
+    SDL_SetRenderDrawColor(r, g, b, 0xFF);
+    SDL_RenderPoint(x, y);
+    if (x >= 0 && y >= 0 && x < reference->w && y < reference->h) {
+        *((Uint32 *) ((Uint8 *) reference->pixels + y * reference->pitch) +
+          x) = SDL_MapRGB(reference->format, r, g, b);
+    }
+}
+
+static int
+TestUpdates(void)
+{
+    SDL_WindowID window;
+    SDL_Surface *saved;
+    char file[128];
+    int frame, i, x, y, errors = 0;
+
+    window = SDL_CreateWindow("testdirtyrects", 0, 0, WINDOW_W, WINDOW_H, 0);
+    if (!window || CreateSoftwareRenderer(window) < 0) {
+        printf("Couldn't create a renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+    reference = SDL_CreateRGBSurface(0, WINDOW_W, WINDOW_H, 32, 0x00FF0000,
+                                     0x0000FF00, 0x000000FF, 0);
+    if (!reference) {
+        printf("Couldn't create a surface: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    srand(1);
+    for (frame = 0; frame < 50; ++frame) {
+        /* Small things all over, some hanging off the edges */
+        for (i = 0; i < 100; ++i) {
+            Fill((rand() % (WINDOW_W + 40)) - 20,
+                 (rand() % (WINDOW_H + 40)) - 20,
+                 1 + rand() % 40, 1 + rand() % 40,
+                 (Uint8) rand(), (Uint8) rand(), (Uint8) rand());
+        }
+        for (i = 0; i < 20; ++i) {
+            Point(rand() % WINDOW_W, rand() % WINDOW_H,
+                  (Uint8) rand(), (Uint8) rand(), (Uint8) rand());
+        }
+
+        /* Every so often, most of the window */
+        if (frame % 10 == 9) {
+            Fill(rand() % 50, rand() % 50, WINDOW_W - 60, WINDOW_H - 60,
+                 (Uint8) rand(), (Uint8) rand(), (Uint8) rand());
+        }
+
+        /* Have the dummy driver save the last frame */
+        if (frame == 49) {
+            SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=1");
+        }
+        SDL_RenderPresent();
+    }
+
+    SDL_snprintf(file, sizeof(file), "SDL_window%d-%8.8d.bmp", window, 1);
+    saved = SDL_LoadBMP(file);
+    remove(file);
+    if (saved) {
+        SDL_Surface *converted;
+
+        converted = SDL_ConvertSurface(saved, reference->format, 0);
+        SDL_FreeSurface(saved);
+        saved = converted;
+    }
+    if (!saved) {
+        printf("Couldn't load %s: %s\n", file, SDL_GetError());
+        return 1;
+    }
+    for (y = 0; y < WINDOW_H && errors < 10; ++y) {
+        const Uint32 *want = (const Uint32 *) ((Uint8 *) reference->pixels +
+                                               y * reference->pitch);
+        const Uint32 *got = (const Uint32 *) ((Uint8 *) saved->pixels +
+                                              y * saved->pitch);
+
+        for (x = 0; x < WINDOW_W && errors < 10; ++x) {
+            if ((got[x] & 0x00FFFFFF) != (want[x] & 0x00FFFFFF)) {
+                printf("Pixel %d,%d is %6.6X, not %6.6X\n", x, y,
+                       got[x] & 0x00FFFFFF, want[x] & 0x00FFFFFF);
+                ++errors;
+            }
+        }
+    }
+    SDL_FreeSurface(saved);
+    SDL_FreeSurface(reference);
+    SDL_DestroyWindow(window);
+    return errors;
+}
+
+static void
+TimePresents(const char *what, int count, int size)
+{
+    SDL_WindowID window;
+    Uint64 drawing = 0, presenting = 0, start;
+    int frame, i;
+
+    window = SDL_CreateWindow("testdirtyrects", 0, 0, WINDOW_W, WINDOW_H, 0);
+    if (!window || CreateSoftwareRenderer(window) < 0) {
+        return;
+    }
+
+    srand(2);
+    for (frame = 0; frame < NUM_FRAMES; ++frame) {
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < count; ++i) {
+            SDL_Rect rect;
+
+            rect.x = rand() % (WINDOW_W - size);
+            rect.y = rand() % (WINDOW_H - size);
+            rect.w = size;
+            rect.h = size;
+            SDL_SetRenderDrawColor((Uint8) i, (Uint8) frame, 0x80, 0xFF);
+            SDL_RenderFill(&rect);
+        }
+        drawing += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        SDL_RenderPresent();
+        presenting += SDL_GetPerformanceCounter() - start;
+    }
+    printf("%-32s drawing %8.1f us, presenting %8.1f us a frame\n", what,
+           (double) drawing * 1000000.0 / SDL_GetPerformanceFrequency() /
+           NUM_FRAMES,
+           (double) presenting * 1000000.0 / SDL_GetPerformanceFrequency() /
+           NUM_FRAMES);
+
+    SDL_DestroyWindow(window);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors;
+
+    /* The frames can only be checked with the dummy driver */
+    SDL_putenv("SDL_VIDEODRIVER=dummy");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    TimePresents("500 sprites of 8x8:", 500, 8);
+    TimePresents("200 sprites of 32x32:", 200, 32);
+    TimePresents("20 sprites of 320x240:", 20, 320);
+
+    /* This leaves the dummy driver saving frames, so it goes last */
+    errors = TestUpdates();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
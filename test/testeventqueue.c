@@ -0,0 +1,332 @@
+
+/*
+ * Pushes events at the event queue from several threads while the main
+ * thread reads them back, and checks that nothing is lost or reordered.
+ *
+ * Each thread numbers its own events and pushes each one again until the
+ * queue takes it, so the reader can tell that every thread's events arrive
+ * exactly once and in order, and that the queue counted every push it
+ * turned away.  Then it checks
+ * cutting events out of the middle of the queue with a mask, filtering,
+ * and overflowing the queue, and prints how fast events went through.
+ *
+ * Last, window manager events are pushed, more at once than the queue
+ * used to keep messages for, and from several threads, and each one
+ * must come back with its own message.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "SDL_syswm.h"
+
+#define NUM_THREADS 4
+#define NUM_EVENTS  200000      /* per thread */
+#define BATCH       64
+#define NUM_WMMSGS  300
+#define NUM_WM_EVENTS   20000   /* per thread */
+
+#define EVENT_A     SDL_USEREVENT
+#define EVENT_B     (SDL_USEREVENT + 1)
+
+static int failed[NUM_THREADS];
+
+static int SDLCALL
+Producer(void *data)
+{
+    const int id = (int) (size_t) data;
+    SDL_Event event;
+    int i;
+
+    SDL_memset(&event, 0, sizeof(event));
+    event.type = EVENT_A;
+    event.user.code = id;
+    for (i = 0; i < NUM_EVENTS; ++i) {
+        event.user.data1 = (void *) (size_t) i;
+        while (SDL_PushEvent(&event) != 1) {
+            /* The queue is full, wait for the reader to catch up */
+            ++failed[id];
+            SDL_Delay(1);
+        }
+    }
+    return 0;
+}
+
+static int
+TestProducers(void)
+{
+    SDL_Thread *threads[NUM_THREADS];
+    SDL_Event events[BATCH];
+    int next[NUM_THREADS];
+    int received = 0, lost = 0;
+    int i, n, peak, dropped;
+    int error = 0;
+    Uint32 start, elapsed;
+
+    start = SDL_GetTicks();
+    for (i = 0; i < NUM_THREADS; ++i) {
+        next[i] = 0;
+        threads[i] = SDL_CreateThread(Producer, (void *) (size_t) i);
+    }
+
+    while (received < NUM_THREADS * NUM_EVENTS) {
+        n = SDL_PeepEvents(events, BATCH, SDL_GETEVENT,
+                           SDL_EVENTMASK(EVENT_A));
+        if (n < 0) {
+            printf("SDL_PeepEvents() failed: %s\n", SDL_GetError());
+            return 1;
+        }
+        for (i = 0; i < n; ++i) {
+            const int id = events[i].user.code;
+            const int seq = (int) (size_t) events[i].user.data1;
+            if (seq != next[id]) {
+                printf("Thread %d: got event %d, expected %d\n", id, seq,
+                       next[id]);
+                error = 1;
+            }
+            next[id] = seq + 1;
+        }
+        received += n;
+    }
+    elapsed = SDL_GetTicks() - start;
+
+    for (i = 0; i < NUM_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+        lost += failed[i];
+    }
+    SDL_GetEventQueueStats(NULL, &peak, &dropped);
+    if (dropped != lost) {
+        printf("%d pushes were turned away, but the queue says %d\n", lost,
+               dropped);
+        error = 1;
+    }
+    printf("%d threads: %d events in %u ms (%.2f M/s), peak depth %d, "
+           "%d dropped\n", NUM_THREADS, received, elapsed,
+           elapsed ? (double) received / elapsed / 1000.0 : 0.0, peak,
+           dropped);
+    return error;
+}
+
+static void
+PushNumbered(Uint8 type, int seq)
+{
+    SDL_Event event;
+
+    SDL_memset(&event, 0, sizeof(event));
+    event.type = type;
+    event.user.data1 = (void *) (size_t) seq;
+    SDL_PushEvent(&event);
+}
+
+static int SDLCALL
+KeepOdd(void *userdata, SDL_Event * event)
+{
+    return ((size_t) event->user.data1) & 1;
+}
+
+static int
+TestCutting(void)
+{
+    SDL_Event events[100];
+    int i, n;
+    int error = 0;
+
+    /* Take the B events out from between the A events */
+    for (i = 0; i < 100; ++i) {
+        PushNumbered((i % 3) ? EVENT_A : EVENT_B, i);
+    }
+    n = SDL_PeepEvents(events, 100, SDL_GETEVENT, SDL_EVENTMASK(EVENT_B));
+    for (i = 0; i < n; ++i) {
+        if (events[i].type != EVENT_B ||
+            (size_t) events[i].user.data1 != (size_t) (i * 3)) {
+            error = 1;
+        }
+    }
+    if (n != 34) {
+        error = 1;
+    }
+
+    /* Filter out the even ones, then the rest must be the odd A events */
+    SDL_FilterEvents(KeepOdd, NULL);
+    n = SDL_PeepEvents(events, 100, SDL_GETEVENT, SDL_ALLEVENTS);
+    for (i = 0; i < n; ++i) {
+        const int seq = (int) (size_t) events[i].user.data1;
+        if (events[i].type != EVENT_A || !(seq & 1) || !(seq % 3) ||
+            (i > 0 && seq <= (int) (size_t) events[i - 1].user.data1)) {
+            error = 1;
+        }
+    }
+    if (n != 33) {
+        error = 1;
+    }
+    if (error) {
+        printf("Cutting and filtering events gave the wrong result\n");
+    }
+    return error;
+}
+
+static int
+TestOverflow(void)
+{
+    SDL_Event event;
+    int i, queued, peak, dropped, before;
+    int added = 0;
+    int error = 0;
+
+    SDL_GetEventQueueStats(NULL, NULL, &before);
+    for (i = 0; i < 100000; ++i) {
+        PushNumbered(EVENT_A, i);
+    }
+    SDL_GetEventQueueStats(&queued, &peak, &dropped);
+    while (SDL_PollEvent(&event)) {
+        if ((size_t) event.user.data1 != (size_t) added) {
+            error = 1;
+        }
+        ++added;
+    }
+    if (error || added != queued || added + dropped - before != 100000) {
+        printf("Overflow: %d queued, %d read back, %d dropped\n", queued,
+               added, dropped - before);
+        error = 1;
+    }
+    printf("Queue holds %d events (peak %d)\n", queued, peak);
+    return error;
+}
+
+/* The message starts with who sent it, the rest is a pattern from that */
+static void
+MakeMessage(SDL_SysWMmsg * msg, int id, int seq)
+{
+    Uint8 *bytes = (Uint8 *) msg;
+    size_t i;
+
+    SDL_memcpy(&bytes[0], &id, sizeof(id));
+    SDL_memcpy(&bytes[sizeof(id)], &seq, sizeof(seq));
+    for (i = sizeof(id) + sizeof(seq); i < sizeof(*msg); ++i) {
+        bytes[i] = (Uint8) (id * 7 + seq * 31 + i);
+    }
+}
+
+static int
+CheckMessage(const SDL_Event * event, int *id, int *seq)
+{
+    SDL_SysWMmsg expected;
+
+    if (event->type != SDL_SYSWMEVENT || !event->syswm.msg) {
+        return 1;
+    }
+    SDL_memcpy(id, event->syswm.msg, sizeof(*id));
+    SDL_memcpy(seq, (Uint8 *) event->syswm.msg + sizeof(*id),
+               sizeof(*seq));
+    MakeMessage(&expected, *id, *seq);
+    return SDL_memcmp(&expected, event->syswm.msg, sizeof(expected)) != 0;
+}
+
+static void
+PushMessage(int id, int seq)
+{
+    SDL_SysWMmsg msg;
+    SDL_Event event;
+
+    MakeMessage(&msg, id, seq);
+    SDL_memset(&event, 0, sizeof(event));
+    event.type = SDL_SYSWMEVENT;
+    event.syswm.msg = &msg;
+    while (SDL_PushEvent(&event) != 1) {
+        SDL_Delay(1);
+    }
+}
+
+static int SDLCALL
+WMProducer(void *data)
+{
+    const int id = (int) (size_t) data;
+    int i;
+
+    for (i = 0; i < NUM_WM_EVENTS; ++i) {
+        PushMessage(id, i);
+    }
+    return 0;
+}
+
+static int
+TestSysWM(void)
+{
+    SDL_Thread *threads[NUM_THREADS];
+    SDL_Event events[BATCH];
+    int next[NUM_THREADS];
+    int received = 0;
+    int i, n, id, seq;
+    int error = 0;
+
+    /* All of them queued before any is read */
+    for (i = 0; i < NUM_WMMSGS; ++i) {
+        PushMessage(0, i);
+    }
+    for (i = 0; i < NUM_WMMSGS; ++i) {
+        if (SDL_PeepEvents(events, 1, SDL_GETEVENT,
+                           SDL_EVENTMASK(SDL_SYSWMEVENT)) != 1 ||
+            CheckMessage(&events[0], &id, &seq) || id != 0 || seq != i) {
+            printf("Window manager event %d came back wrong\n", i);
+            error = 1;
+            break;
+        }
+    }
+    while (SDL_PeepEvents(events, BATCH, SDL_GETEVENT, SDL_ALLEVENTS) > 0);
+
+    for (i = 0; i < NUM_THREADS; ++i) {
+        next[i] = 0;
+        threads[i] = SDL_CreateThread(WMProducer, (void *) (size_t) i);
+    }
+    while (received < NUM_THREADS * NUM_WM_EVENTS) {
+        n = SDL_PeepEvents(events, BATCH, SDL_GETEVENT,
+                           SDL_EVENTMASK(SDL_SYSWMEVENT));
+        if (n < 0) {
+            printf("SDL_PeepEvents() failed: %s\n", SDL_GetError());
+            error = 1;
+            break;
+        }
+        for (i = 0; i < n; ++i) {
+            if (CheckMessage(&events[i], &id, &seq) || id < 0 ||
+                id >= NUM_THREADS || seq != next[id]) {
+                if (!error) {
+                    printf("A window manager event from a thread came back "
+                           "wrong\n");
+                }
+                error = 1;
+                continue;
+            }
+            next[id] = seq + 1;
+        }
+        received += n;
+    }
+    for (i = 0; i < NUM_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    return error;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors = 0;
+
+    /* Any video driver will do, so don't open a display */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    errors += TestProducers();
+    errors += TestCutting();
+    errors += TestOverflow();
+    errors += TestSysWM();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
@@ -4,6 +4,7 @@
 #include <stdlib.h>
 
 #ifndef _MSC_VER
+#include <fcntl.h>
 #include <unistd.h>
 #endif
 
@@ -264,6 +265,180 @@ main(int argc, char *argv[])
         RWOP_ERR_QUIT(rwops);
     rwops->close(rwops);
     printf("test5 OK\n");
+
+/* test6 : memory mapped file */
+    rwops = SDL_RWFromMappedFile(FBASENAME2);   /* this file doesn't exist that call must fail */
+    if (rwops)
+        RWOP_ERR_QUIT(rwops);
+    rwops = SDL_RWFromMappedFile(FBASENAME1);
+    if (!rwops)
+        RWOP_ERR_QUIT(rwops);
+    if (20 + 27 != rwops->seek(rwops, -7, RW_SEEK_END))
+        RWOP_ERR_QUIT(rwops);
+    if (7 != rwops->read(rwops, test_buf, 1, 7))
+        RWOP_ERR_QUIT(rwops);
+    if (SDL_memcmp(test_buf, "1234567", 7))
+        RWOP_ERR_QUIT(rwops);
+    if (0 != rwops->read(rwops, test_buf, 1, 1))
+        RWOP_ERR_QUIT(rwops);
+    if (0 != rwops->seek(rwops, 0L, RW_SEEK_SET))
+        RWOP_ERR_QUIT(rwops);
+    if (3 != rwops->read(rwops, test_buf, 10, 3))
+        RWOP_ERR_QUIT(rwops);
+    if (SDL_memcmp(test_buf, "123456789012345678901234567123", 30))
+        RWOP_ERR_QUIT(rwops);
+    {
+        const void *mem;
+        size_t size;
+
+        mem = SDL_RWGetMemory(rwops, &size);
+#if defined(HAVE_MMAP) && defined(HAVE_UNISTD_H)
+        if (!mem)               /* a regular file is always mapped here */
+            RWOP_ERR_QUIT(rwops);
+#endif
+        if (mem) {              /* NULL if the file couldn't be mapped */
+            if (size != 27 + 27)
+                RWOP_ERR_QUIT(rwops);
+            if (SDL_memcmp(mem, "123456789012345678901234567123", 30))
+                RWOP_ERR_QUIT(rwops);
+        }
+    }
+    rwops->close(rwops);
+    printf("test6 OK\n");
+
+/* test7 : buffered reads, with a small buffer to fill often */
+    {
+        SDL_RWops *source;
+        Uint32 value;
+
+        source = SDL_RWFromFile(FBASENAME1, "rb+");
+        if (!source)
+            RWOP_ERR_QUIT(source);
+        if (5 != source->seek(source, 5, RW_SEEK_SET))
+            RWOP_ERR_QUIT(source);
+        rwops = SDL_RWFromBufferedRW(source, 8, SDL_FALSE);
+        if (!rwops)
+            RWOP_ERR_QUIT(source);
+        if (5 != rwops->seek(rwops, 0L, RW_SEEK_CUR))
+            RWOP_ERR_QUIT(rwops);
+        if (3 != rwops->read(rwops, test_buf, 4, 3))
+            RWOP_ERR_QUIT(rwops);       /* across the end of the buffer */
+        if (SDL_memcmp(test_buf, "678901234567", 12))
+            RWOP_ERR_QUIT(rwops);
+        if (13 != rwops->seek(rwops, -4, RW_SEEK_CUR))
+            RWOP_ERR_QUIT(rwops);       /* within the buffer */
+        SDL_memcpy(&value, "4567", 4);
+        if (SDL_ReadLE32(rwops) != SDL_SwapLE32(value))
+            RWOP_ERR_QUIT(rwops);
+        if (27 + 27 - 7 != rwops->seek(rwops, -7, RW_SEEK_END))
+            RWOP_ERR_QUIT(rwops);
+        if (7 != rwops->read(rwops, test_buf, 1, 7))
+            RWOP_ERR_QUIT(rwops);
+        if (SDL_memcmp(test_buf, "1234567", 7))
+            RWOP_ERR_QUIT(rwops);
+        if (0 != rwops->read(rwops, test_buf, 1, 1))
+            RWOP_ERR_QUIT(rwops);
+        if (0 != rwops->seek(rwops, 0L, RW_SEEK_SET))
+            RWOP_ERR_QUIT(rwops);
+        if (3 != rwops->read(rwops, test_buf, 10, 3))
+            RWOP_ERR_QUIT(rwops);       /* bigger than the buffer */
+        if (SDL_memcmp(test_buf, "123456789012345678901234567123", 30))
+            RWOP_ERR_QUIT(rwops);
+
+        /* Writes go to the source, where reading had got to */
+        if (2 != rwops->seek(rwops, 2L, RW_SEEK_SET))
+            RWOP_ERR_QUIT(rwops);
+        if (1 != rwops->read(rwops, test_buf, 1, 1))
+            RWOP_ERR_QUIT(rwops);
+        if (1 != rwops->write(rwops, "ab", 2, 1))
+            RWOP_ERR_QUIT(rwops);
+        if (5 != rwops->seek(rwops, 0L, RW_SEEK_CUR))
+            RWOP_ERR_QUIT(rwops);
+        if (0 != rwops->seek(rwops, 0L, RW_SEEK_SET))
+            RWOP_ERR_QUIT(rwops);
+        if (1 != rwops->read(rwops, test_buf, 1, 1))
+            RWOP_ERR_QUIT(rwops);
+        if (7 != rwops->read(rwops, test_buf + 1, 1, 7))
+            RWOP_ERR_QUIT(rwops);
+        if (SDL_memcmp(test_buf, "123ab678", 8))
+            RWOP_ERR_QUIT(rwops);
+
+        /* Closing gives back what was read ahead */
+        rwops->close(rwops);
+        if (8 != source->seek(source, 0L, RW_SEEK_CUR))
+            RWOP_ERR_QUIT(source);
+        source->close(source);
+    }
+    printf("test7 OK\n");
+
+/* test8 : sizes, and file descriptors */
+    rwops = SDL_RWFromFile(FBASENAME1, "rb+");
+    if (!rwops)
+        RWOP_ERR_QUIT(rwops);
+    if (27 + 27 != rwops->size(rwops))
+        RWOP_ERR_QUIT(rwops);
+    if (0 != rwops->seek(rwops, 0L, RW_SEEK_CUR))
+        RWOP_ERR_QUIT(rwops);   /* finding the size doesn't move */
+    if (27 + 27 != rwops->seek(rwops, 0L, RW_SEEK_END))
+        RWOP_ERR_QUIT(rwops);
+    if (1 != rwops->write(rwops, "xyz", 3, 1))
+        RWOP_ERR_QUIT(rwops);
+    if (27 + 27 + 3 != rwops->size(rwops))
+        RWOP_ERR_QUIT(rwops);   /* counts writes that aren't flushed */
+    rwops->close(rwops);
+
+    rwops = SDL_RWFromConstMem(test_buf, 30);
+    if (!rwops)
+        RWOP_ERR_QUIT(rwops);
+    if (30 != rwops->size(rwops))
+        RWOP_ERR_QUIT(rwops);
+    if (0 != rwops->seek(rwops, -5, RW_SEEK_SET))
+        RWOP_ERR_QUIT(rwops);
+    if (30 != rwops->seek(rwops, 100, RW_SEEK_END))
+        RWOP_ERR_QUIT(rwops);
+    rwops->close(rwops);
+
+#ifndef _MSC_VER
+    {
+        SDL_RWops *source;
+
+        rwops = SDL_RWFromFD(open(FBASENAME1, O_RDWR), SDL_TRUE);
+        if (!rwops)
+            RWOP_ERR_QUIT(rwops);
+        if (27 + 27 + 3 != rwops->size(rwops))
+            RWOP_ERR_QUIT(rwops);
+        if (27 + 27 != rwops->seek(rwops, -3, RW_SEEK_END))
+            RWOP_ERR_QUIT(rwops);
+        if (3 != rwops->read(rwops, test_buf, 1, 3))
+            RWOP_ERR_QUIT(rwops);
+        if (SDL_memcmp(test_buf, "xyz", 3))
+            RWOP_ERR_QUIT(rwops);
+        if (0 != rwops->read(rwops, test_buf, 1, 1))
+            RWOP_ERR_QUIT(rwops);
+        if (3 != rwops->seek(rwops, 3L, RW_SEEK_SET))
+            RWOP_ERR_QUIT(rwops);
+        if (1 != rwops->write(rwops, "45", 2, 1))
+            RWOP_ERR_QUIT(rwops);
+        if (0 != rwops->seek(rwops, 0L, RW_SEEK_SET))
+            RWOP_ERR_QUIT(rwops);
+        if (3 != rwops->read(rwops, test_buf, 10, 3))
+            RWOP_ERR_QUIT(rwops);
+        if (SDL_memcmp(test_buf, "123456789012345678901234567123", 30))
+            RWOP_ERR_QUIT(rwops);
+
+        /* A buffered SDL_RWops asks its source for the size */
+        source = rwops;
+        rwops = SDL_RWFromBufferedRW(source, 8, SDL_TRUE);
+        if (!rwops)
+            RWOP_ERR_QUIT(source);
+        if (27 + 27 + 3 != rwops->size(rwops))
+            RWOP_ERR_QUIT(rwops);
+        if (30 != rwops->seek(rwops, 0L, RW_SEEK_CUR))
+            RWOP_ERR_QUIT(rwops);
+        rwops->close(rwops);    /* closes the file descriptor too */
+    }
+#endif
+    printf("test8 OK\n");
     cleanup();
     return 0;                   /* all ok */
 }
@@ -0,0 +1,220 @@
+
+/*
+ * Checks bilinear filtered scaling: that SDL_SoftStretchLinear() and
+ * blits with SDL_TEXTURESCALEMODE_SLOW give exactly the same pixels as a
+ * plain C version of the filter, on random pictures scaled up and down.
+ * The library uses SSE2 where it can and C for the pixels left over, so
+ * odd sizes check both against the same reference.  Then it checks that
+ * the software renderer says it can do filtered scaling.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define LINEAR_BITS     7
+#define LINEAR_ONE      (1 << LINEAR_BITS)
+
+/* The source position and weight for each destination pixel */
+static void
+Positions(int src_len, int dst_len, int *ofs, int *weights)
+{
+    int i, pos, inc;
+
+    inc = (src_len << 16) / dst_len;
+    pos = (inc >> 1) - 0x8000;
+    for (i = 0; i < dst_len; ++i) {
+        ofs[i] = 0;
+        weights[i] = 0;
+        if (pos > 0) {
+            ofs[i] = pos >> 16;
+            weights[i] = (pos >> (16 - LINEAR_BITS)) & (LINEAR_ONE - 1);
+        }
+        if (ofs[i] >= src_len - 1) {
+            ofs[i] = src_len - 1;
+            weights[i] = 0;
+        }
+        pos += inc;
+    }
+}
+
+/* Filter horizontally into 16 bits, then vertically with rounding */
+static void
+ReferenceScale(SDL_Surface * src, SDL_Surface * dst)
+{
+    int *xofs, *xweight, *yofs, *yweight;
+    int x, y, c;
+
+    xofs = (int *) SDL_malloc(2 * (dst->w + dst->h) * sizeof(int));
+    xweight = xofs + dst->w;
+    yofs = xweight + dst->w;
+    yweight = yofs + dst->h;
+    Positions(src->w, dst->w, xofs, xweight);
+    Positions(src->h, dst->h, yofs, yweight);
+
+    for (y = 0; y < dst->h; ++y) {
+        const int y0 = yofs[y];
+        const int y1 = yweight[y] ? y0 + 1 : y0;
+        const Uint8 *row0 = (Uint8 *) src->pixels + y0 * src->pitch;
+        const Uint8 *row1 = (Uint8 *) src->pixels + y1 * src->pitch;
+        Uint8 *out = (Uint8 *) dst->pixels + y * dst->pitch;
+
+        for (x = 0; x < dst->w; ++x) {
+            const int x0 = xofs[x] * 4;
+            const int x1 = (xweight[x] ? xofs[x] + 1 : xofs[x]) * 4;
+            const int wx = xweight[x];
+            const int wy = yweight[y];
+
+            for (c = 0; c < 4; ++c) {
+                int h0 = row0[x0 + c] * (LINEAR_ONE - wx) + row0[x1 + c] * wx;
+                int h1 = row1[x0 + c] * (LINEAR_ONE - wx) + row1[x1 + c] * wx;
+
+                out[x * 4 + c] =
+                    (Uint8) ((h0 * (LINEAR_ONE - wy) + h1 * wy +
+                              (1 << (2 * LINEAR_BITS - 1))) >>
+                             (2 * LINEAR_BITS));
+            }
+        }
+    }
+    SDL_free(xofs);
+}
+
+static SDL_Surface *
+CreateSurface(int w, int h)
+{
+    return SDL_CreateRGBSurface(0, w, h, 32, 0x00FF0000, 0x0000FF00,
+                                0x000000FF, 0xFF000000);
+}
+
+static int
+Compare(const char *what, SDL_Surface * want, SDL_Surface * got)
+{
+    int x, y;
+
+    for (y = 0; y < want->h; ++y) {
+        const Uint32 *a = (Uint32 *) ((Uint8 *) want->pixels +
+                                      y * want->pitch);
+        const Uint32 *b = (Uint32 *) ((Uint8 *) got->pixels + y * got->pitch);
+
+        for (x = 0; x < want->w; ++x) {
+            if (a[x] != b[x]) {
+                printf("%s: pixel %d,%d is %8.8X, not %8.8X\n", what, x, y,
+                       b[x], a[x]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+TestScale(int src_w, int src_h, int dst_w, int dst_h)
+{
+    SDL_Surface *src, *want, *got;
+    SDL_Rect srcrect, dstrect;
+    char what[64];
+    int i, errors = 0;
+
+    src = CreateSurface(src_w, src_h);
+    want = CreateSurface(dst_w, dst_h);
+    got = CreateSurface(dst_w, dst_h);
+    if (!src || !want || !got) {
+        printf("Couldn't create surfaces: %s\n", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < src->h * src->pitch; ++i) {
+        ((Uint8 *) src->pixels)[i] = (Uint8) rand();
+    }
+    ReferenceScale(src, want);
+
+    SDL_snprintf(what, sizeof(what), "%dx%d to %dx%d", src_w, src_h, dst_w,
+                 dst_h);
+    if (SDL_SoftStretchLinear(src, NULL, got, NULL) < 0) {
+        printf("%s: SDL_SoftStretchLinear() failed: %s\n", what,
+               SDL_GetError());
+        ++errors;
+    } else {
+        errors += Compare(what, want, got);
+    }
+
+    /* A scaled blit that doesn't blend gives the same pixels */
+    SDL_FillRect(got, NULL, 0);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    if (SDL_SetSurfaceScaleMode(src, SDL_TEXTURESCALEMODE_SLOW) < 0) {
+        printf("Couldn't set the scale mode: %s\n", SDL_GetError());
+        ++errors;
+    } else {
+        srcrect.x = 0;
+        srcrect.y = 0;
+        srcrect.w = src_w;
+        srcrect.h = src_h;
+        dstrect.x = 0;
+        dstrect.y = 0;
+        dstrect.w = dst_w;
+        dstrect.h = dst_h;
+        SDL_LowerBlit(src, &srcrect, got, &dstrect);
+        SDL_strlcat(what, " blit", sizeof(what));
+        errors += Compare(what, want, got);
+    }
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(want);
+    SDL_FreeSurface(got);
+    return errors;
+}
+
+static int
+TestRendererInfo(void)
+{
+    SDL_RendererInfo info;
+    int i;
+
+    for (i = 0; i < SDL_GetNumRenderDrivers(); ++i) {
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 &&
+            SDL_strcmp(info.name, "software") == 0) {
+            if (!(info.scale_modes & SDL_TEXTURESCALEMODE_SLOW)) {
+                printf("The software renderer doesn't offer filtering\n");
+                return 1;
+            }
+            return 0;
+        }
+    }
+    printf("No software renderer\n");
+    return 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const int sizes[][4] = {
+        {1, 1, 7, 5},
+        {2, 2, 3, 3},
+        {16, 16, 16, 16},
+        {17, 13, 61, 47},
+        {320, 240, 640, 480},
+        {320, 240, 333, 251},
+        {640, 480, 100, 75},
+        {99, 77, 3, 2},
+        {5, 300, 301, 4},
+    };
+    int i, errors = 0;
+
+    SDL_putenv("SDL_VIDEODRIVER=dummy");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    printf("SSE2 %s\n", SDL_HasSSE2()? "detected" : "not detected");
+
+    srand(1);
+    for (i = 0; i < SDL_arraysize(sizes); ++i) {
+        errors += TestScale(sizes[i][0], sizes[i][1], sizes[i][2],
+                            sizes[i][3]);
+    }
+    errors += TestRendererInfo();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
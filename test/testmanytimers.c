@@ -0,0 +1,203 @@
+
+/*
+ * Runs thousands of timers at once and checks that each one runs on time,
+ * doesn't drift, and stops when it should.
+ *
+ * Every timer records how late each of its callbacks was compared to its
+ * original schedule.  Some timers cancel themselves by returning 0, some
+ * remove themselves from inside the callback, and a quarter of the rest
+ * are removed by the main thread halfway through.  Then a large number of
+ * timers are added and removed in random order to time the bookkeeping.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define NUM_TIMERS  5000
+#define RUN_MS      2000
+#define NUM_CHURN   20000
+#define SLACK_MS    50          /* time a busy system may steal from us */
+
+enum
+{
+    TIMER_PERIODIC,
+    TIMER_RETURNS_ZERO,
+    TIMER_REMOVES_ITSELF
+};
+
+typedef struct
+{
+    SDL_TimerID id;
+    int mode;
+    Uint32 interval;
+    Uint32 start;
+    volatile int calls;
+    volatile int early;
+    volatile Uint32 late_total;
+    volatile Uint32 late_max;
+    int removed_at;             /* calls when the main thread removed it */
+} TimerInfo;
+
+static TimerInfo timers[NUM_TIMERS];
+
+static Uint32 SDLCALL
+Callback(Uint32 interval, void *param)
+{
+    TimerInfo *info = (TimerInfo *) param;
+    Uint32 expected = info->start + (info->calls + 1) * info->interval;
+    Sint32 late = (Sint32) (SDL_GetTicks() - expected);
+
+    ++info->calls;
+    if (late < -1) {
+        ++info->early;
+    } else if (late > 0) {
+        info->late_total += late;
+        if ((Uint32) late > info->late_max) {
+            info->late_max = late;
+        }
+    }
+
+    switch (info->mode) {
+    case TIMER_RETURNS_ZERO:
+        return (info->calls == 3) ? 0 : interval;
+    case TIMER_REMOVES_ITSELF:
+        if (info->calls == 2 && !SDL_RemoveTimer(info->id)) {
+            ++info->early;      /* Count it as an error */
+        }
+        return interval;
+    default:
+        return interval;
+    }
+}
+
+static Uint32 SDLCALL
+Never(Uint32 interval, void *param)
+{
+    return interval;
+}
+
+static int
+TestTimers(void)
+{
+    Uint32 calls = 0, late_total = 0, late_max = 0, elapsed;
+    int i, error = 0;
+
+    for (i = 0; i < NUM_TIMERS; ++i) {
+        TimerInfo *info = &timers[i];
+        info->mode = (i % 10 == 1) ? TIMER_RETURNS_ZERO :
+            (i % 10 == 2) ? TIMER_REMOVES_ITSELF : TIMER_PERIODIC;
+        info->interval = 1 + rand() % 100;
+        info->removed_at = -1;
+        info->start = SDL_GetTicks();
+        info->id = SDL_AddTimer(info->interval, Callback, info);
+        if (!info->id) {
+            printf("Couldn't add timer %d: %s\n", i, SDL_GetError());
+            return 1;
+        }
+    }
+
+    SDL_Delay(RUN_MS / 2);
+    for (i = 0; i < NUM_TIMERS; i += 4) {
+        if (timers[i].mode == TIMER_PERIODIC) {
+            if (!SDL_RemoveTimer(timers[i].id)) {
+                printf("Couldn't remove timer %d\n", i);
+                error = 1;
+            }
+            timers[i].removed_at = timers[i].calls;
+        }
+    }
+    SDL_Delay(RUN_MS / 2);
+
+    for (i = 0; i < NUM_TIMERS; ++i) {
+        TimerInfo *info = &timers[i];
+        SDL_bool removed = SDL_RemoveTimer(info->id);
+
+        elapsed = SDL_GetTicks() - info->start;
+        if (info->mode != TIMER_PERIODIC || info->removed_at >= 0) {
+            /* These should all be gone already */
+            if (removed) {
+                printf("Timer %d was still running\n", i);
+                error = 1;
+            }
+        } else if (!removed) {
+            printf("Timer %d had stopped\n", i);
+            error = 1;
+        } else if (info->calls < (int) ((elapsed - SLACK_MS) / info->interval)) {
+            printf("Timer %d (%u ms) ran %d times in %u ms\n", i,
+                   info->interval, info->calls, elapsed);
+            error = 1;
+        }
+        if ((info->mode == TIMER_RETURNS_ZERO && info->calls != 3) ||
+            (info->mode == TIMER_REMOVES_ITSELF && info->calls != 2) ||
+            (info->removed_at >= 0 && info->calls > info->removed_at + 1)) {
+            printf("Timer %d ran %d times after it was stopped\n", i,
+                   info->calls);
+            error = 1;
+        }
+        if (info->early) {
+            printf("Timer %d ran early %d times\n", i, info->early);
+            error = 1;
+        }
+        calls += info->calls;
+        late_total += info->late_total;
+        if (info->late_max > late_max) {
+            late_max = info->late_max;
+        }
+    }
+    printf("%d timers: %u callbacks, %.3f ms late on average, %u ms worst\n",
+           NUM_TIMERS, calls, calls ? (double) late_total / calls : 0.0,
+           late_max);
+    return error;
+}
+
+static void
+TestChurn(void)
+{
+    SDL_TimerID *ids = (SDL_TimerID *) SDL_malloc(NUM_CHURN * sizeof(*ids));
+    Uint32 start, added, removed;
+    int i;
+
+    start = SDL_GetTicks();
+    for (i = 0; i < NUM_CHURN; ++i) {
+        ids[i] = SDL_AddTimer(10000 + rand() % 10000, Never, NULL);
+    }
+    added = SDL_GetTicks() - start;
+
+    /* Shuffle, then remove them all */
+    for (i = NUM_CHURN - 1; i > 0; --i) {
+        int j = rand() % (i + 1);
+        SDL_TimerID tmp = ids[i];
+        ids[i] = ids[j];
+        ids[j] = tmp;
+    }
+    start = SDL_GetTicks();
+    for (i = 0; i < NUM_CHURN; ++i) {
+        SDL_RemoveTimer(ids[i]);
+    }
+    removed = SDL_GetTicks() - start;
+
+    printf("%d timers: added in %u ms, removed in random order in %u ms\n",
+           NUM_CHURN, added, removed);
+    SDL_free(ids);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors = 0;
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    srand(1);
+
+    errors += TestTimers();
+    TestChurn();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
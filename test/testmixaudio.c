@@ -0,0 +1,245 @@
+
+/*
+ * Checks SDL_MixAudioFormat() against the plain C mixing loops and times it.
+ *
+ * Random buffers of odd lengths and alignments are mixed at several
+ * volumes, in every 16 bit, 32 bit and float format, and must match the
+ * reference byte for byte.  Then a second of 48kHz stereo is mixed over
+ * and over with both to compare the speed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define TEST_LEN    4099        /* samples, not a multiple of any vector */
+#define BENCH_LEN   (48000 * 2)
+#define BENCH_LOOPS 200
+
+static const struct
+{
+    const char *name;
+    SDL_AudioFormat format;
+} formats[] = {
+    { "S16LSB", AUDIO_S16LSB },
+    { "S16MSB", AUDIO_S16MSB },
+    { "S32LSB", AUDIO_S32LSB },
+    { "S32MSB", AUDIO_S32MSB },
+    { "F32LSB", AUDIO_F32LSB },
+    { "F32MSB", AUDIO_F32MSB },
+};
+
+static const int volumes[] = { 1, 37, 64, 100, 127, SDL_MIX_MAXVOLUME };
+
+/* Reads and writes a sample of the format as a native integer or float */
+static Sint64
+GetInt(SDL_AudioFormat format, const Uint8 * p)
+{
+    if (SDL_AUDIO_BITSIZE(format) == 16) {
+        Uint16 x = *(const Uint16 *) p;
+        return (Sint16) (SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapBE16(x) :
+                         SDL_SwapLE16(x));
+    } else {
+        Uint32 x = *(const Uint32 *) p;
+        return (Sint32) (SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapBE32(x) :
+                         SDL_SwapLE32(x));
+    }
+}
+
+static void
+PutInt(SDL_AudioFormat format, Uint8 * p, Sint64 value)
+{
+    if (SDL_AUDIO_BITSIZE(format) == 16) {
+        Uint16 x = (Uint16) value;
+        *(Uint16 *) p = SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapBE16(x) :
+            SDL_SwapLE16(x);
+    } else {
+        Uint32 x = (Uint32) value;
+        *(Uint32 *) p = SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapBE32(x) :
+            SDL_SwapLE32(x);
+    }
+}
+
+/* This is what SDL_mixer.c does without any assembly or vector code */
+static void
+MixReference(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+             Uint32 len, int volume)
+{
+    const int size = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint32 i;
+
+    for (i = 0; i < len; i += size) {
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+            const double max_audioval = 3.402823466e+38F;
+            const double min_audioval = -3.402823466e+38F;
+            float src1, src2;
+            double dst_sample;
+            Sint64 bits = GetInt(format, src + i);
+            Uint32 ubits = (Uint32) bits;
+
+            SDL_memcpy(&src1, &ubits, 4);
+            bits = GetInt(format, dst + i);
+            ubits = (Uint32) bits;
+            SDL_memcpy(&src2, &ubits, 4);
+            src1 = (src1 * (float) volume) * fmaxvolume;
+            dst_sample = ((double) src1) + ((double) src2);
+            if (dst_sample > max_audioval) {
+                dst_sample = max_audioval;
+            } else if (dst_sample < min_audioval) {
+                dst_sample = min_audioval;
+            }
+            src1 = (float) dst_sample;
+            SDL_memcpy(&ubits, &src1, 4);
+            PutInt(format, dst + i, ubits);
+        } else {
+            const Sint64 max_audioval = (((Sint64) 1) << (size * 8 - 1)) - 1;
+            const Sint64 min_audioval = -(((Sint64) 1) << (size * 8 - 1));
+            Sint64 dst_sample = (GetInt(format, src + i) * volume) /
+                SDL_MIX_MAXVOLUME;
+
+            dst_sample += GetInt(format, dst + i);
+            if (dst_sample > max_audioval) {
+                dst_sample = max_audioval;
+            } else if (dst_sample < min_audioval) {
+                dst_sample = min_audioval;
+            }
+            PutInt(format, dst + i, dst_sample);
+        }
+    }
+}
+
+/* Random samples with plenty of full scale ones, so the sums saturate */
+static void
+FillRandom(SDL_AudioFormat format, Uint8 * buf, int samples)
+{
+    const int size = SDL_AUDIO_BITSIZE(format) / 8;
+    int i;
+
+    for (i = 0; i < samples; ++i) {
+        Uint8 *p = buf + i * size;
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            float value;
+            Uint32 bits;
+            switch (rand() % 4) {
+            case 0:
+                value = (rand() % 2) ? 3.4e+38F : -3.4e+38F;
+                break;
+            case 1:
+                value = (float) (rand() % 3 - 1);
+                break;
+            default:
+                value = (float) rand() / RAND_MAX * 2.0f - 1.0f;
+                break;
+            }
+            SDL_memcpy(&bits, &value, 4);
+            PutInt(format, p, bits);
+        } else {
+            const Sint64 max = (((Sint64) 1) << (size * 8 - 1)) - 1;
+            switch (rand() % 4) {
+            case 0:
+                PutInt(format, p, max);
+                break;
+            case 1:
+                PutInt(format, p, -max - 1);
+                break;
+            default:
+                PutInt(format, p, ((Sint64) rand() << 16) ^ rand());
+                break;
+            }
+        }
+    }
+}
+
+static int
+TestFormat(int f)
+{
+    const SDL_AudioFormat format = formats[f].format;
+    const int size = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint8 *src = (Uint8 *) SDL_malloc(TEST_LEN * size + 32);
+    Uint8 *dst = (Uint8 *) SDL_malloc(TEST_LEN * size + 32);
+    Uint8 *ref = (Uint8 *) SDL_malloc(TEST_LEN * size + 32);
+    int v, offset;
+    int error = 0;
+
+    for (v = 0; v < SDL_arraysize(volumes); ++v) {
+        for (offset = 0; offset < 32; offset += size) {
+            const Uint32 len = (TEST_LEN - offset / size) * size;
+            FillRandom(format, src, TEST_LEN + 32 / size);
+            FillRandom(format, dst, TEST_LEN + 32 / size);
+            SDL_memcpy(ref, dst, TEST_LEN * size + 32);
+            SDL_MixAudioFormat(dst + offset, src + (32 - offset), format,
+                               len, volumes[v]);
+            MixReference(ref + offset, src + (32 - offset), format, len,
+                         volumes[v]);
+            if (SDL_memcmp(dst, ref, TEST_LEN * size + 32) != 0) {
+                printf("%s at volume %d, offset %d: mixing differs\n",
+                       formats[f].name, volumes[v], offset);
+                error = 1;
+            }
+        }
+    }
+
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(ref);
+    return error;
+}
+
+static void
+BenchFormat(int f)
+{
+    const SDL_AudioFormat format = formats[f].format;
+    const int size = SDL_AUDIO_BITSIZE(format) / 8;
+    Uint8 *src = (Uint8 *) SDL_malloc(BENCH_LEN * size);
+    Uint8 *dst = (Uint8 *) SDL_calloc(1, BENCH_LEN * size);
+    Uint32 start, newtime, oldtime;
+    int i;
+
+    FillRandom(format, src, BENCH_LEN);
+
+    start = SDL_GetTicks();
+    for (i = 0; i < BENCH_LOOPS; ++i) {
+        SDL_MixAudioFormat(dst, src, format, BENCH_LEN * size, 100);
+    }
+    newtime = SDL_GetTicks() - start;
+
+    start = SDL_GetTicks();
+    for (i = 0; i < BENCH_LOOPS; ++i) {
+        MixReference(dst, src, format, BENCH_LEN * size, 100);
+    }
+    oldtime = SDL_GetTicks() - start;
+
+    printf("%s: %6.3f ms per second of 48kHz stereo (C loops %6.3f ms)\n",
+           formats[f].name, (double) newtime / BENCH_LOOPS,
+           (double) oldtime / BENCH_LOOPS);
+
+    SDL_free(src);
+    SDL_free(dst);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int f;
+    int errors = 0;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    srand(1);
+
+    printf("SSE2 %s, AVX2 %s\n", SDL_HasSSE2()? "detected" : "not detected",
+           SDL_HasAVX2()? "detected" : "not detected");
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        errors += TestFormat(f);
+    }
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        BenchFormat(f);
+    }
+
+    SDL_Quit();
+    return (errors ? 1 : 0);
+}
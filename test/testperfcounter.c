@@ -0,0 +1,129 @@
+
+/*
+ * Checks the high resolution counter against SDL_GetTicks() and compares
+ * frame pacing with SDL_Delay() and SDL_DelayPrecise().
+ *
+ * The counter must never go backwards and must agree with the millisecond
+ * clock about how long half a second is.  Then a 60 Hz frame loop is run
+ * with each delay function, and how far each frame was from 16.67 ms is
+ * printed.  Set SDL_TIMER_RDTSC=1 to try the CPU cycle counter.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define CALLS       1000000
+#define FRAMES      120
+#define FRAME_NS    16666667
+
+static double
+ToMS(Uint64 counter, Uint64 frequency)
+{
+    return (double) counter * 1000.0 / (double) frequency;
+}
+
+static int
+TestCounter(void)
+{
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 start, then, now;
+    Uint32 ticks;
+    double measured;
+    int i, backwards = 0;
+    int error = 0;
+
+    printf("Counter frequency: %.0f per second\n", (double) frequency);
+
+    /* Compare with SDL_GetTicks() over half a second */
+    ticks = SDL_GetTicks();
+    while (SDL_GetTicks() == ticks) {
+        /* Start on a tick */ ;
+    }
+    ticks = SDL_GetTicks();
+    start = SDL_GetPerformanceCounter();
+    SDL_Delay(500);
+    while (SDL_GetTicks() - ticks < 500) {
+        /* Nothing */ ;
+    }
+    now = SDL_GetPerformanceCounter();
+    ticks = SDL_GetTicks() - ticks;
+    measured = ToMS(now - start, frequency);
+    printf("%u ms by SDL_GetTicks() took %.3f ms by the counter\n", ticks,
+           measured);
+    if (measured < ticks - 2 || measured > ticks + 2) {
+        error = 1;
+    }
+
+    /* Time reading the counter, and make sure it only goes forwards */
+    start = then = SDL_GetPerformanceCounter();
+    for (i = 0; i < CALLS; ++i) {
+        now = SDL_GetPerformanceCounter();
+        if (now < then) {
+            ++backwards;
+        }
+        then = now;
+    }
+    printf("Reading the counter takes %.1f ns\n",
+           ToMS(now - start, frequency) * 1000000.0 / CALLS);
+    if (backwards) {
+        printf("The counter went backwards %d times\n", backwards);
+        error = 1;
+    }
+    return error;
+}
+
+static double
+PaceFrames(const char *name, SDL_bool precise)
+{
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 then, now;
+    double ms, error, total = 0.0, worst = 0.0;
+    int i;
+
+    then = SDL_GetPerformanceCounter();
+    for (i = 0; i < FRAMES; ++i) {
+        if (precise) {
+            SDL_DelayPrecise(FRAME_NS);
+        } else {
+            SDL_Delay((i % 3) ? 17 : 16);
+        }
+        now = SDL_GetPerformanceCounter();
+        ms = ToMS(now - then, frequency);
+        then = now;
+
+        error = ms - FRAME_NS / 1000000.0;
+        if (error < 0.0) {
+            error = -error;
+        }
+        total += error;
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    printf("%s: frames off by %.3f ms on average, %.3f ms worst\n", name,
+           total / FRAMES, worst);
+    return total / FRAMES;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors = 0;
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    errors += TestCounter();
+    PaceFrames("SDL_Delay", SDL_FALSE);
+    if (PaceFrames("SDL_DelayPrecise", SDL_TRUE) > 0.5) {
+        errors = 1;
+    }
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
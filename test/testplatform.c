@@ -143,6 +143,7 @@ TestCPUInfo(SDL_bool verbose)
         printf("SSE %s\n", SDL_HasSSE()? "detected" : "not detected");
         printf("SSE2 %s\n", SDL_HasSSE2()? "detected" : "not detected");
         printf("AltiVec %s\n", SDL_HasAltiVec()? "detected" : "not detected");
+        printf("AVX2 %s\n", SDL_HasAVX2()? "detected" : "not detected");
     }
     return (0);
 }
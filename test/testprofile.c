@@ -0,0 +1,254 @@
+
+/*
+ * Runs some blits, audio conversions, an audio callback, rendering and
+ * events, and checks that the profiling counters saw them.
+ *
+ * SDL has to be configured with --enable-profiling for there to be any
+ * counters; otherwise this just says so.  The counters are printed at the
+ * end, and SDL_PROFILE_DUMP=<ms> prints them while the test runs, too.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define NUM_BLITS   100
+#define NUM_CONVERT 20
+#define NUM_EVENTS  50
+
+static int
+Matches(const SDL_ProfileCounter * counter, const char *prefix)
+{
+    return (SDL_strncmp(counter->name, prefix, SDL_strlen(prefix)) == 0);
+}
+
+static void
+Totals(const char *prefix, Uint32 * calls, Uint64 * units)
+{
+    SDL_ProfileCounter counters[256];
+    int i, count;
+
+    *calls = 0;
+    *units = 0;
+    count = SDL_GetProfileCounters(counters, SDL_arraysize(counters));
+    for (i = 0; i < count && i < SDL_arraysize(counters); ++i) {
+        if (Matches(&counters[i], prefix)) {
+            *calls += counters[i].calls;
+            *units += counters[i].units;
+        }
+    }
+}
+
+static int
+TestBlits(void)
+{
+    SDL_Surface *src, *dst;
+    Uint32 calls;
+    Uint64 units;
+    int i;
+
+    src = SDL_CreateRGBSurface(0, 64, 48, 32, 0x00FF0000, 0x0000FF00,
+                               0x000000FF, 0);
+    dst = SDL_CreateRGBSurface(0, 320, 240, 16, 0xF800, 0x07E0, 0x001F, 0);
+    if (!src || !dst) {
+        printf("Couldn't create surfaces: %s\n", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < NUM_BLITS; ++i) {
+        SDL_Rect rect;
+        rect.x = i;
+        rect.y = i;
+        SDL_BlitSurface(src, NULL, dst, &rect);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+
+    Totals("SDL_SoftBlit", &calls, &units);
+    if (calls != NUM_BLITS || units != (Uint64) NUM_BLITS * 64 * 48) {
+        printf("Blits: counted %u calls and %.0f pixels\n", calls,
+               (double) units);
+        return 1;
+    }
+    return 0;
+}
+
+static int
+TestAudio(void)
+{
+    SDL_AudioCVT cvt;
+    Uint32 calls;
+    Uint64 units;
+    int i, filters;
+
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, 2, 22050,
+                          AUDIO_F32SYS, 1, 44100) <= 0) {
+        printf("Couldn't build an audio conversion: %s\n", SDL_GetError());
+        return 1;
+    }
+    for (filters = 0; cvt.filters[filters]; ++filters) {
+        /* Count them */ ;
+    }
+    cvt.len = 4096;
+    cvt.buf = (Uint8 *) SDL_calloc(1, cvt.len * cvt.len_mult);
+    for (i = 0; i < NUM_CONVERT; ++i) {
+        SDL_ConvertAudio(&cvt);
+    }
+    SDL_free(cvt.buf);
+
+    Totals("SDL_ConvertAudio", &calls, &units);
+    if (calls == 0 || calls % (NUM_CONVERT * filters) != 0) {
+        printf("Audio: counted %u filter calls for %d filters\n", calls,
+               filters);
+        return 1;
+    }
+    return 0;
+}
+
+static void SDLCALL
+Silence(void *userdata, Uint8 * stream, int len)
+{
+    SDL_memset(stream, 0, len);
+}
+
+static int
+TestCallback(void)
+{
+    SDL_AudioSpec spec;
+    SDL_ProfileCounter counters[256];
+    int i, count;
+
+    SDL_zero(spec);
+    spec.freq = 44100;
+    spec.format = AUDIO_S16SYS;
+    spec.channels = 2;
+    spec.samples = 1024;
+    spec.callback = Silence;
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0 ||
+        SDL_OpenAudio(&spec, NULL) < 0) {
+        printf("Couldn't open audio, skipping it: %s\n", SDL_GetError());
+        return 0;
+    }
+    SDL_PauseAudio(0);
+    SDL_Delay(200);
+    SDL_CloseAudio();
+
+    /* The callback should have plenty of time to spare */
+    count = SDL_GetProfileCounters(counters, SDL_arraysize(counters));
+    for (i = 0; i < count && i < SDL_arraysize(counters); ++i) {
+        const SDL_ProfileCounter *counter = &counters[i];
+        if (Matches(counter, "SDL_RunAudio")) {
+            if (counter->calls == 0 || counter->budget_ns < counter->ns) {
+                printf("Audio callback: %u calls took %.0f of %.0f ns\n",
+                       counter->calls, (double) counter->ns,
+                       (double) counter->budget_ns);
+                return 1;
+            }
+            return 0;
+        }
+    }
+    printf("The audio callback wasn't counted\n");
+    return 1;
+}
+
+static int
+TestRender(void)
+{
+    SDL_WindowID window;
+    SDL_Rect rect;
+    Uint32 calls;
+    Uint64 units;
+    int i;
+
+    window = SDL_CreateWindow("testprofile", 0, 0, 320, 240, 0);
+    if (!window || SDL_CreateRenderer(window, -1, 0) < 0) {
+        printf("Couldn't create a renderer, skipping it: %s\n",
+               SDL_GetError());
+        return 0;
+    }
+    rect.x = 10;
+    rect.y = 10;
+    rect.w = 100;
+    rect.h = 50;
+    for (i = 0; i < 10; ++i) {
+        SDL_SetRenderDrawColor(0xFF, 0x80, 0x00, 0xFF);
+        SDL_RenderFill(&rect);
+        SDL_RenderPresent();
+    }
+    SDL_DestroyWindow(window);
+
+    Totals("SDL_RenderFill", &calls, &units);
+    if (calls != 10 || units != 10 * 100 * 50) {
+        printf("Rendering: counted %u fills and %.0f pixels\n", calls,
+               (double) units);
+        return 1;
+    }
+    return 0;
+}
+
+static int
+TestEvents(void)
+{
+    SDL_Event event;
+    Uint32 calls;
+    Uint64 units;
+    int i;
+
+    while (SDL_PollEvent(&event)) {
+        /* Start with an empty queue */ ;
+    }
+    SDL_ResetProfileCounters();
+
+    SDL_memset(&event, 0, sizeof(event));
+    event.type = SDL_USEREVENT;
+    for (i = 0; i < NUM_EVENTS; ++i) {
+        SDL_PushEvent(&event);
+    }
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_ALLEVENTS) == 1) {
+        /* Drain it one at a time */ ;
+    }
+
+    /* The depths seen were 50, 49, ... 1 and then 0 */
+    Totals("SDL_PeepEvents", &calls, &units);
+    if (calls != NUM_EVENTS + 1 ||
+        units != (Uint64) NUM_EVENTS * (NUM_EVENTS + 1) / 2) {
+        printf("Events: counted %u looks at a total depth of %.0f\n", calls,
+               (double) units);
+        return 1;
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors = 0;
+
+    /* Any drivers will do, so don't open a display or a sound card */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+    if (!SDL_getenv("SDL_AUDIODRIVER")) {
+        SDL_putenv("SDL_AUDIODRIVER=dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    if (SDL_GetProfileCounters(NULL, 0) < 0) {
+        printf("SDL was built without --enable-profiling\n");
+        SDL_Quit();
+        return 0;
+    }
+
+    errors += TestBlits();
+    errors += TestAudio();
+    errors += TestCallback();
+    errors += TestRender();
+    SDL_DumpProfileCounters();
+    errors += TestEvents();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
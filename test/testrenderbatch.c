@@ -0,0 +1,253 @@
+
+/*
+ * Checks that drawing points, lines, rectangles and texture copies in
+ * batches gives the same picture as drawing them one at a time, with and
+ * without blending, for batches that need clipping and for batches big
+ * enough to need more scratch space than the last.
+ *
+ * This uses the dummy video driver, which can save the frames it shows.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define WINDOW_W    320
+#define WINDOW_H    240
+#define MAX_COUNT   2000
+
+static SDL_Point points[2 * MAX_COUNT];
+static SDL_Rect rects[MAX_COUNT];
+static SDL_Rect srcrects[MAX_COUNT];
+static SDL_Rect dstrects[MAX_COUNT];
+static int frames_saved;
+
+static int
+CreateRenderer(SDL_WindowID window, const char *name)
+{
+    int i;
+
+    for (i = 0; i < SDL_GetNumRenderDrivers(); ++i) {
+        SDL_RendererInfo info;
+
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 &&
+            SDL_strcmp(info.name, name) == 0) {
+            return SDL_CreateRenderer(window, i, 0);
+        }
+    }
+    SDL_SetError("No %s renderer", name);
+    return -1;
+}
+
+static SDL_TextureID
+CreateTexture(void)
+{
+    SDL_Surface *surface;
+    SDL_TextureID texture;
+    int x, y;
+
+    surface = SDL_CreateRGBSurface(0, 32, 32, 32, 0x00FF0000, 0x0000FF00,
+                                   0x000000FF, 0);
+    if (!surface) {
+        return 0;
+    }
+    for (y = 0; y < 32; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) surface->pixels +
+                                  y * surface->pitch);
+
+        for (x = 0; x < 32; ++x) {
+            row[x] = SDL_MapRGB(surface->format, x * 8, y * 8, (x ^ y) * 8);
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(0, surface);
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+/* Make primitives all over the window, some hanging off the edges */
+static void
+MakePrimitives(int count)
+{
+    int i;
+
+    for (i = 0; i < 2 * count; ++i) {
+        points[i].x = (rand() % (WINDOW_W + 40)) - 20;
+        points[i].y = (rand() % (WINDOW_H + 40)) - 20;
+    }
+    for (i = 0; i < count; ++i) {
+        rects[i].x = (rand() % (WINDOW_W + 40)) - 20;
+        rects[i].y = (rand() % (WINDOW_H + 40)) - 20;
+        rects[i].w = 1 + rand() % 40;
+        rects[i].h = 1 + rand() % 40;
+        srcrects[i].x = rand() % 16;
+        srcrects[i].y = rand() % 16;
+        srcrects[i].w = 1 + rand() % 16;
+        srcrects[i].h = 1 + rand() % 16;
+
+        /* The dummy renderer can't scale copies */
+        dstrects[i].x = rects[i].x;
+        dstrects[i].y = rects[i].y;
+        dstrects[i].w = srcrects[i].w;
+        dstrects[i].h = srcrects[i].h;
+    }
+}
+
+/* Draw the primitives, either in batches or one at a time */
+static void
+Draw(SDL_TextureID texture, int count, int blend, int batch)
+{
+    int i;
+
+    SDL_SetRenderDrawBlendMode(blend ? SDL_BLENDMODE_BLEND :
+                               SDL_BLENDMODE_NONE);
+    SDL_SetTextureBlendMode(texture, blend ? SDL_BLENDMODE_BLEND :
+                            SDL_BLENDMODE_NONE);
+    SDL_SetTextureAlphaMod(texture, blend ? 0x80 : 0xFF);
+
+    SDL_SetRenderDrawColor(0xFF, 0x80, 0x00, blend ? 0x60 : 0xFF);
+    if (batch) {
+        SDL_RenderFills(rects, count);
+    } else {
+        for (i = 0; i < count; ++i) {
+            SDL_RenderFill(&rects[i]);
+        }
+    }
+    if (batch) {
+        SDL_RenderCopies(texture, srcrects, dstrects, count / 4);
+    } else {
+        for (i = 0; i < count / 4; ++i) {
+            SDL_RenderCopy(texture, &srcrects[i], &dstrects[i]);
+        }
+    }
+    SDL_SetRenderDrawColor(0x00, 0xFF, 0x40, blend ? 0xA0 : 0xFF);
+    if (batch) {
+        SDL_RenderLines(points, count);
+    } else {
+        for (i = 0; i < count; ++i) {
+            SDL_RenderLine(points[2 * i].x, points[2 * i].y,
+                           points[2 * i + 1].x, points[2 * i + 1].y);
+        }
+    }
+    SDL_SetRenderDrawColor(0xFF, 0xFF, 0xFF, blend ? 0x80 : 0xFF);
+    if (batch) {
+        SDL_RenderPoints(points, 2 * count);
+    } else {
+        for (i = 0; i < 2 * count; ++i) {
+            SDL_RenderPoint(points[i].x, points[i].y);
+        }
+    }
+}
+
+/* Draw a frame and have the dummy driver save it */
+static SDL_Surface *
+DrawFrame(SDL_WindowID window, SDL_TextureID texture, int count, int batch)
+{
+    SDL_Surface *saved;
+    char file[128];
+
+    SDL_SetRenderDrawBlendMode(SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(0x20, 0x20, 0x40, 0xFF);
+    SDL_RenderFill(NULL);
+    Draw(texture, count, 0, batch);
+    Draw(texture, count, 1, batch);
+
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=1");
+    SDL_RenderPresent();
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=");
+
+    SDL_snprintf(file, sizeof(file), "SDL_window%d-%8.8d.bmp", window,
+                 ++frames_saved);
+    saved = SDL_LoadBMP(file);
+    remove(file);
+    if (!saved) {
+        printf("Couldn't load %s: %s\n", file, SDL_GetError());
+    }
+    return saved;
+}
+
+static int
+Compare(const char *what, SDL_Surface * want, SDL_Surface * got)
+{
+    int y;
+
+    for (y = 0; y < want->h; ++y) {
+        if (SDL_memcmp((Uint8 *) want->pixels + y * want->pitch,
+                       (Uint8 *) got->pixels + y * got->pitch,
+                       want->w * want->format->BytesPerPixel) != 0) {
+            printf("%s: row %d is different when drawn in batches\n", what,
+                   y);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int
+TestRenderer(const char *name)
+{
+    static const int counts[] = { 1, 10, 100, MAX_COUNT };
+    SDL_WindowID window;
+    SDL_TextureID texture;
+    SDL_Surface *single, *batched;
+    char what[64];
+    int i, errors = 0;
+
+    window = SDL_CreateWindow("testrenderbatch", 0, 0, WINDOW_W, WINDOW_H,
+                              0);
+    if (!window || CreateRenderer(window, name) < 0) {
+        printf("Couldn't create a %s renderer: %s\n", name, SDL_GetError());
+        return 1;
+    }
+    texture = CreateTexture();
+    if (!texture) {
+        printf("Couldn't create a texture: %s\n", SDL_GetError());
+        SDL_DestroyWindow(window);
+        return 1;
+    }
+
+    /* Growing batches need more scratch space each time */
+    srand(1);
+    for (i = 0; i < SDL_arraysize(counts); ++i) {
+        MakePrimitives(counts[i]);
+        single = DrawFrame(window, texture, counts[i], 0);
+        batched = DrawFrame(window, texture, counts[i], 1);
+        if (!single || !batched) {
+            ++errors;
+        } else {
+            SDL_snprintf(what, sizeof(what), "%s, %d primitives", name,
+                         counts[i]);
+            errors += Compare(what, single, batched);
+        }
+        if (single) {
+            SDL_FreeSurface(single);
+        }
+        if (batched) {
+            SDL_FreeSurface(batched);
+        }
+    }
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyWindow(window);
+    return errors;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors;
+
+    /* The frames can only be checked with the dummy driver */
+    SDL_putenv("SDL_VIDEODRIVER=dummy");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    errors = TestRenderer("dummy");
+    errors += TestRenderer("software");
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
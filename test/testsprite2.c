@@ -14,6 +14,7 @@ static int num_sprites;
 static SDL_TextureID *sprites;
 static SDL_bool cycle_color;
 static SDL_bool cycle_alpha;
+static SDL_bool batch_copies;
 static int cycle_direction = 1;
 static int current_alpha = 0;
 static int current_color = 0;
@@ -136,7 +137,12 @@ MoveSprites(SDL_WindowID window, SDL_TextureID sprite)
         }
 
         /* Blit the sprite onto the screen */
-        SDL_RenderCopy(sprite, NULL, position);
+        if (!batch_copies) {
+            SDL_RenderCopy(sprite, NULL, position);
+        }
+    }
+    if (batch_copies) {
+        SDL_RenderCopies(sprite, NULL, positions, num_sprites);
     }
 
     /* Update the screen! */
@@ -205,6 +211,9 @@ main(int argc, char *argv[])
             } else if (SDL_strcasecmp(argv[i], "--cyclealpha") == 0) {
                 cycle_alpha = SDL_TRUE;
                 consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--batch") == 0) {
+                batch_copies = SDL_TRUE;
+                consumed = 1;
             } else if (SDL_isdigit(*argv[i])) {
                 num_sprites = SDL_atoi(argv[i]);
                 consumed = 1;
@@ -212,7 +221,7 @@ main(int argc, char *argv[])
         }
         if (consumed < 0) {
             fprintf(stderr,
-                    "Usage: %s %s [--blend none|mask|blend|add|mod] [--scale none|fast|slow|best] [--cyclecolor] [--cyclealpha]\n",
+                    "Usage: %s %s [--blend none|mask|blend|add|mod] [--scale none|fast|slow|best] [--cyclecolor] [--cyclealpha] [--batch]\n",
                     argv[0], CommonUsage(state));
             quit(1);
         }
@@ -0,0 +1,263 @@
+
+/*
+ * Checks the thread pool: that every task and every item of a parallel
+ * for runs exactly once, that tasks can submit and wait for more tasks,
+ * and that several threads can use one pool at once.  Then it times a
+ * parallel for against a plain loop.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define NUM_TASKS   1000
+#define NUM_ITEMS   100000
+#define NUM_CALLERS 4
+
+static int counts[NUM_ITEMS];
+static double results[NUM_ITEMS];
+static SDL_ThreadPool *pool;
+
+static void SDLCALL
+CountTask(void *data)
+{
+    ++*(int *) data;
+}
+
+static void SDLCALL
+CountRange(void *data, int start, int end)
+{
+    int *items = (int *) data;
+    int i;
+
+    for (i = start; i < end; ++i) {
+        ++items[i];
+    }
+}
+
+static int
+CheckCounts(const char *what, int *items, int num_items)
+{
+    int i, errors = 0;
+
+    for (i = 0; i < num_items; ++i) {
+        if (items[i] != 1) {
+            if (errors < 10) {
+                printf("%s: item %d ran %d times\n", what, i, items[i]);
+            }
+            ++errors;
+        }
+        items[i] = 0;
+    }
+    return errors;
+}
+
+static int
+TestTasks(void)
+{
+    SDL_TaskGroup *group;
+    int i;
+
+    group = SDL_CreateTaskGroup(pool);
+    if (!group) {
+        printf("Couldn't create a task group: %s\n", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < NUM_TASKS; ++i) {
+        SDL_SubmitTask(group, CountTask, &counts[i]);
+    }
+    SDL_WaitTaskGroup(group);
+    SDL_DestroyTaskGroup(group);
+    return CheckCounts("Tasks", counts, NUM_TASKS);
+}
+
+/* Each task splits its range in two and waits for both halves */
+typedef struct
+{
+    int start;
+    int end;
+} Range;
+
+static void SDLCALL
+SplitTask(void *data)
+{
+    Range *range = (Range *) data;
+    Range halves[2];
+    SDL_TaskGroup *group;
+
+    if (range->end - range->start <= 16) {
+        CountRange(counts, range->start, range->end);
+        return;
+    }
+    halves[0].start = range->start;
+    halves[0].end = halves[1].start = (range->start + range->end) / 2;
+    halves[1].end = range->end;
+
+    group = SDL_CreateTaskGroup(pool);
+    SDL_SubmitTask(group, SplitTask, &halves[0]);
+    SDL_SubmitTask(group, SplitTask, &halves[1]);
+    SDL_DestroyTaskGroup(group);
+}
+
+static int
+TestNested(void)
+{
+    Range range;
+
+    range.start = 0;
+    range.end = NUM_ITEMS;
+    SplitTask(&range);
+    return CheckCounts("Nested tasks", counts, NUM_ITEMS);
+}
+
+static int
+TestParallelFor(void)
+{
+    static const int grains[] = { 1, 7, 1000, NUM_ITEMS * 2 };
+    char what[64];
+    int i, errors = 0;
+
+    for (i = 0; i < SDL_arraysize(grains); ++i) {
+        SDL_ParallelFor(pool, 0, NUM_ITEMS, grains[i], CountRange, counts);
+        SDL_snprintf(what, sizeof(what), "Parallel for, grain %d", grains[i]);
+        errors += CheckCounts(what, counts, NUM_ITEMS);
+    }
+    return errors;
+}
+
+/* Several threads running parallel fors on the pool at the same time */
+static int SDLCALL
+Caller(void *data)
+{
+    int *items = (int *) data;
+    int i;
+
+    for (i = 0; i < 100; ++i) {
+        SDL_ParallelFor(pool, 0, NUM_ITEMS / NUM_CALLERS, 64, CountRange,
+                        items);
+        CountRange(items, 0, NUM_ITEMS / NUM_CALLERS);
+    }
+    return 0;
+}
+
+static void SDLCALL
+CheckCaller(void *data, int start, int end)
+{
+    int *items = (int *) data;
+    int i;
+
+    for (i = start; i < end; ++i) {
+        items[i] = (items[i] == 200) ? 1 : -1;
+    }
+}
+
+static int
+TestCallers(void)
+{
+    SDL_Thread *threads[NUM_CALLERS];
+    int i;
+
+    for (i = 0; i < NUM_CALLERS; ++i) {
+        threads[i] = SDL_CreateThread(Caller,
+                                      &counts[i * NUM_ITEMS / NUM_CALLERS]);
+    }
+    for (i = 0; i < NUM_CALLERS; ++i) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], NULL);
+        } else {
+            Caller(&counts[i * NUM_ITEMS / NUM_CALLERS]);
+        }
+    }
+    CheckCaller(counts, 0, NUM_ITEMS);
+    return CheckCounts("Several callers", counts, NUM_ITEMS);
+}
+
+static void SDLCALL
+Work(void *data, int start, int end)
+{
+    int i, j;
+
+    for (i = start; i < end; ++i) {
+        double x = i;
+
+        for (j = 0; j < 100; ++j) {
+            x = x * 0.999 + j;
+        }
+        results[i] = x;
+    }
+}
+
+static void
+TimeParallelFor(void)
+{
+    Uint64 start, serial, parallel;
+    double sum = 0.0;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    Work(NULL, 0, NUM_ITEMS);
+    serial = SDL_GetPerformanceCounter() - start;
+
+    start = SDL_GetPerformanceCounter();
+    SDL_ParallelFor(pool, 0, NUM_ITEMS, 256, Work, NULL);
+    parallel = SDL_GetPerformanceCounter() - start;
+
+    /* Use the results, so the work isn't optimized away */
+    for (i = 0; i < NUM_ITEMS; ++i) {
+        sum += results[i];
+    }
+    printf("%d items (%g): %8.1f us in a loop, %8.1f us in parallel\n",
+           NUM_ITEMS, sum,
+           (double) serial * 1000000.0 / SDL_GetPerformanceFrequency(),
+           (double) parallel * 1000000.0 / SDL_GetPerformanceFrequency());
+}
+
+static int
+TestPool(const char *name)
+{
+    int errors;
+
+    printf("%s: %d worker threads\n", name, SDL_GetThreadPoolSize(pool));
+    errors = TestTasks();
+    errors += TestNested();
+    errors += TestParallelFor();
+    errors += TestCallers();
+    TimeParallelFor();
+    return errors;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    printf("%d CPUs\n", SDL_GetCPUCount());
+
+    /* NULL selects the shared pool */
+    pool = NULL;
+    errors = TestPool("Shared pool");
+
+    pool = SDL_CreateThreadPool(3);
+    if (!pool) {
+        printf("Couldn't create a thread pool: %s\n", SDL_GetError());
+        return 1;
+    }
+    errors += TestPool("Private pool");
+    SDL_DestroyThreadPool(pool);
+
+    /* With a pool of one thread, everything runs on the calling thread */
+    SDL_Quit();
+    SDL_putenv("SDL_THREAD_POOL_SIZE=1");
+    SDL_Init(0);
+    pool = NULL;
+    errors += TestPool("Shared pool of one thread");
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
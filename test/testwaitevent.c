@@ -0,0 +1,127 @@
+
+/*
+ * Measures how SDL_WaitEventTimeout() behaves while idle and how quickly
+ * it returns when another thread pushes an event.
+ *
+ * While nothing happens the waiting thread should stay asleep, so the
+ * number of times it is woken up each second (voluntary context switches,
+ * where the system reports them) should be close to zero.  A second thread
+ * then pushes events at random intervals, and the time from each push to
+ * SDL_WaitEvent() returning it is printed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/time.h>
+#include <sys/resource.h>
+#define HAVE_GETRUSAGE
+#endif
+
+#define IDLE_MS     2000
+#define NUM_PUSHES  50
+
+static long
+ContextSwitches(void)
+{
+#ifdef HAVE_GETRUSAGE
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return usage.ru_nvcsw;
+    }
+#endif
+    return -1;
+}
+
+static int SDLCALL
+Pusher(void *unused)
+{
+    SDL_Event event;
+    int i;
+
+    SDL_memset(&event, 0, sizeof(event));
+    event.type = SDL_USEREVENT;
+    for (i = 0; i < NUM_PUSHES; ++i) {
+        SDL_Delay(5 + rand() % 20);
+        event.user.code = i;
+        event.user.data1 = (void *) (size_t) SDL_GetTicks();
+        SDL_PushEvent(&event);
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Thread *thread;
+    SDL_Event event;
+    Uint32 start, elapsed, latency, total = 0, worst = 0;
+    long switches;
+    int i, result;
+    int errors = 0;
+
+    /* Any video driver will do, so don't insist on a display */
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_putenv("SDL_VIDEODRIVER=dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    printf("Using the %s video driver\n", SDL_GetCurrentVideoDriver());
+
+    /* Drain anything the driver queued at startup */
+    while (SDL_PollEvent(&event)) {
+        /* Nothing */ ;
+    }
+
+    /* Sit idle and count wakeups */
+    switches = ContextSwitches();
+    start = SDL_GetTicks();
+    result = SDL_WaitEventTimeout(&event, IDLE_MS);
+    elapsed = SDL_GetTicks() - start;
+    if (result != 0 || elapsed < IDLE_MS) {
+        printf("Idle wait returned %d after %u ms\n", result, elapsed);
+        errors = 1;
+    }
+    if (switches >= 0) {
+        switches = ContextSwitches() - switches;
+        printf("Idle for %u ms: %.1f wakeups per second\n", elapsed,
+               switches * 1000.0 / elapsed);
+    } else {
+        printf("Idle for %u ms (wakeups can't be counted here)\n", elapsed);
+    }
+
+    /* Time how long pushed events take to come out */
+    thread = SDL_CreateThread(Pusher, NULL);
+    for (i = 0; i < NUM_PUSHES; ++i) {
+        if (!SDL_WaitEvent(&event)) {
+            printf("SDL_WaitEvent() failed: %s\n", SDL_GetError());
+            errors = 1;
+            break;
+        }
+        if (event.type != SDL_USEREVENT) {
+            --i;
+            continue;
+        }
+        if (event.user.code != i) {
+            printf("Got event %d, expected %d\n", event.user.code, i);
+            errors = 1;
+        }
+        latency = SDL_GetTicks() - (Uint32) (size_t) event.user.data1;
+        total += latency;
+        if (latency > worst) {
+            worst = latency;
+        }
+    }
+    SDL_WaitThread(thread, NULL);
+    printf("Push to return latency: %.2f ms average, %u ms worst\n",
+           (double) total / NUM_PUSHES, worst);
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
@@ -0,0 +1,293 @@
+
+/*
+ * Checks reading WAVE sounds a few frames at a time: that the frames
+ * match loading the whole sound, however they're read and wherever the
+ * stream seeks to, for MS ADPCM (sample.wav), IMA ADPCM and PCM data.
+ * Then it times opening and reading the first frames of a stream,
+ * against loading the whole sound.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define NUM_SEEKS   1000
+
+static Uint8 wav_data[256 * 1024];
+static size_t wav_size;
+
+static void
+PutLE16(Uint16 value)
+{
+    wav_data[wav_size++] = (Uint8) (value & 0xFF);
+    wav_data[wav_size++] = (Uint8) (value >> 8);
+}
+
+static void
+PutLE32(Uint32 value)
+{
+    PutLE16((Uint16) (value & 0xFFFF));
+    PutLE16((Uint16) (value >> 16));
+}
+
+static void
+PutTag(const char *tag)
+{
+    SDL_memcpy(&wav_data[wav_size], tag, 4);
+    wav_size += 4;
+}
+
+/* Make a WAVE file in memory, with random data and a chunk to skip */
+static void
+MakeWAV(Uint16 encoding, Uint16 channels, Uint16 bits, Uint16 blockalign,
+        Uint16 samplesperblock, Uint32 datalen)
+{
+    Uint32 i;
+    int c;
+
+    wav_size = 0;
+    PutTag("RIFF");
+    PutLE32(0);
+    PutTag("WAVE");
+    PutTag("fmt ");
+    PutLE32(samplesperblock ? 20 : 16);
+    PutLE16(encoding);
+    PutLE16(channels);
+    PutLE32(22050);
+    PutLE32(22050 * blockalign);
+    PutLE16(blockalign);
+    PutLE16(bits);
+    if (samplesperblock) {
+        PutLE16(2);
+        PutLE16(samplesperblock);
+    }
+    PutTag("LIST");
+    PutLE32(4);
+    PutTag("INFO");
+    PutTag("data");
+    PutLE32(datalen);
+    for (i = 0; i < datalen; ++i) {
+        wav_data[wav_size + i] = (Uint8) rand();
+    }
+    if (samplesperblock) {
+        /* IMA ADPCM blocks start with a sample, a step index and a 0 */
+        for (i = 0; i < datalen; i += blockalign) {
+            for (c = 0; c < channels; ++c) {
+                wav_data[wav_size + i + c * 4 + 2] = (Uint8) (rand() % 89);
+                wav_data[wav_size + i + c * 4 + 3] = 0;
+            }
+        }
+    }
+    wav_size += datalen;
+    wav_data[4] = (Uint8) ((wav_size - 8) & 0xFF);
+    wav_data[5] = (Uint8) ((wav_size - 8) >> 8);
+    wav_data[6] = (Uint8) ((wav_size - 8) >> 16);
+}
+
+/* Read the whole stream in pieces of 'frames' frames */
+static int
+CheckReads(const char *what, SDL_WAVStream * stream, Uint32 frames,
+           const Uint8 * buf, Uint32 len, int frame_size)
+{
+    Uint8 *piece;
+    Uint32 pos = 0;
+    int got;
+
+    piece = (Uint8 *) SDL_malloc(frames * frame_size);
+    SDL_SeekWAVStream(stream, 0);
+    while ((got = SDL_ReadWAVStream(stream, piece, frames)) > 0) {
+        if ((pos + got) * frame_size > len ||
+            SDL_memcmp(piece, buf + pos * frame_size, got * frame_size)) {
+            printf("%s: reading %u frames at a time, frame %u is different\n",
+                   what, frames, pos);
+            SDL_free(piece);
+            return 1;
+        }
+        pos += got;
+    }
+    SDL_free(piece);
+    if (got < 0 || pos * frame_size != len ||
+        SDL_TellWAVStream(stream) != pos) {
+        printf("%s: reading %u frames at a time read %u of %u frames\n",
+               what, frames, pos, len / frame_size);
+        return 1;
+    }
+    return 0;
+}
+
+static int
+CheckSeeks(const char *what, SDL_WAVStream * stream,
+           const Uint8 * buf, Uint32 len, int frame_size)
+{
+    Uint8 piece[1024 * 4 * 8];
+    Uint32 length, frame, frames, expected;
+    int i, got;
+
+    length = len / frame_size;
+    for (i = 0; i < NUM_SEEKS; ++i) {
+        frame = rand() % (length + 10);
+        frames = rand() % 1024 + 1;
+        if (SDL_SeekWAVStream(stream, frame) < 0) {
+            printf("%s: couldn't seek: %s\n", what, SDL_GetError());
+            return 1;
+        }
+        if (frame > length) {
+            frame = length;
+        }
+        expected = SDL_min(frames, length - frame);
+        got = SDL_ReadWAVStream(stream, piece, frames);
+        if (got != (int) expected ||
+            SDL_memcmp(piece, buf + frame * frame_size, got * frame_size)) {
+            printf("%s: %u frames at frame %u are different\n", what,
+                   frames, frame);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Check a stream of the sound against loading all of it */
+static int
+CheckStream(const char *what, SDL_RWops * src)
+{
+    static const Uint32 sizes[] = { 1, 7, 100, 4096, 0x7FFFFFFF };
+    SDL_WAVStream *stream;
+    SDL_AudioSpec spec, wav_spec;
+    Uint8 *buf;
+    Uint32 len;
+    int i, frame_size, errors = 0;
+
+    if (!SDL_LoadWAV_RW(src, 0, &wav_spec, &buf, &len)) {
+        printf("%s: couldn't load: %s\n", what, SDL_GetError());
+        SDL_RWclose(src);
+        return 1;
+    }
+    SDL_RWseek(src, 0, RW_SEEK_SET);
+    stream = SDL_OpenWAVStream_RW(src, 1, &spec);
+    if (!stream) {
+        printf("%s: couldn't open a stream: %s\n", what, SDL_GetError());
+        SDL_FreeWAV(buf);
+        return 1;
+    }
+    frame_size = (SDL_AUDIO_BITSIZE(spec.format) / 8) * spec.channels;
+    if (spec.freq != wav_spec.freq || spec.format != wav_spec.format ||
+        spec.channels != wav_spec.channels ||
+        SDL_GetWAVStreamLength(stream) * frame_size != len) {
+        printf("%s: the stream is %u frames of %d Hz, 0x%x, %d channels\n",
+               what, SDL_GetWAVStreamLength(stream), spec.freq, spec.format,
+               spec.channels);
+        ++errors;
+    } else {
+        for (i = 0; i < SDL_arraysize(sizes); ++i) {
+            errors += CheckReads(what, stream, SDL_min(sizes[i], len),
+                                 buf, len, frame_size);
+        }
+        errors += CheckSeeks(what, stream, buf, len, frame_size);
+    }
+    SDL_CloseWAVStream(stream);
+    SDL_FreeWAV(buf);
+    return errors;
+}
+
+static int
+TestFormats(void)
+{
+    int errors = 0;
+
+    errors += CheckStream("sample.wav", SDL_RWFromFile("sample.wav", "rb"));
+    errors += CheckStream("sample.wav in memory",
+                          SDL_RWFromMappedFile("sample.wav"));
+
+    /* A partial block or frame at the end isn't read */
+    MakeWAV(0x0011, 1, 4, 256, 505, 256 * 40 + 100);
+    errors += CheckStream("IMA ADPCM mono",
+                          SDL_RWFromConstMem(wav_data, wav_size));
+    MakeWAV(0x0011, 2, 4, 512, 505, 512 * 40);
+    errors += CheckStream("IMA ADPCM stereo",
+                          SDL_RWFromConstMem(wav_data, wav_size));
+    MakeWAV(0x0001, 2, 16, 4, 0, 4 * 20000 + 3);
+    errors += CheckStream("PCM", SDL_RWFromConstMem(wav_data, wav_size));
+    return errors;
+}
+
+static int
+TestFailure(void)
+{
+    static const char garbage[] = "This isn't a WAVE file";
+    SDL_AudioSpec spec;
+    int errors = 0;
+
+    if (SDL_OpenWAVStream("no such file.wav", &spec)) {
+        printf("Opened a file that doesn't exist\n");
+        ++errors;
+    }
+    if (SDL_OpenWAVStream_RW(SDL_RWFromConstMem(garbage, sizeof(garbage)),
+                             1, &spec)) {
+        printf("Opened garbage\n");
+        ++errors;
+    } else {
+        printf("Opening garbage failed: %s\n", SDL_GetError());
+    }
+
+    /* No data chunk */
+    MakeWAV(0x0001, 1, 8, 1, 0, 0);
+    if (SDL_OpenWAVStream_RW(SDL_RWFromConstMem(wav_data, wav_size - 8),
+                             1, &spec)) {
+        printf("Opened a WAVE file without data\n");
+        ++errors;
+    }
+    if (SDL_ReadWAVStream(NULL, NULL, 1) != -1) {
+        printf("Read from a NULL stream\n");
+        ++errors;
+    }
+    return errors;
+}
+
+static void
+TimeStream(void)
+{
+    SDL_WAVStream *stream;
+    SDL_AudioSpec spec;
+    Uint8 *buf;
+    Uint32 len;
+    Uint8 piece[4096 * 4];
+    Uint64 start, loaded, streamed;
+
+    start = SDL_GetPerformanceCounter();
+    if (SDL_LoadWAV("sample.wav", &spec, &buf, &len)) {
+        SDL_FreeWAV(buf);
+    }
+    loaded = SDL_GetPerformanceCounter() - start;
+
+    start = SDL_GetPerformanceCounter();
+    stream = SDL_OpenWAVStream("sample.wav", &spec);
+    SDL_ReadWAVStream(stream, piece, 4096 / spec.channels);
+    SDL_CloseWAVStream(stream);
+    streamed = SDL_GetPerformanceCounter() - start;
+
+    printf("sample.wav: %8.1f us to load it, %8.1f us to stream the first "
+           "4096 samples\n",
+           (double) loaded * 1000000.0 / SDL_GetPerformanceFrequency(),
+           (double) streamed * 1000000.0 / SDL_GetPerformanceFrequency());
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors;
+
+    if (SDL_Init(0) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    srand(0);
+
+    errors = TestFormats();
+    errors += TestFailure();
+    TimeStream();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
@@ -0,0 +1,371 @@
+
+/*
+ * Checks the X11 renderer against the software renderer: the same scene
+ * is drawn in a window with each, the windows are read back from the X
+ * server, and the pictures must match.
+ *
+ * The scene has a 32-bit texture with alpha drawn blended, unblended,
+ * scaled, part of it scaled, and again after its blend mode changes (XRender needs it premultiplied, so
+ * it's uploaded again), a streaming texture updated every frame (shared
+ * memory pixmaps, if the server has them), and then the windows are
+ * resized, which makes the X11 renderer replace its pixmaps and pictures,
+ * and everything is drawn and checked again.
+ *
+ * Run it with test/testx11render.sh, which starts Xvfb if there's no
+ * display.  Set SDL_VIDEO_X11_XRENDER=0 to check the core X11 path.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+#include "SDL_syswm.h"
+
+#ifdef SDL_VIDEO_DRIVER_X11
+
+#include <X11/Xutil.h>
+
+#define WINDOW_W    256
+#define WINDOW_H    192
+#define TEXTURE_W   64
+#define TEXTURE_H   64
+
+/* Colour differences past this are counted, a few are let through for
+   nearest pixel sampling picking the neighbouring texel */
+#define TOLERANCE   16
+#define MAX_WRONG   (WINDOW_W * WINDOW_H / 100)
+
+typedef struct
+{
+    const char *name;
+    SDL_WindowID window;
+    SDL_TextureID texture;
+    SDL_TextureID streaming;
+} Target;
+
+static Uint32 blend_modes;
+static Uint32 scale_modes;
+
+static int
+CreateRenderer(SDL_WindowID window, const char *name)
+{
+    int i;
+
+    for (i = 0; i < SDL_GetNumRenderDrivers(); ++i) {
+        SDL_RendererInfo info;
+
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 &&
+            SDL_strcmp(info.name, name) == 0) {
+            return SDL_CreateRenderer(window, i, 0);
+        }
+    }
+    SDL_SetError("No %s renderer", name);
+    return -1;
+}
+
+/* Smooth gradients, so a texel off when scaling is a small difference */
+static void
+MakePixels(Uint32 * pixels, int frame)
+{
+    int x, y;
+
+    for (y = 0; y < TEXTURE_H; ++y) {
+        for (x = 0; x < TEXTURE_W; ++x) {
+            const Uint32 a = (x + y) * 2;
+            const Uint32 r = x * 4;
+            const Uint32 g = y * 4;
+            const Uint32 b = (frame * 16 + x + y) & 0xFF;
+
+            pixels[y * TEXTURE_W + x] = (a << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+}
+
+/* The windows mustn't overlap, or what's read back is undefined */
+static int
+CreateTarget(Target * target, const char *name, int x)
+{
+    SDL_RendererInfo info;
+    Uint32 pixels[TEXTURE_W * TEXTURE_H];
+
+    target->name = name;
+    target->window = SDL_CreateWindow(name, x, 0, WINDOW_W, WINDOW_H,
+                                      SDL_WINDOW_SHOWN);
+    if (!target->window || CreateRenderer(target->window, name) < 0) {
+        printf("Couldn't create a %s renderer: %s\n", name, SDL_GetError());
+        return -1;
+    }
+    SDL_GetRendererInfo(&info);
+    blend_modes &= info.blend_modes;
+    scale_modes &= info.scale_modes;
+
+    target->texture = SDL_CreateTexture(SDL_PIXELFORMAT_ARGB8888,
+                                        SDL_TEXTUREACCESS_STATIC, TEXTURE_W,
+                                        TEXTURE_H);
+    target->streaming = SDL_CreateTexture(SDL_PIXELFORMAT_ARGB8888,
+                                          SDL_TEXTUREACCESS_STREAMING,
+                                          TEXTURE_W, TEXTURE_H);
+    if (!target->texture || !target->streaming) {
+        printf("Couldn't create %s textures: %s\n", name, SDL_GetError());
+        return -1;
+    }
+    MakePixels(pixels, 0);
+    SDL_UpdateTexture(target->texture, NULL, pixels, TEXTURE_W * 4);
+    return 0;
+}
+
+static void
+Copy(SDL_TextureID texture, int blend, int x, int y, int w, int h)
+{
+    SDL_Rect dstrect;
+
+    dstrect.x = x;
+    dstrect.y = y;
+    dstrect.w = w;
+    dstrect.h = h;
+    SDL_SetTextureBlendMode(texture, blend);
+    SDL_RenderCopy(texture, NULL, &dstrect);
+}
+
+static void
+DrawScene(Target * target, int frame)
+{
+    Uint32 pixels[TEXTURE_W * TEXTURE_H];
+    SDL_Rect srcrect, dstrect;
+    int scale_mode;
+
+    SDL_SelectRenderer(target->window);
+    SDL_SetRenderDrawColor(32, 48, 64, 255);
+    SDL_SetRenderDrawBlendMode(SDL_BLENDMODE_NONE);
+    SDL_RenderFill(NULL);
+
+    /* The same texture with every blend mode both renderers have, so its
+       pixels are converted again each time */
+    Copy(target->texture, SDL_BLENDMODE_BLEND, 8, 8, TEXTURE_W, TEXTURE_H);
+    Copy(target->texture, SDL_BLENDMODE_NONE, 8, 80, TEXTURE_W, TEXTURE_H);
+    if (blend_modes & SDL_BLENDMODE_ADD) {
+        Copy(target->texture, SDL_BLENDMODE_ADD, 80, 80, TEXTURE_W,
+             TEXTURE_H);
+    }
+    if (blend_modes & SDL_BLENDMODE_MOD) {
+        Copy(target->texture, SDL_BLENDMODE_MOD, 152, 80, TEXTURE_W,
+             TEXTURE_H);
+    }
+    Copy(target->texture, SDL_BLENDMODE_BLEND, 8, 120, TEXTURE_W,
+         TEXTURE_H);
+
+    /* Scaled up and down */
+    scale_mode = (scale_modes & SDL_TEXTURESCALEMODE_SLOW) ?
+        SDL_TEXTURESCALEMODE_SLOW : SDL_TEXTURESCALEMODE_FAST;
+    SDL_SetTextureScaleMode(target->texture, scale_mode);
+    Copy(target->texture, SDL_BLENDMODE_BLEND, 80, 8, 2 * TEXTURE_W,
+         TEXTURE_H);
+    Copy(target->texture, SDL_BLENDMODE_BLEND, 216, 8, TEXTURE_W / 2,
+         TEXTURE_H / 2);
+
+    /* Part of it scaled, filtering mustn't pick up the texels around it */
+    srcrect.x = TEXTURE_W / 4;
+    srcrect.y = TEXTURE_H / 4;
+    srcrect.w = TEXTURE_W / 2;
+    srcrect.h = TEXTURE_H / 2;
+    dstrect.x = 216;
+    dstrect.y = 48;
+    dstrect.w = TEXTURE_W / 2 + 8;
+    dstrect.h = TEXTURE_H / 2 + 8;
+    SDL_SetTextureBlendMode(target->texture, SDL_BLENDMODE_NONE);
+    SDL_RenderCopy(target->texture, &srcrect, &dstrect);
+    SDL_SetTextureScaleMode(target->texture, SDL_TEXTURESCALEMODE_NONE);
+
+    /* New pixels every frame */
+    MakePixels(pixels, frame);
+    SDL_UpdateTexture(target->streaming, NULL, pixels, TEXTURE_W * 4);
+    Copy(target->streaming, SDL_BLENDMODE_BLEND, 80, 120, TEXTURE_W,
+         TEXTURE_H);
+
+    SDL_RenderPresent();
+}
+
+static int
+MaskShift(unsigned long mask)
+{
+    int shift = 0;
+
+    while (mask && !(mask & 1)) {
+        mask >>= 1;
+        ++shift;
+    }
+    return shift;
+}
+
+static Uint8
+MaskValue(unsigned long pixel, unsigned long mask)
+{
+    const int shift = MaskShift(mask);
+    const unsigned long max = mask >> shift;
+
+    if (!max) {
+        return 0;
+    }
+    return (Uint8) ((((pixel & mask) >> shift) * 255) / max);
+}
+
+/* What the X server shows in the window */
+static SDL_Surface *
+ReadWindow(SDL_WindowID window)
+{
+    SDL_SysWMinfo info;
+    XWindowAttributes attributes;
+    XImage *image;
+    SDL_Surface *surface;
+    int x, y;
+
+    SDL_VERSION(&info.version);
+    if (!SDL_GetWindowWMInfo(window, &info) ||
+        info.subsystem != SDL_SYSWM_X11) {
+        printf("Couldn't get the X11 window: %s\n", SDL_GetError());
+        return NULL;
+    }
+    XSync(info.info.x11.display, False);
+    XGetWindowAttributes(info.info.x11.display, info.info.x11.window,
+                         &attributes);
+    image = XGetImage(info.info.x11.display, info.info.x11.window, 0, 0,
+                      attributes.width, attributes.height, AllPlanes,
+                      ZPixmap);
+    if (!image) {
+        printf("Couldn't read the window back\n");
+        return NULL;
+    }
+
+    surface = SDL_CreateRGBSurface(0, attributes.width, attributes.height,
+                                   32, 0x00FF0000, 0x0000FF00, 0x000000FF,
+                                   0);
+    for (y = 0; surface && y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) surface->pixels +
+                                  y * surface->pitch);
+
+        for (x = 0; x < surface->w; ++x) {
+            const unsigned long pixel = XGetPixel(image, x, y);
+
+            row[x] = (MaskValue(pixel, image->red_mask) << 16) |
+                (MaskValue(pixel, image->green_mask) << 8) |
+                MaskValue(pixel, image->blue_mask);
+        }
+    }
+    XDestroyImage(image);
+    return surface;
+}
+
+static int
+Compare(const char *what, SDL_Surface * want, SDL_Surface * got)
+{
+    int x, y, c, wrong = 0;
+    int first_x = -1, first_y = -1;
+
+    if (want->w != got->w || want->h != got->h) {
+        printf("%s: the windows are %dx%d and %dx%d\n", what, want->w,
+               want->h, got->w, got->h);
+        return 1;
+    }
+    for (y = 0; y < want->h; ++y) {
+        const Uint8 *a = (Uint8 *) want->pixels + y * want->pitch;
+        const Uint8 *b = (Uint8 *) got->pixels + y * got->pitch;
+
+        for (x = 0; x < want->w * 4; x += 4) {
+            for (c = 0; c < 3; ++c) {
+                if (SDL_abs(a[x + c] - b[x + c]) > TOLERANCE) {
+                    if (!wrong++) {
+                        first_x = x / 4;
+                        first_y = y;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    if (wrong > MAX_WRONG) {
+        printf("%s: %d pixels are different, the first at %d,%d\n", what,
+               wrong, first_x, first_y);
+        return 1;
+    }
+    return 0;
+}
+
+/* Draw a few frames with both renderers and compare the last */
+static int
+CheckFrames(Target * targets, const char *what)
+{
+    SDL_Surface *want, *got;
+    SDL_Event event;
+    int frame, errors = 0;
+
+    for (frame = 0; frame < 3; ++frame) {
+        while (SDL_PollEvent(&event)) {
+            /* Just keep the windows going */ ;
+        }
+        DrawScene(&targets[0], frame);
+        DrawScene(&targets[1], frame);
+        SDL_Delay(50);
+    }
+    want = ReadWindow(targets[1].window);
+    got = ReadWindow(targets[0].window);
+    if (!want || !got) {
+        ++errors;
+    } else {
+        errors += Compare(what, want, got);
+    }
+    if (want) {
+        SDL_FreeSurface(want);
+    }
+    if (got) {
+        SDL_FreeSurface(got);
+    }
+    return errors;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Target targets[2];
+    int errors = 0;
+
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    if (SDL_strcmp(SDL_GetCurrentVideoDriver(), "x11") != 0) {
+        printf("The video driver is %s, not x11, SKIPPED\n",
+               SDL_GetCurrentVideoDriver());
+        SDL_Quit();
+        return 0;
+    }
+
+    blend_modes = ~0;
+    scale_modes = ~0;
+    if (CreateTarget(&targets[0], "x11", 0) < 0 ||
+        CreateTarget(&targets[1], "software", 2 * WINDOW_W) < 0) {
+        SDL_Quit();
+        return 1;
+    }
+
+    errors += CheckFrames(targets, "x11 against software");
+
+    /* The X11 renderer makes new pixmaps and pictures for the new size */
+    SDL_SetWindowSize(targets[0].window, WINDOW_W + 64, WINDOW_H + 48);
+    SDL_SetWindowSize(targets[1].window, WINDOW_W + 64, WINDOW_H + 48);
+    errors += CheckFrames(targets, "x11 against software, resized");
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
+
+#else
+
+int
+main(int argc, char *argv[])
+{
+    printf("SDL wasn't built with X11 support, SKIPPED\n");
+    return 0;
+}
+
+#endif /* SDL_VIDEO_DRIVER_X11 */
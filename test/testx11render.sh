@@ -0,0 +1,37 @@
+#!/bin/sh
+#
+# Check the X11 renderer against the software renderer, then run
+# testsprite2 with it blending and scaling for a few seconds.  Without a
+# display this starts itself again under Xvfb.
+
+if test x"$DISPLAY" = x; then
+    if test x"$XVFB_RUNNING" = x && which xvfb-run >/dev/null 2>&1; then
+        XVFB_RUNNING=1 exec xvfb-run -a -s "-screen 0 1024x768x24" "$0" "$@"
+    fi
+    echo "No display and no xvfb-run, SKIPPED"
+    exit 0
+fi
+
+SDL_VIDEODRIVER=x11
+export SDL_VIDEODRIVER
+
+status=0
+./testx11render || status=1
+SDL_VIDEO_X11_XRENDER=0 ./testx11render || status=1
+
+# These run until they're quit, so the timeout is how they pass
+for blend in blend add mod; do
+    timeout 5 ./testsprite2 --renderer x11 --blend $blend --scale slow \
+        --cyclealpha 50
+    if test $? -ne 124; then
+        echo "testsprite2 --blend $blend exited early"
+        status=1
+    fi
+done
+
+if test $status -eq 0; then
+    echo PASSED
+else
+    echo FAILED
+fi
+exit $status
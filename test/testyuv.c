@@ -0,0 +1,523 @@
+
+/*
+ * Checks and times YUV textures on the software renderer.
+ *
+ * Every YUV format is drawn once as is and once clipped and scaled, and
+ * the frames the dummy video driver saves are compared with the colours
+ * worked out here.  Then 1920x1080 frames are uploaded and drawn for a
+ * while, both at their own size and scaled to 1280x720, and the frames
+ * per second printed.  Last, the formats are drawn again with the
+ * conversion split into bands on three pool threads, which must give the
+ * same bytes as one thread; on a build with --enable-profiling it also
+ * checks that the bands were really used.
+ *
+ * Set SDL_BLIT_CPU_FEATURES=0 to try the plain C converters, and
+ * SDL_BLIT_THREADS=<n> to convert on n threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define CHECK_W     64
+#define CHECK_H     48
+#define MOVIE_W     1920
+#define MOVIE_H     1080
+#define TOLERANCE   3
+
+static int frames_saved;
+
+static const struct
+{
+    Uint32 format;
+    const char *name;
+} formats[] = {
+    {SDL_PIXELFORMAT_YV12, "YV12"},
+    {SDL_PIXELFORMAT_IYUV, "IYUV"},
+    {SDL_PIXELFORMAT_NV12, "NV12"},
+    {SDL_PIXELFORMAT_NV21, "NV21"},
+    {SDL_PIXELFORMAT_YUY2, "YUY2"},
+    {SDL_PIXELFORMAT_UYVY, "UYVY"},
+    {SDL_PIXELFORMAT_YVYU, "YVYU"},
+};
+
+static SDL_bool
+IsPacked(Uint32 format)
+{
+    return (format == SDL_PIXELFORMAT_YUY2 ||
+            format == SDL_PIXELFORMAT_UYVY ||
+            format == SDL_PIXELFORMAT_YVYU);
+}
+
+/* The picture: Y changes with every pixel, U and V with every chroma
+   sample, so mistakes in either show up. */
+static Uint8
+LumAt(int x, int y)
+{
+    return (Uint8) (x * 7 + y * 3);
+}
+
+static Uint8
+CbAt(int cx, int cy)
+{
+    return (Uint8) (cx * 13 + cy * 5 + 64);
+}
+
+static Uint8
+CrAt(int cx, int cy)
+{
+    return (Uint8) (cx * 3 + cy * 11 + 16);
+}
+
+/* Fill 'pixels' with the picture in 'format', returning the pitch */
+static int
+MakeFrame(Uint32 format, int w, int h, Uint8 * pixels)
+{
+    Uint8 *lum = pixels;
+    Uint8 *chroma = pixels + w * h;
+    int x, y;
+
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        {
+            Uint8 *first = chroma;
+            Uint8 *second = chroma + (w / 2) * (h / 2);
+            Uint8 *cr = (format == SDL_PIXELFORMAT_YV12) ? first : second;
+            Uint8 *cb = (format == SDL_PIXELFORMAT_YV12) ? second : first;
+
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    lum[y * w + x] = LumAt(x, y);
+                }
+            }
+            for (y = 0; y < h / 2; ++y) {
+                for (x = 0; x < w / 2; ++x) {
+                    cr[y * (w / 2) + x] = CrAt(x, y);
+                    cb[y * (w / 2) + x] = CbAt(x, y);
+                }
+            }
+        }
+        return w;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                lum[y * w + x] = LumAt(x, y);
+            }
+        }
+        for (y = 0; y < h / 2; ++y) {
+            for (x = 0; x < w / 2; ++x) {
+                Uint8 *pair = chroma + y * w + x * 2;
+                if (format == SDL_PIXELFORMAT_NV12) {
+                    pair[0] = CbAt(x, y);
+                    pair[1] = CrAt(x, y);
+                } else {
+                    pair[0] = CrAt(x, y);
+                    pair[1] = CbAt(x, y);
+                }
+            }
+        }
+        return w;
+    default:
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; x += 2) {
+                Uint8 *p = pixels + y * w * 2 + x * 2;
+                Uint8 Y0 = LumAt(x, y), Y1 = LumAt(x + 1, y);
+                Uint8 U = CbAt(x / 2, y), V = CrAt(x / 2, y);
+
+                if (format == SDL_PIXELFORMAT_YUY2) {
+                    p[0] = Y0; p[1] = U; p[2] = Y1; p[3] = V;
+                } else if (format == SDL_PIXELFORMAT_UYVY) {
+                    p[0] = U; p[1] = Y0; p[2] = V; p[3] = Y1;
+                } else {
+                    p[0] = Y0; p[1] = V; p[2] = Y1; p[3] = U;
+                }
+            }
+        }
+        return w * 2;
+    }
+}
+
+static int
+Clamp(int value)
+{
+    return (value < 0) ? 0 : ((value > 255) ? 255 : value);
+}
+
+/* The colour SDL should draw for texture pixel (x, y) */
+static void
+Expected(Uint32 format, int x, int y, int *r, int *g, int *b)
+{
+    const int cy = IsPacked(format) ? y : y / 2;
+    const int L = LumAt(x, y);
+    const int CB = CbAt(x / 2, cy) - 128;
+    const int CR = CrAt(x / 2, cy) - 128;
+
+    *r = Clamp(L + (int) ((0.419 / 0.299) * CR));
+    *g = Clamp(L + (int) (-(0.299 / 0.419) * CR) +
+               (int) (-(0.114 / 0.331) * CB));
+    *b = Clamp(L + (int) ((0.587 / 0.331) * CB));
+}
+
+static Uint32
+GetPixel(SDL_Surface * surface, int x, int y)
+{
+    Uint8 *p = (Uint8 *) surface->pixels + y * surface->pitch +
+        x * surface->format->BytesPerPixel;
+
+    switch (surface->format->BytesPerPixel) {
+    case 2:
+        return *(Uint16 *) p;
+    case 3:
+        if (SDL_BYTEORDER == SDL_LIL_ENDIAN) {
+            return p[0] | (p[1] << 8) | (p[2] << 16);
+        } else {
+            return (p[0] << 16) | (p[1] << 8) | p[2];
+        }
+    case 4:
+        return *(Uint32 *) p;
+    }
+    return 0;
+}
+
+/* Compare the frame the dummy driver saved with what it should show */
+/* Load the frame the dummy driver saved last */
+static SDL_Surface *
+LoadFrame(SDL_WindowID window)
+{
+    char file[128];
+    SDL_Surface *saved;
+
+    SDL_snprintf(file, sizeof(file), "SDL_window%d-%8.8d.bmp", window,
+                 ++frames_saved);
+    saved = SDL_LoadBMP(file);
+    remove(file);
+    if (!saved) {
+        printf("Couldn't load %s: %s\n", file, SDL_GetError());
+    }
+    return saved;
+}
+
+static int
+CheckFrame(SDL_WindowID window, int index, const char *what,
+           const SDL_Rect * srcrect)
+{
+    SDL_Surface *saved;
+    int x, y, errors = 0;
+
+    saved = LoadFrame(window);
+    if (!saved) {
+        return 1;
+    }
+
+    for (y = 0; y < saved->h && !errors; ++y) {
+        for (x = 0; x < saved->w && !errors; ++x) {
+            const int sx = srcrect->x + (x * srcrect->w) / saved->w;
+            const int sy = srcrect->y + (y * srcrect->h) / saved->h;
+            int r, g, b;
+            Uint8 R, G, B;
+
+            Expected(formats[index].format, sx, sy, &r, &g, &b);
+            SDL_GetRGB(GetPixel(saved, x, y), saved->format, &R, &G, &B);
+            if (SDL_abs(R - r) > TOLERANCE || SDL_abs(G - g) > TOLERANCE ||
+                SDL_abs(B - b) > TOLERANCE) {
+                printf("%s %s: pixel %d,%d is %d,%d,%d, not %d,%d,%d\n",
+                       what, formats[index].name,
+                       x, y, R, G, B, r, g, b);
+                ++errors;
+            }
+        }
+    }
+    SDL_FreeSurface(saved);
+    return errors;
+}
+
+static int
+CheckFormats(void)
+{
+    SDL_WindowID window;
+    SDL_Rect full, clipped;
+    Uint8 *pixels;
+    int i, errors = 0;
+
+    window = SDL_CreateWindow("testyuv", 0, 0, CHECK_W, CHECK_H, 0);
+    if (!window || SDL_CreateRenderer(window, -1, 0) < 0) {
+        printf("Couldn't create a renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+    pixels = (Uint8 *) SDL_malloc(CHECK_W * CHECK_H * 2);
+    if (!pixels) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    full.x = full.y = 0;
+    full.w = CHECK_W;
+    full.h = CHECK_H;
+    clipped.x = 3;
+    clipped.y = 5;
+    clipped.w = 40;
+    clipped.h = 29;
+
+    /* Have the dummy driver save what's drawn */
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=1");
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_TextureID texture;
+        int pitch;
+
+        texture = SDL_CreateTexture(formats[i].format,
+                                    SDL_TEXTUREACCESS_STREAMING, CHECK_W,
+                                    CHECK_H);
+        if (!texture) {
+            printf("Couldn't create a %s texture: %s\n", formats[i].name,
+                   SDL_GetError());
+            ++errors;
+            continue;
+        }
+        pitch = MakeFrame(formats[i].format, CHECK_W, CHECK_H, pixels);
+        SDL_UpdateTexture(texture, NULL, pixels, pitch);
+
+        SDL_RenderCopy(texture, NULL, NULL);
+        SDL_RenderPresent();
+        errors += CheckFrame(window, i, "Full", &full);
+
+        SDL_RenderCopy(texture, &clipped, NULL);
+        SDL_RenderPresent();
+        errors += CheckFrame(window, i, "Scaled", &clipped);
+
+        SDL_DestroyTexture(texture);
+    }
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=");
+
+    SDL_free(pixels);
+    SDL_DestroyWindow(window);
+    return errors;
+}
+
+/* Draw each format as is and clipped and scaled, saving the frames */
+static int
+DrawFormats(SDL_Surface ** saved)
+{
+    SDL_WindowID window;
+    SDL_Rect clipped;
+    Uint8 *pixels;
+    int i, n = 0;
+
+    window = SDL_CreateWindow("testyuv", 0, 0, CHECK_W, CHECK_H, 0);
+    if (!window || SDL_CreateRenderer(window, -1, 0) < 0) {
+        printf("Couldn't create a renderer: %s\n", SDL_GetError());
+        return 0;
+    }
+    pixels = (Uint8 *) SDL_malloc(CHECK_W * CHECK_H * 2);
+    if (!pixels) {
+        printf("Out of memory\n");
+        return 0;
+    }
+    clipped.x = 3;
+    clipped.y = 5;
+    clipped.w = 40;
+    clipped.h = 29;
+
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=1");
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_TextureID texture;
+        int pitch;
+
+        texture = SDL_CreateTexture(formats[i].format,
+                                    SDL_TEXTUREACCESS_STREAMING, CHECK_W,
+                                    CHECK_H);
+        if (!texture) {
+            continue;
+        }
+        pitch = MakeFrame(formats[i].format, CHECK_W, CHECK_H, pixels);
+        SDL_UpdateTexture(texture, NULL, pixels, pitch);
+
+        SDL_RenderCopy(texture, NULL, NULL);
+        SDL_RenderPresent();
+        saved[n++] = LoadFrame(window);
+
+        SDL_RenderCopy(texture, &clipped, NULL);
+        SDL_RenderPresent();
+        saved[n++] = LoadFrame(window);
+
+        SDL_DestroyTexture(texture);
+    }
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=");
+
+    SDL_free(pixels);
+    SDL_DestroyWindow(window);
+    return n;
+}
+
+/* Whether SDL_SW_CopyYUVToRGB() split a copy into bands, or -1 if SDL was
+   built without the counters that tell */
+static int
+UsedBands(void)
+{
+    SDL_ProfileCounter counters[256];
+    int i, n;
+
+    n = SDL_GetProfileCounters(counters, SDL_arraysize(counters));
+    if (n < 0) {
+        return -1;
+    }
+    for (i = 0; i < SDL_min(n, SDL_arraysize(counters)); ++i) {
+        if (SDL_strcmp(counters[i].name, "SDL_SW_CopyYUVToRGB in bands") ==
+            0 && counters[i].calls > 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Convert on one thread, then in bands on three pool threads */
+static int
+CheckBands(void)
+{
+    SDL_Surface *single[2 * SDL_arraysize(formats)];
+    SDL_Surface *banded[2 * SDL_arraysize(formats)];
+    int i, y, n, errors = 0;
+
+    SDL_Quit();
+    SDL_putenv("SDL_BLIT_THREADS=1");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        printf("Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    n = DrawFormats(single);
+
+    SDL_Quit();
+    SDL_putenv("SDL_THREAD_POOL_SIZE=3");
+    SDL_putenv("SDL_BLIT_THREADS=4");
+    SDL_putenv("SDL_BLIT_THREAD_THRESHOLD=1");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        printf("Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+    SDL_ResetProfileCounters();
+    if (DrawFormats(banded) != n || n == 0) {
+        printf("Couldn't draw the formats again in bands\n");
+        return 1;
+    }
+
+    switch (UsedBands()) {
+    case -1:
+        printf("Built without profiling, can't tell if bands were used\n");
+        break;
+    case 0:
+        printf("The YUV conversions weren't split into bands\n");
+        ++errors;
+        break;
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (!single[i] || !banded[i]) {
+            ++errors;
+        }
+        for (y = 0; single[i] && banded[i] && y < single[i]->h; ++y) {
+            if (SDL_memcmp((Uint8 *) single[i]->pixels +
+                           y * single[i]->pitch,
+                           (Uint8 *) banded[i]->pixels +
+                           y * banded[i]->pitch,
+                           single[i]->w *
+                           single[i]->format->BytesPerPixel) != 0) {
+                printf("%s %s: row %d is different in bands\n",
+                       (i & 1) ? "Scaled" : "Full", formats[i / 2].name, y);
+                ++errors;
+                break;
+            }
+        }
+        if (single[i]) {
+            SDL_FreeSurface(single[i]);
+        }
+        if (banded[i]) {
+            SDL_FreeSurface(banded[i]);
+        }
+    }
+    return errors;
+}
+
+static void
+TimeFormats(int frames)
+{
+    SDL_WindowID window;
+    SDL_Rect scaled;
+    Uint8 *pixels;
+    int i, j, pass;
+
+    window = SDL_CreateWindow("testyuv", 0, 0, MOVIE_W, MOVIE_H, 0);
+    if (!window || SDL_CreateRenderer(window, -1, 0) < 0) {
+        printf("Couldn't create a renderer: %s\n", SDL_GetError());
+        return;
+    }
+    pixels = (Uint8 *) SDL_malloc(MOVIE_W * MOVIE_H * 2);
+    if (!pixels) {
+        return;
+    }
+    scaled.x = scaled.y = 0;
+    scaled.w = 1280;
+    scaled.h = 720;
+
+    printf("%dx%d frames per second (upload and draw):\n", MOVIE_W,
+           MOVIE_H);
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_TextureID texture;
+        int pitch;
+
+        texture = SDL_CreateTexture(formats[i].format,
+                                    SDL_TEXTUREACCESS_STREAMING, MOVIE_W,
+                                    MOVIE_H);
+        if (!texture) {
+            continue;
+        }
+        pitch = MakeFrame(formats[i].format, MOVIE_W, MOVIE_H, pixels);
+
+        printf("    %s:", formats[i].name);
+        for (pass = 0; pass < 2; ++pass) {
+            Uint64 start = SDL_GetPerformanceCounter();
+            double seconds;
+
+            for (j = 0; j < frames; ++j) {
+                SDL_UpdateTexture(texture, NULL, pixels, pitch);
+                SDL_RenderCopy(texture, NULL, pass ? &scaled : NULL);
+            }
+            seconds = (double) (SDL_GetPerformanceCounter() - start) /
+                SDL_GetPerformanceFrequency();
+            printf(" %7.1f %s", frames / seconds,
+                   pass ? "scaled to 1280x720" : "1:1,");
+        }
+        printf("\n");
+        SDL_DestroyTexture(texture);
+    }
+
+    SDL_free(pixels);
+    SDL_DestroyWindow(window);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int frames = 60;
+    int errors;
+
+    if (argc > 2 && SDL_strcmp(argv[1], "-frames") == 0) {
+        frames = SDL_atoi(argv[2]);
+    }
+
+    /* Frames can only be checked with the dummy driver */
+    SDL_putenv("SDL_VIDEODRIVER=dummy");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    errors = CheckFormats();
+    TimeFormats(frames);
+    errors += CheckBands();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}
@@ -0,0 +1,272 @@
+
+/*
+ * Checks the software renderer presenting streaming textures in the display
+ * format straight from the texture, without copying them to its back
+ * buffer first, and times full frame updates through the 1.2 API, which
+ * works that way.
+ *
+ * This uses the dummy video driver, which can save the frames it shows.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define WINDOW_W    640
+#define WINDOW_H    480
+#define NUM_FRAMES  200
+
+static int frame_number = 0;
+
+/* Load the frame the dummy driver saved last.  The 1.2 API doesn't tell
+   which window it uses, so look for the frame number in any of them.
+ */
+static SDL_Surface *
+LoadFrame(void)
+{
+    SDL_Surface *saved = NULL, *converted;
+    char file[128];
+    int window;
+
+    ++frame_number;
+    for (window = 1; window < 1000 && !saved; ++window) {
+        FILE *fp;
+
+        SDL_snprintf(file, sizeof(file), "SDL_window%d-%8.8d.bmp", window,
+                     frame_number);
+        fp = fopen(file, "rb");
+        if (fp) {
+            fclose(fp);
+            saved = SDL_LoadBMP(file);
+            remove(file);
+        }
+    }
+    if (!saved) {
+        printf("Couldn't load frame %d: %s\n", frame_number, SDL_GetError());
+        return NULL;
+    }
+    converted = SDL_CreateRGBSurface(0, WINDOW_W, WINDOW_H, 32, 0x00FF0000,
+                                     0x0000FF00, 0x000000FF, 0);
+    if (converted) {
+        SDL_BlitSurface(saved, NULL, converted, NULL);
+    }
+    SDL_FreeSurface(saved);
+    return converted;
+}
+
+/* The colour of a test pattern at a pixel */
+static Uint32
+Pattern(int x, int y, int seed)
+{
+    return ((((x + seed) & 0xFF) << 16) | (((y * 3 + seed) & 0xFF) << 8) |
+            ((x ^ y ^ seed) & 0xFF));
+}
+
+static void
+DrawPattern(void *pixels, int pitch, int seed)
+{
+    int x, y;
+
+    for (y = 0; y < WINDOW_H; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) pixels + y * pitch);
+
+        for (x = 0; x < WINDOW_W; ++x) {
+            row[x] = Pattern(x, y, seed);
+        }
+    }
+}
+
+/* Check a saved frame for the pattern 'inside' within 'rect' and the
+   pattern 'outside' everywhere else.  A negative seed is a plain colour.
+ */
+static int
+CheckFrame(const char *what, SDL_Surface * frame, const SDL_Rect * rect,
+           int inside, int outside)
+{
+    int x, y, seed, errors = 0;
+
+    if (!frame) {
+        return 1;
+    }
+    for (y = 0; y < WINDOW_H && errors < 10; ++y) {
+        const Uint32 *row =
+            (const Uint32 *) ((Uint8 *) frame->pixels + y * frame->pitch);
+
+        for (x = 0; x < WINDOW_W && errors < 10; ++x) {
+            Uint32 want;
+
+            if (rect && x >= rect->x && y >= rect->y &&
+                x < rect->x + rect->w && y < rect->y + rect->h) {
+                seed = inside;
+            } else {
+                seed = outside;
+            }
+            want = (seed < 0) ? (Uint32) - seed : Pattern(x, y, seed);
+            if ((row[x] & 0x00FFFFFF) != want) {
+                printf("%s: pixel %d,%d is %6.6X, not %6.6X\n", what, x, y,
+                       row[x] & 0x00FFFFFF, want);
+                ++errors;
+            }
+        }
+    }
+    SDL_FreeSurface(frame);
+    return errors;
+}
+
+static int
+TestCompat(void)
+{
+    SDL_Surface *screen;
+    SDL_Rect rect;
+    int errors = 0;
+
+    screen = SDL_SetVideoMode(WINDOW_W, WINDOW_H, 32, SDL_SWSURFACE);
+    if (!screen || screen->format->BytesPerPixel != 4) {
+        printf("Couldn't set a 32-bit video mode: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* Start saving frames after the one setting the mode */
+    SDL_putenv("SDL_VIDEO_DUMMY_SAVE_FRAMES=1");
+
+    /* A full update shows everything */
+    SDL_LockSurface(screen);
+    DrawPattern(screen->pixels, screen->pitch, 1);
+    SDL_UnlockSurface(screen);
+    SDL_UpdateRect(screen, 0, 0, 0, 0);
+    errors += CheckFrame("Full update", LoadFrame(), NULL, 1, 1);
+
+    /* A partial update only shows what it covers */
+    rect.x = 100;
+    rect.y = 50;
+    rect.w = 200;
+    rect.h = 120;
+    SDL_LockSurface(screen);
+    DrawPattern(screen->pixels, screen->pitch, 2);
+    SDL_UnlockSurface(screen);
+    SDL_UpdateRects(screen, 1, &rect);
+    errors += CheckFrame("Partial update", LoadFrame(), &rect, 2, 1);
+
+    return errors;
+}
+
+static int
+TestRenderer(void)
+{
+    SDL_WindowID window;
+    SDL_TextureID texture;
+    SDL_DisplayMode mode;
+    SDL_Rect rect;
+    void *pixels;
+    int i, pitch, errors = 0;
+
+    window = SDL_CreateWindow("testzerocopy", 0, 0, WINDOW_W, WINDOW_H, 0);
+    if (!window) {
+        printf("Couldn't create a window: %s\n", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < SDL_GetNumRenderDrivers(); ++i) {
+        SDL_RendererInfo info;
+
+        if (SDL_GetRenderDriverInfo(i, &info) == 0 &&
+            SDL_strcmp(info.name, "software") == 0) {
+            break;
+        }
+    }
+    if (SDL_CreateRenderer(window, i, SDL_RENDERER_PRESENTDISCARD) < 0) {
+        printf("Couldn't create a renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+    SDL_GetDesktopDisplayMode(&mode);
+    texture = SDL_CreateTexture(mode.format, SDL_TEXTUREACCESS_STREAMING,
+                                WINDOW_W, WINDOW_H);
+    if (!texture || SDL_LockTexture(texture, NULL, 1, &pixels, &pitch) < 0) {
+        printf("Couldn't create a texture: %s\n", SDL_GetError());
+        return 1;
+    }
+    DrawPattern(pixels, pitch, 3);
+    SDL_UnlockTexture(texture);
+
+    /* Just the texture */
+    SDL_RenderCopy(texture, NULL, NULL);
+    SDL_RenderPresent();
+    errors += CheckFrame("Texture", LoadFrame(), NULL, 3, 3);
+
+    /* The texture with something drawn over it */
+    rect.x = 20;
+    rect.y = 30;
+    rect.w = 40;
+    rect.h = 50;
+    SDL_RenderCopy(texture, NULL, NULL);
+    SDL_SetRenderDrawColor(0x00, 0xFF, 0x00, 0xFF);
+    SDL_RenderFill(&rect);
+    SDL_RenderPresent();
+    errors += CheckFrame("Texture and fill", LoadFrame(), &rect, -0x00FF00,
+                         3);
+
+    /* The texture changing after it was copied */
+    SDL_RenderCopy(texture, NULL, NULL);
+    SDL_LockTexture(texture, NULL, 1, &pixels, &pitch);
+    DrawPattern(pixels, pitch, 4);
+    SDL_UnlockTexture(texture);
+    SDL_RenderPresent();
+    errors += CheckFrame("Texture changed", LoadFrame(), NULL, 3, 3);
+
+    /* And the new contents next time */
+    SDL_RenderCopy(texture, NULL, NULL);
+    SDL_RenderPresent();
+    errors += CheckFrame("Texture next frame", LoadFrame(), NULL, 4, 4);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyWindow(window);
+    return errors;
+}
+
+static void
+TimeUpdates(void)
+{
+    SDL_Surface *screen;
+    Uint64 start, elapsed;
+    int frame;
+
+    screen = SDL_SetVideoMode(WINDOW_W, WINDOW_H, 32, SDL_SWSURFACE);
+    if (!screen) {
+        return;
+    }
+    start = SDL_GetPerformanceCounter();
+    for (frame = 0; frame < NUM_FRAMES; ++frame) {
+        SDL_LockSurface(screen);
+        SDL_memset(screen->pixels, frame, screen->h * screen->pitch);
+        SDL_UnlockSurface(screen);
+        SDL_UpdateRect(screen, 0, 0, 0, 0);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    printf("%dx%d full updates: %8.1f us a frame\n", WINDOW_W, WINDOW_H,
+           (double) elapsed * 1000000.0 / SDL_GetPerformanceFrequency() /
+           NUM_FRAMES);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int errors;
+
+    /* The frames can only be checked with the dummy driver */
+    SDL_putenv("SDL_VIDEODRIVER=dummy");
+    SDL_putenv("SDL_VIDEO_RENDERER=software");
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fprintf(stderr, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    TimeUpdates();
+
+    /* This leaves the dummy driver saving frames, so it goes last */
+    errors = TestCompat();
+    errors += TestRenderer();
+
+    SDL_Quit();
+    printf("%s\n", errors ? "FAILED" : "PASSED");
+    return (errors ? 1 : 0);
+}